@@ -0,0 +1,261 @@
+#include "AsyncLogger.h"
+#include <algorithm>
+#include <iterator>
+
+std::atomic<AsyncLogger*> AsyncLogger::instance { nullptr };
+
+namespace {
+    // LogCode 순서와 같아야 함 - {}는 숫자 인자, {?}는 ON/OFF
+    const char* const eventFormats[] = {
+        "",
+        "MIDI CC 24 (Bypass): {?}",
+        "Audio buffer flushed {} times",
+        "Recording ring buffer overflowed {} times, dropped {} samples",
+        "Recording write failed",
+        "Dry input write failed",
+        "Recording header commit failed",
+        "Audio thread heap allocations: {}",
+    };
+    static_assert(std::size(eventFormats) == (size_t)LogCode::numCodes, "eventFormats must match LogCode");
+
+    const char* getLevelName(int level) {
+        switch (level) {
+            case LogLevel::debug:   return "DEBUG";
+            case LogLevel::info:    return "INFO ";
+            case LogLevel::warning: return "WARN ";
+            default:                return "ERROR";
+        }
+    }
+
+    juce::String formatArg(double value) {
+        if (value == std::floor(value) && std::abs(value) < 1.0e15) return juce::String((juce::int64)value);
+        return juce::String(value, 3);
+    }
+}
+
+AsyncLogger::AsyncLogger(const juce::File& logFolderToUse)
+    : juce::Thread("ClearHost Log"), logFolder(logFolderToUse),
+      logFile(logFolderToUse.getChildFile("ClearHost.log")),
+      busyMarker(static_cast<juce::Thread::ThreadID>(this)) {
+    for (auto& queue : queues) queue.records.resize((size_t)RECORDS_PER_QUEUE);
+    batch.reserve((size_t)(MAX_THREAD_QUEUES * RECORDS_PER_QUEUE));
+
+    logFolder.createDirectory();
+    stream = std::make_unique<juce::FileOutputStream>(logFile);
+    if (stream->failedToOpen()) {
+        juce::Logger::outputDebugString("Failed to open log file: " + logFile.getFullPathName());
+        stream = nullptr;
+    }
+
+    instance.store(this, std::memory_order_release);
+    startThread();
+}
+
+AsyncLogger::~AsyncLogger() {
+    // 새 기록을 막은 뒤 로그 스레드가 남은 레코드를 모두 쓰고 종료
+    instance.store(nullptr, std::memory_order_release);
+    signalThreadShouldExit();
+    notify();
+    stopThread(2000);
+    drain();
+}
+
+juce::File AsyncLogger::getDefaultLogFolder() {
+    return juce::FileLogger::getSystemLogFileFolder().getChildFile("ClearHost");
+}
+
+void AsyncLogger::text(int level, const juce::String& message) noexcept {
+    if (auto* logger = instance.load(std::memory_order_acquire)) {
+        logger->push(level, LogCode::text, &message, nullptr);
+    } else {
+        juce::Logger::outputDebugString(message);
+    }
+}
+
+void AsyncLogger::event(int level, LogCode code, double a0, double a1, double a2, double a3) noexcept {
+    const double args[MAX_ARGS] = { a0, a1, a2, a3 };
+    if (auto* logger = instance.load(std::memory_order_acquire)) {
+        logger->push(level, code, nullptr, args);
+    } else {
+        Record record;
+        record.level = (juce::uint8)level;
+        record.code = code;
+        std::copy(std::begin(args), std::end(args), record.args.begin());
+        record.ticks = juce::Time::getHighResolutionTicks();
+        juce::Logger::outputDebugString(format(record));
+    }
+}
+
+void AsyncLogger::logMessage(const juce::String& message) {
+    push(LogLevel::info, LogCode::text, &message, nullptr);
+}
+
+void AsyncLogger::push(int level, LogCode code, const juce::String* message, const double* args) noexcept {
+    const auto self = juce::Thread::getCurrentThreadId();
+
+    // 1. 이 스레드가 이미 가진 큐
+    for (auto& queue : queues) {
+        if (queue.owner.load(std::memory_order_acquire) == self
+            && pushTo(queue, self, level, code, message, args)) return;
+    }
+
+    // 2. 빈 큐를 하나 차지 (스레드당 한 번, 유휴 큐는 로그 스레드가 회수)
+    for (auto& queue : queues) {
+        juce::Thread::ThreadID expected = nullptr;
+        if (!queue.owner.compare_exchange_strong(expected, self, std::memory_order_acq_rel)) continue;
+
+        // 이전 소유자의 마지막 push 시각이 남아 있으면 첫 push가 버려질 때(큐 가득) 바로 회수될 수 있음
+        queue.lastPushTicks.store(juce::Time::getHighResolutionTicks(), std::memory_order_relaxed);
+        if (pushTo(queue, self, level, code, message, args)) return;
+    }
+
+    droppedRecords.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool AsyncLogger::pushTo(ThreadQueue& queue, juce::Thread::ThreadID self, int level, LogCode code,
+                         const juce::String* message, const double* args) noexcept {
+    // push 동안 소유자를 busyMarker로 바꿔 둠 → 로그 스레드의 회수(소유자 → nullptr CAS)와 겹치지 않음
+    // 이미 회수되었으면 (소유자가 바뀌었으면) 다른 큐를 찾게 함
+    auto expected = self;
+    if (!queue.owner.compare_exchange_strong(expected, busyMarker, std::memory_order_acq_rel)) {
+        return false;
+    }
+
+    const int writePos = queue.writePos.load(std::memory_order_relaxed);
+    const int nextPos = (writePos + 1) % RECORDS_PER_QUEUE;
+
+    if (nextPos == queue.readPos.load(std::memory_order_acquire)) {
+        droppedRecords.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        auto& record = queue.records[(size_t)writePos];
+        record.ticks = juce::Time::getHighResolutionTicks();
+        record.level = (juce::uint8)level;
+        record.code = code;
+        if (message != nullptr) {
+            message->copyToUTF8(record.text, (size_t)TEXT_CAPACITY);
+        } else {
+            record.text[0] = 0;
+        }
+        if (args != nullptr) {
+            std::copy(args, args + MAX_ARGS, record.args.begin());
+        }
+        queue.lastPushTicks.store(record.ticks, std::memory_order_relaxed);
+        // 깨우기(notify)는 락을 잡으므로 하지 않음 - 로그 스레드가 주기적으로 가져감
+        queue.writePos.store(nextPos, std::memory_order_release);
+    }
+
+    queue.owner.store(self, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogger::run() {
+    while (!threadShouldExit()) {
+        wait(DRAIN_INTERVAL_MS);
+        drain();
+        reclaimIdleQueues();
+    }
+}
+
+void AsyncLogger::drain() {
+    batch.clear();
+    for (auto& queue : queues) {
+        int readPos = queue.readPos.load(std::memory_order_relaxed);
+        const int writePos = queue.writePos.load(std::memory_order_acquire);
+        while (readPos != writePos) {
+            batch.push_back(queue.records[(size_t)readPos]);
+            readPos = (readPos + 1) % RECORDS_PER_QUEUE;
+        }
+        queue.readPos.store(readPos, std::memory_order_release);
+    }
+
+    // 스레드별 큐를 합쳐 시간순으로
+    std::stable_sort(batch.begin(), batch.end(),
+                     [](const Record& a, const Record& b) { return a.ticks < b.ticks; });
+    for (const auto& record : batch) write(record);
+
+    const auto dropped = droppedRecords.load(std::memory_order_relaxed);
+    if (dropped != reportedDrops) {
+        Record note;
+        note.ticks = juce::Time::getHighResolutionTicks();
+        note.level = (juce::uint8)LogLevel::warning;
+        juce::String("Logger dropped " + juce::String(dropped - reportedDrops) + " records (queue full)")
+            .copyToUTF8(note.text, (size_t)TEXT_CAPACITY);
+        reportedDrops = dropped;
+        write(note);
+    }
+
+    if (stream != nullptr) stream->flush();
+}
+
+void AsyncLogger::reclaimIdleQueues() {
+    const auto nowTicks = juce::Time::getHighResolutionTicks();
+    const auto idleTicks = juce::Time::secondsToHighResolutionTicks(IDLE_QUEUE_RECLAIM_SECONDS);
+
+    for (auto& queue : queues) {
+        auto owner = queue.owner.load(std::memory_order_acquire);
+        if (owner == nullptr || owner == busyMarker) continue;
+        if (queue.readPos.load() != queue.writePos.load()) continue;
+        if (nowTicks - queue.lastPushTicks.load(std::memory_order_relaxed) < idleTicks) continue;
+
+        // 끝난 스레드(녹음 쓰기 스레드, 장치 재시작 후의 옛 오디오 스레드 등)의 큐를 반납
+        // push 도중이면 소유자가 busyMarker이므로 CAS가 실패 → 다음에 다시 시도
+        // 회수 직전에 끝난 push의 레코드는 큐에 남아 다음 drain에서 기록됨
+        queue.owner.compare_exchange_strong(owner, nullptr, std::memory_order_acq_rel);
+    }
+}
+
+void AsyncLogger::write(const Record& record) {
+    const auto line = format(record);
+    juce::Logger::outputDebugString(line);
+
+    if (stream == nullptr) return;
+    rotateIfNeeded();
+    if (stream != nullptr) {
+        stream->writeText(line + "\n", false, false, nullptr);
+    }
+}
+
+void AsyncLogger::rotateIfNeeded() {
+    if (stream->getPosition() < MAX_FILE_BYTES) return;
+
+    stream = nullptr;
+    logFolder.getChildFile("ClearHost." + juce::String(NUM_ROTATED_FILES) + ".log").deleteFile();
+    for (int i = NUM_ROTATED_FILES - 1; i >= 1; --i) {
+        const auto from = logFolder.getChildFile("ClearHost." + juce::String(i) + ".log");
+        if (from.existsAsFile()) from.moveFileTo(logFolder.getChildFile("ClearHost." + juce::String(i + 1) + ".log"));
+    }
+    logFile.moveFileTo(logFolder.getChildFile("ClearHost.1.log"));
+
+    stream = std::make_unique<juce::FileOutputStream>(logFile);
+    if (stream->failedToOpen()) stream = nullptr;
+}
+
+juce::String AsyncLogger::format(const Record& record) {
+    // 고해상도 틱을 현재 시각 기준으로 환산
+    const auto nowTicks = juce::Time::getHighResolutionTicks();
+    const auto ms = juce::Time::currentTimeMillis()
+                  - (juce::int64)(juce::Time::highResolutionTicksToSeconds(nowTicks - record.ticks) * 1000.0);
+    const juce::Time time(ms);
+
+    juce::String message;
+    if (record.code == LogCode::text) {
+        message = juce::String::fromUTF8(record.text);
+    } else {
+        const juce::String pattern(eventFormats[juce::jlimit(0, (int)LogCode::numCodes - 1, (int)record.code)]);
+        int arg = 0;
+        for (int i = 0; i < pattern.length(); ++i) {
+            if (pattern.substring(i).startsWith("{?}")) {
+                message << (record.args[(size_t)juce::jmin(arg++, MAX_ARGS - 1)] != 0.0 ? "ON" : "OFF");
+                i += 2;
+            } else if (pattern.substring(i).startsWith("{}")) {
+                message << formatArg(record.args[(size_t)juce::jmin(arg++, MAX_ARGS - 1)]);
+                i += 1;
+            } else {
+                message += juce::String::charToString(pattern[i]);
+            }
+        }
+    }
+
+    return time.formatted("%Y-%m-%d %H:%M:%S") + "." + juce::String(time.getMilliseconds()).paddedLeft('0', 3)
+         + " " + getLevelName(record.level) + " " + message;
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <vector>
+
+// 오디오/MIDI/장치 스레드에서 막히지 않는 로거
+// - 스레드마다 미리 할당한 고정 크기 레코드 큐(SPSC)에 넣기만 하고 즉시 반환 (할당/락/파일 I/O 없음)
+// - 로그 스레드가 큐를 모아 시간순으로 포맷해 회전 로그 파일과 디버그 출력에 기록
+// - 레벨은 컴파일 시점에 걸러짐 (CLEARHOST_LOG_MIN_LEVEL 미만은 메시지 식 자체가 실행되지 않음)
+// - juce::Logger로도 설치되므로 JUCE 내부 writeToLog도 같은 경로로 기록
+// - 큐가 가득 차거나 슬롯이 모자라면 기다리지 않고 버린 뒤 개수만 나중에 기록
+namespace LogLevel {
+    enum : int { debug = 0, info = 1, warning = 2, error = 3 };
+}
+
+#ifndef CLEARHOST_LOG_MIN_LEVEL
+ #if JUCE_DEBUG
+  #define CLEARHOST_LOG_MIN_LEVEL 0
+ #else
+  #define CLEARHOST_LOG_MIN_LEVEL 1
+ #endif
+#endif
+
+// 문자열 조합 없이 남기는 구조화 이벤트 (실시간 경로용) - 포맷 문자열은 AsyncLogger.cpp의 표
+enum class LogCode : juce::uint16 {
+    text = 0,                   // 일반 문자열 메시지
+    midiBypass,                 // (on)
+    recorderFlush,              // (flushCount)
+    recorderOverflow,           // (overflowCount, droppedSamples)
+    recorderWriteFailed,
+    recorderDryWriteFailed,
+    recorderHeaderCommitFailed,
+    audioThreadAllocations,     // (count)
+    numCodes
+};
+
+class AsyncLogger : public juce::Logger, private juce::Thread {
+public:
+    explicit AsyncLogger(const juce::File& logFolder = getDefaultLogFolder());
+    ~AsyncLogger() override;
+
+    static juce::File getDefaultLogFolder();
+    juce::File getCurrentLogFile() const { return logFile; }
+
+    // 매크로에서 호출 - 로거가 없으면 (설치 전/해제 후) 바로 디버그 출력
+    static void text(int level, const juce::String& message) noexcept;
+    static void event(int level, LogCode code, double a0 = 0.0, double a1 = 0.0, double a2 = 0.0, double a3 = 0.0) noexcept;
+
+private:
+    static constexpr int MAX_THREAD_QUEUES = 32;
+    static constexpr int RECORDS_PER_QUEUE = 128;
+    static constexpr int TEXT_CAPACITY = 256;               // UTF-8 바이트, 넘으면 잘림
+    static constexpr int MAX_ARGS = 4;
+    static constexpr int DRAIN_INTERVAL_MS = 50;
+    static constexpr juce::int64 MAX_FILE_BYTES = 2 * 1024 * 1024;
+    static constexpr int NUM_ROTATED_FILES = 4;             // ClearHost.1.log ~ ClearHost.4.log
+    static constexpr double IDLE_QUEUE_RECLAIM_SECONDS = 30.0;
+
+    struct Record {
+        juce::int64 ticks = 0;                  // Time::getHighResolutionTicks
+        juce::uint8 level = 0;
+        LogCode code = LogCode::text;
+        std::array<double, MAX_ARGS> args {};
+        char text[TEXT_CAPACITY] {};
+    };
+
+    // 한 스레드 전용 큐 - 생산자는 소유 스레드, 소비자는 로그 스레드
+    // owner: nullptr(빈 큐) / 소유 스레드 ID / busyMarker(소유 스레드가 push 중 - 회수하지 않음)
+    struct ThreadQueue {
+        std::atomic<juce::Thread::ThreadID> owner { nullptr };
+        std::atomic<juce::int64> lastPushTicks { 0 };
+        std::atomic<int> readPos { 0 };
+        std::atomic<int> writePos { 0 };
+        std::vector<Record> records;
+    };
+
+    void logMessage(const juce::String& message) override;
+    void run() override;
+
+    void push(int level, LogCode code, const juce::String* message, const double* args) noexcept;
+    bool pushTo(ThreadQueue& queue, juce::Thread::ThreadID self, int level, LogCode code,
+                const juce::String* message, const double* args) noexcept;
+    void drain();
+    void reclaimIdleQueues();
+    void write(const Record& record);
+    void rotateIfNeeded();
+    static juce::String format(const Record& record);
+
+    static std::atomic<AsyncLogger*> instance;
+
+    juce::File logFolder;
+    juce::File logFile;
+    std::unique_ptr<juce::FileOutputStream> stream;
+    std::array<ThreadQueue, MAX_THREAD_QUEUES> queues;
+    std::vector<Record> batch;                  // 로그 스레드 전용 정렬 버퍼
+    std::atomic<juce::int64> droppedRecords { 0 };
+    juce::int64 reportedDrops = 0;
+    juce::Thread::ThreadID busyMarker;          // push 중인 큐 표시 (실제 스레드 ID와 겹치지 않는 값)
+
+    JUCE_DECLARE_NON_COPYABLE(AsyncLogger)
+};
+
+// 레벨별 매크로 - 걸러진 레벨은 if constexpr로 제거되어 인자 식(문자열 조합 포함)이 실행되지 않음
+#define CLR_LOG(level, message) \
+    do { if constexpr ((level) >= CLEARHOST_LOG_MIN_LEVEL) AsyncLogger::text((level), (message)); } while (false)
+
+#define CLR_LOG_EVENT(level, ...) \
+    do { if constexpr ((level) >= CLEARHOST_LOG_MIN_LEVEL) AsyncLogger::event((level), __VA_ARGS__); } while (false)
+
+#define CLR_LOG_DEBUG(message)   CLR_LOG(LogLevel::debug, message)
+#define CLR_LOG_INFO(message)    CLR_LOG(LogLevel::info, message)
+#define CLR_LOG_WARNING(message) CLR_LOG(LogLevel::warning, message)
+#define CLR_LOG_ERROR(message)   CLR_LOG(LogLevel::error, message)
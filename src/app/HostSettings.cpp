@@ -0,0 +1,218 @@
+#include "HostSettings.h"
+#include "AsyncLogger.h"
+
+namespace SettingIds {
+    static const juce::Identifier faceColour { "faceColour" };
+    static const juce::Identifier inputDevice { "inputDevice" };
+    static const juce::Identifier outputDevice { "outputDevice" };
+    static const juce::Identifier activePreset { "activePreset" };
+    static const juce::Identifier stereo { "stereo" };
+    static const juce::Identifier windowState { "windowState" };
+    static const juce::Identifier bypassFadeMs { "bypassFadeMs" };
+    static const juce::Identifier firstRunCompleted { "firstRunCompleted" };
+    static const juce::Identifier version { "version" };
+
+    static juce::Identifier knob(int index) {
+        return juce::Identifier("knob" + juce::String(index));
+    }
+}
+
+HostSettings::HostSettings(const juce::File& fileToUse)
+    : juce::Thread("ClearHost Settings"), file(fileToUse) {
+    load();
+    startThread();
+}
+
+HostSettings::~HostSettings() {
+    signalThreadShouldExit();
+    notify();
+    stopThread(2000);
+    writeIfDirty();
+}
+
+juce::File HostSettings::getDefaultFile() {
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+           .getChildFile("ClearHost")
+           .getChildFile("settings.xml");
+}
+
+juce::Colour HostSettings::getFaceColour(juce::Colour fallback) const {
+    const auto text = get(SettingIds::faceColour).toString();
+    return text.isNotEmpty() ? juce::Colour::fromString(text) : fallback;
+}
+
+void HostSettings::setFaceColour(juce::Colour colour) {
+    set(SettingIds::faceColour, colour.toString());
+}
+
+juce::String HostSettings::getInputDevice() const {
+    return get(SettingIds::inputDevice).toString();
+}
+
+void HostSettings::setInputDevice(const juce::String& name) {
+    set(SettingIds::inputDevice, name);
+}
+
+juce::String HostSettings::getOutputDevice() const {
+    return get(SettingIds::outputDevice).toString();
+}
+
+void HostSettings::setOutputDevice(const juce::String& name) {
+    set(SettingIds::outputDevice, name);
+}
+
+juce::String HostSettings::getActivePreset() const {
+    return get(SettingIds::activePreset).toString();
+}
+
+void HostSettings::setActivePreset(const juce::String& name) {
+    set(SettingIds::activePreset, name);
+}
+
+std::optional<std::array<float, HostSettings::NUM_KNOBS>> HostSettings::getKnobValues() const {
+    const juce::ScopedLock sl(lock);
+    std::array<float, NUM_KNOBS> knobs {};
+    for (int i = 0; i < NUM_KNOBS; ++i) {
+        const auto* value = values.getVarPointer(SettingIds::knob(i));
+        if (value == nullptr) return std::nullopt;
+        knobs[(size_t)i] = juce::jlimit(0.0f, 1.0f, (float)(double)*value);
+    }
+    return knobs;
+}
+
+void HostSettings::setKnobValue(int knobIndex, float normalisedValue) {
+    if (!juce::isPositiveAndBelow(knobIndex, NUM_KNOBS)) return;
+    set(SettingIds::knob(knobIndex), (double)juce::jlimit(0.0f, 1.0f, normalisedValue));
+}
+
+bool HostSettings::getStereo() const {
+    return (bool)get(SettingIds::stereo, true);
+}
+
+void HostSettings::setStereo(bool stereo) {
+    set(SettingIds::stereo, stereo);
+}
+
+juce::String HostSettings::getWindowState() const {
+    return get(SettingIds::windowState).toString();
+}
+
+void HostSettings::setWindowState(const juce::String& state) {
+    set(SettingIds::windowState, state);
+}
+
+double HostSettings::getBypassFadeMs() const {
+    return juce::jlimit(0.0, 1000.0, (double)get(SettingIds::bypassFadeMs, 10.0));
+}
+
+bool HostSettings::isFirstRunCompleted() const {
+    return (bool)get(SettingIds::firstRunCompleted, false);
+}
+
+void HostSettings::setFirstRunCompleted(bool completed) {
+    set(SettingIds::firstRunCompleted, completed);
+}
+
+void HostSettings::flush() {
+    writeIfDirty();
+}
+
+juce::var HostSettings::get(const juce::Identifier& key, const juce::var& fallback) const {
+    const juce::ScopedLock sl(lock);
+    return values.getWithDefault(key, fallback);
+}
+
+void HostSettings::set(const juce::Identifier& key, const juce::var& value) {
+    {
+        const juce::ScopedLock sl(lock);
+        if (!values.set(key, value)) return;
+        dirty = true;
+        lastChangeMs = juce::Time::getMillisecondCounter();
+    }
+    notify();
+}
+
+void HostSettings::load() {
+    if (!file.existsAsFile()) {
+        migrateLegacyFiles();
+        return;
+    }
+
+    auto xml = juce::XmlDocument::parse(file);
+    if (xml == nullptr || !xml->hasTagName("ClearHostSettings")
+        || xml->getIntAttribute(SettingIds::version) > FORMAT_VERSION) {
+        CLR_LOG_WARNING("Ignoring unreadable settings file: " + file.getFullPathName());
+        return;
+    }
+
+    values.setFromXmlAttributes(*xml);
+    values.remove(SettingIds::version);
+    CLR_LOG_INFO("Settings loaded: " + file.getFullPathName());
+}
+
+// 이전 버전의 face_color.conf(PropertiesFile)와 first_run_completed.txt를 한 번만 가져오고 지움
+void HostSettings::migrateLegacyFiles() {
+    const auto folder = file.getParentDirectory();
+    const auto colourFile = folder.getChildFile("face_color.conf");
+    const auto firstRunFile = folder.getChildFile("first_run_completed.txt");
+    if (!colourFile.existsAsFile() && !firstRunFile.existsAsFile()) return;
+
+    if (colourFile.existsAsFile()) {
+        juce::PropertiesFile legacy(colourFile, juce::PropertiesFile::Options());
+        const auto savedColour = legacy.getValue("faceColor");
+        if (savedColour.isNotEmpty()) set(SettingIds::faceColour, savedColour);
+    }
+    if (firstRunFile.existsAsFile()) {
+        set(SettingIds::firstRunCompleted, true);
+    }
+
+    writeIfDirty();
+    if (file.existsAsFile()) {
+        colourFile.deleteFile();
+        firstRunFile.deleteFile();
+        CLR_LOG_INFO("Migrated legacy settings files into: " + file.getFullPathName());
+    }
+}
+
+void HostSettings::run() {
+    while (!threadShouldExit()) {
+        wait(-1);
+
+        // 마지막 변경 후 DEBOUNCE_MS 동안 조용해질 때까지 기다렸다가 한 번에 기록 (노브 드래그 등 연속 변경)
+        while (!threadShouldExit()) {
+            juce::uint32 sinceChangeMs = 0;
+            {
+                const juce::ScopedLock sl(lock);
+                if (!dirty) break;
+                sinceChangeMs = juce::Time::getMillisecondCounter() - lastChangeMs;
+            }
+            if (sinceChangeMs >= (juce::uint32)DEBOUNCE_MS) {
+                writeIfDirty();
+                break;
+            }
+            wait(DEBOUNCE_MS - (int)sinceChangeMs);
+        }
+    }
+}
+
+void HostSettings::writeIfDirty() {
+    const juce::ScopedLock wl(writeLock);
+
+    juce::XmlElement xml("ClearHostSettings");
+    {
+        const juce::ScopedLock sl(lock);
+        if (!dirty) return;
+        values.copyToXmlAttributes(xml);
+        dirty = false;
+    }
+    xml.setAttribute(SettingIds::version, FORMAT_VERSION);
+
+    // 임시 파일에 다 쓴 뒤 교체 - 쓰는 도중 종료되어도 settings.xml은 온전한 이전 내용
+    file.getParentDirectory().createDirectory();
+    juce::TemporaryFile temp(file);
+    if (!xml.writeTo(temp.getFile()) || !temp.overwriteTargetFileWithTemporary()) {
+        CLR_LOG_ERROR("Failed to write settings: " + file.getFullPathName());
+        const juce::ScopedLock sl(lock);
+        dirty = true;   // 다음 변경 때 다시 시도
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <optional>
+
+// 호스트 설정 저장소 (얼굴 색, 입출력 장치, 프리셋, 노브 값, stereo, 창 위치, bypass 페이드 길이, 첫 실행 여부)
+// - 시작 시 settings.xml 한 번만 읽어 메모리에 보관, 읽기는 파일 I/O 없음
+// - 쓰기는 값만 바꾸고 표시해 두면 저장 스레드가 마지막 변경 후 DEBOUNCE_MS 동안 조용할 때 한 번에 기록
+//   (임시 파일에 쓴 뒤 교체하므로 저장 중 종료되어도 이전 파일이 남음)
+// - 소멸 시 남은 변경을 바로 기록
+// - 모든 메서드는 어느 스레드에서든 호출 가능 (오디오 스레드 제외 - 락 사용)
+class HostSettings : private juce::Thread {
+public:
+    static constexpr int NUM_KNOBS = 3;
+
+    explicit HostSettings(const juce::File& file = getDefaultFile());
+    ~HostSettings() override;
+
+    static juce::File getDefaultFile();
+
+    juce::Colour getFaceColour(juce::Colour fallback) const;
+    void setFaceColour(juce::Colour colour);
+
+    // 드롭다운에 표시되는 장치 이름 (비어 있으면 저장된 값 없음)
+    juce::String getInputDevice() const;
+    void setInputDevice(const juce::String& name);
+    juce::String getOutputDevice() const;
+    void setOutputDevice(const juce::String& name);
+
+    // 활성 프리셋 이름 (비어 있으면 프리셋 없이 노브 값만)
+    juce::String getActivePreset() const;
+    void setActivePreset(const juce::String& name);
+
+    // 플러그인 파라미터 값 (0~1) - 한 번도 저장한 적 없으면 nullopt
+    std::optional<std::array<float, NUM_KNOBS>> getKnobValues() const;
+    void setKnobValue(int knobIndex, float normalisedValue);
+
+    bool getStereo() const;
+    void setStereo(bool stereo);
+
+    // DocumentWindow::getWindowStateAsString() 형식
+    juce::String getWindowState() const;
+    void setWindowState(const juce::String& state);
+
+    // bypass 크로스페이드 길이 (UI 없음 - settings.xml의 bypassFadeMs로 조절)
+    double getBypassFadeMs() const;
+
+    bool isFirstRunCompleted() const;
+    void setFirstRunCompleted(bool completed);
+
+    // 대기 중인 변경을 바로 기록
+    void flush();
+
+private:
+    static constexpr int FORMAT_VERSION = 1;
+    static constexpr int DEBOUNCE_MS = 500;
+
+    juce::var get(const juce::Identifier& key, const juce::var& fallback = {}) const;
+    void set(const juce::Identifier& key, const juce::var& value);
+
+    void load();
+    void migrateLegacyFiles();
+    void run() override;
+    void writeIfDirty();
+
+    juce::File file;
+    mutable juce::CriticalSection lock;
+    juce::NamedValueSet values;
+    bool dirty = false;
+    juce::uint32 lastChangeMs = 0;
+    juce::CriticalSection writeLock;    // 저장 스레드와 flush()가 동시에 쓰지 않도록
+};
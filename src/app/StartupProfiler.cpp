@@ -0,0 +1,58 @@
+#include "StartupProfiler.h"
+#include "AsyncLogger.h"
+
+StartupProfiler::StartupProfiler()
+    : startMs(juce::Time::getMillisecondCounterHiRes()) {}
+
+double StartupProfiler::getElapsedMs() const {
+    return juce::Time::getMillisecondCounterHiRes() - startMs;
+}
+
+void StartupProfiler::addPhase(const juce::String& name, double durationMs) {
+    phases.add({ name, durationMs });
+}
+
+void StartupProfiler::markMilestone(const juce::String& name) {
+    if (hasMilestone(name)) return;
+    milestones.add({ name, getElapsedMs() });
+}
+
+bool StartupProfiler::hasMilestone(const juce::String& name) const {
+    for (auto& m : milestones) {
+        if (m.name == name) return true;
+    }
+    return false;
+}
+
+void StartupProfiler::setPendingTasks(int numTasks) {
+    pendingTasks = numTasks;
+}
+
+void StartupProfiler::taskFinished() {
+    if (summaryLogged || pendingTasks <= 0) return;
+
+    if (--pendingTasks == 0) {
+        logSummary();
+    }
+}
+
+void StartupProfiler::logSummary() {
+    summaryLogged = true;
+
+    // 예: Startup: ui=8.1ms audio=42.0ms plugin=231.5ms | firstPaint@61.2ms ready@274.9ms
+    juce::String line = "Startup:";
+    for (auto& p : phases) {
+        line << " " << p.name << "=" << juce::String(p.ms, 1) << "ms";
+    }
+
+    line << " |";
+    for (auto& m : milestones) {
+        line << " " << m.name << "@" << juce::String(m.ms, 1) << "ms";
+        if (m.name == "firstPaint" && firstPaintBudgetMs > 0.0 && m.ms > firstPaintBudgetMs) {
+            line << " (over " << juce::String(firstPaintBudgetMs, 0) << "ms budget)";
+        }
+    }
+    line << " ready@" << juce::String(getElapsedMs(), 1) << "ms";
+
+    CLR_LOG_INFO(line);
+}
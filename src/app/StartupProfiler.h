@@ -0,0 +1,52 @@
+#pragma once
+#include <JuceHeader.h>
+
+// 앱 시작 단계별 소요 시간을 모아 한 줄 로그로 남기는 계측기
+// - 모든 함수는 메시지 스레드에서만 호출 (백그라운드 작업은 측정값을 callAsync로 전달)
+// - 비동기 작업(플러그인 로드, 자동 설정, 첫 페인트)이 모두 끝나면 요약을 한 번만 기록
+class StartupProfiler {
+public:
+    StartupProfiler();
+
+    // 생성 시점부터 경과 시간 (ms)
+    double getElapsedMs() const;
+
+    // 단계 소요 시간 기록 (동기 단계는 ScopedPhase, 백그라운드 단계는 측정값 직접 전달)
+    void addPhase(const juce::String& name, double durationMs);
+
+    // 특정 시점 기록 (예: firstPaint) - 같은 이름은 처음 한 번만 기록
+    void markMilestone(const juce::String& name);
+    bool hasMilestone(const juce::String& name) const;
+
+    // 완료를 기다릴 비동기 작업 수 설정 / 작업 하나 완료 (0이 되면 요약 로그)
+    void setPendingTasks(int numTasks);
+    void taskFinished();
+
+    // 첫 페인트 목표 시간 (ms) - 초과 시 요약 로그에 표시
+    void setFirstPaintBudgetMs(double budgetMs) { firstPaintBudgetMs = budgetMs; }
+
+    struct ScopedPhase {
+        ScopedPhase(StartupProfiler& p, const juce::String& phaseName)
+            : profiler(p), name(phaseName), startMs(juce::Time::getMillisecondCounterHiRes()) {}
+        ~ScopedPhase() { profiler.addPhase(name, juce::Time::getMillisecondCounterHiRes() - startMs); }
+
+        StartupProfiler& profiler;
+        juce::String name;
+        double startMs;
+    };
+
+private:
+    void logSummary();
+
+    struct Entry {
+        juce::String name;
+        double ms;
+    };
+
+    double startMs;
+    double firstPaintBudgetMs = 0.0;
+    int pendingTasks = 0;
+    bool summaryLogged = false;
+    juce::Array<Entry> phases;
+    juce::Array<Entry> milestones;
+};
@@ -0,0 +1,96 @@
+#include "AudioCallbackMeter.h"
+
+void AudioCallbackMeter::prepare(double sampleRate, int blockSize) {
+    currentSampleRate.store(sampleRate, std::memory_order_relaxed);
+    currentBlockSize.store(blockSize, std::memory_order_relaxed);
+
+    // 장치 재시작 사이의 공백을 xrun으로 세지 않도록 다음 콜백의 간격 측정은 건너뜀
+    restartPending.store(true, std::memory_order_release);
+}
+
+juce::int64 AudioCallbackMeter::callbackStarted(int numSamples) noexcept {
+    const auto now = juce::Time::getHighResolutionTicks();
+    const double sampleRate = currentSampleRate.load(std::memory_order_relaxed);
+
+    if (restartPending.exchange(false, std::memory_order_acq_rel) || lastStartTicks == 0 || sampleRate <= 0.0) {
+        lastStartTicks = now;
+        return now;
+    }
+
+    const double intervalMs = ticksToMs(now - lastStartTicks);
+    const double expectedMs = 1000.0 * numSamples / sampleRate;
+    lastStartTicks = now;
+
+    jitterHistogram.add(std::abs(intervalMs - expectedMs));
+
+    if (intervalMs > expectedMs * XRUN_GAP_FACTOR) {
+        xruns.store(xruns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    return now;
+}
+
+void AudioCallbackMeter::callbackFinished(juce::int64 startTicks, int numSamples) noexcept {
+    const double sampleRate = currentSampleRate.load(std::memory_order_relaxed);
+    if (sampleRate <= 0.0 || numSamples <= 0) return;
+
+    const double processMs = ticksToMs(juce::Time::getHighResolutionTicks() - startTicks);
+    const double bufferMs = 1000.0 * numSamples / sampleRate;
+    const double loadPercent = 100.0 * processMs / bufferMs;
+
+    loadHistogram.add(loadPercent);
+
+    if (processMs > bufferMs) {
+        overruns.store(overruns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+}
+
+AudioCallbackMeter::Snapshot AudioCallbackMeter::getSnapshot() const {
+    Snapshot s;
+    s.loadP50 = loadHistogram.getPercentile(0.50);
+    s.loadP99 = loadHistogram.getPercentile(0.99);
+    s.loadMax = loadHistogram.getMax();
+    s.jitterP50 = jitterHistogram.getPercentile(0.50);
+    s.jitterP99 = jitterHistogram.getPercentile(0.99);
+    s.jitterMax = jitterHistogram.getMax();
+    s.callbacks = loadHistogram.getCount();
+    s.overruns = overruns.load(std::memory_order_relaxed);
+    s.xruns = xruns.load(std::memory_order_relaxed);
+    s.sampleRate = currentSampleRate.load(std::memory_order_relaxed);
+    s.blockSize = currentBlockSize.load(std::memory_order_relaxed);
+    return s;
+}
+
+bool AudioCallbackMeter::writeCsv(const juce::File& file) const {
+    const auto s = getSnapshot();
+    if (s.callbacks == 0) return false;
+
+    juce::String csv;
+    csv << "metric,value\n"
+        << "sample_rate," << s.sampleRate << "\n"
+        << "block_size," << s.blockSize << "\n"
+        << "callbacks," << (juce::int64)s.callbacks << "\n"
+        << "overruns," << (juce::int64)s.overruns << "\n"
+        << "xruns," << (juce::int64)s.xruns << "\n"
+        << "load_p50_percent," << s.loadP50 << "\n"
+        << "load_p99_percent," << s.loadP99 << "\n"
+        << "load_max_percent," << s.loadMax << "\n"
+        << "jitter_p50_ms," << s.jitterP50 << "\n"
+        << "jitter_p99_ms," << s.jitterP99 << "\n"
+        << "jitter_max_ms," << s.jitterMax << "\n"
+        << "\n"
+        << "histogram,bin_upper,count\n";
+
+    for (int i = 0; i < loadHistogram.getNumBins(); ++i) {
+        if (auto count = loadHistogram.getBinCount(i)) {
+            csv << "load_percent," << (i + 1) * loadHistogram.getBinWidth() << "," << (int)count << "\n";
+        }
+    }
+    for (int i = 0; i < jitterHistogram.getNumBins(); ++i) {
+        if (auto count = jitterHistogram.getBinCount(i)) {
+            csv << "jitter_ms," << (i + 1) * jitterHistogram.getBinWidth() << "," << (int)count << "\n";
+        }
+    }
+
+    file.getParentDirectory().createDirectory();
+    return file.replaceWithText(csv);
+}
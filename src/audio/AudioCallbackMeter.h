@@ -0,0 +1,100 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+
+// 단일 writer(오디오 스레드) / 다중 reader(UI, 종료 시 CSV) 히스토그램
+// - 쓰기는 relaxed load/store 한 번 (RMW 없음), 읽기는 스냅샷으로 백분위 계산
+template <int NumBins>
+class LockFreeHistogram {
+public:
+    explicit LockFreeHistogram(double binWidthToUse) : binWidth(binWidthToUse) {}
+
+    // 오디오 스레드 전용
+    void add(double value) noexcept {
+        auto bin = static_cast<int>(value / binWidth);
+        auto& counter = counts[(size_t)juce::jlimit(0, NumBins - 1, bin)];
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        total.store(total.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        if (value > maxValue.load(std::memory_order_relaxed)) {
+            maxValue.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    // 0~1 사이 백분위에 해당하는 구간의 상한값 (마지막 구간은 "이상"을 의미)
+    double getPercentile(double fraction) const noexcept {
+        const auto n = total.load(std::memory_order_relaxed);
+        if (n == 0) return 0.0;
+
+        const auto threshold = static_cast<juce::uint64>(std::ceil(fraction * (double)n));
+        juce::uint64 running = 0;
+        for (int i = 0; i < NumBins; ++i) {
+            running += counts[(size_t)i].load(std::memory_order_relaxed);
+            if (running >= threshold) return (i + 1) * binWidth;
+        }
+        return NumBins * binWidth;
+    }
+
+    double getMax() const noexcept { return maxValue.load(std::memory_order_relaxed); }
+    juce::uint64 getCount() const noexcept { return total.load(std::memory_order_relaxed); }
+    juce::uint32 getBinCount(int bin) const noexcept { return counts[(size_t)bin].load(std::memory_order_relaxed); }
+    double getBinWidth() const noexcept { return binWidth; }
+    static constexpr int getNumBins() noexcept { return NumBins; }
+
+private:
+    const double binWidth;
+    std::array<std::atomic<juce::uint32>, NumBins> counts {};
+    std::atomic<juce::uint64> total { 0 };
+    std::atomic<double> maxValue { 0.0 };
+};
+
+// 오디오 콜백 계측: 처리 시간 대비 버퍼 길이(부하), 콜백 간격 지터, 오버런, xrun(콜백 누락) 감지
+// - callbackStarted/callbackFinished는 오디오 스레드에서 할당/락 없이 호출
+// - getSnapshot/writeCsv는 UI 스레드에서 호출
+class AudioCallbackMeter {
+public:
+    struct Snapshot {
+        double loadP50 = 0.0, loadP99 = 0.0, loadMax = 0.0;          // % (처리 시간 / 버퍼 길이)
+        double jitterP50 = 0.0, jitterP99 = 0.0, jitterMax = 0.0;    // ms (콜백 간격 - 버퍼 길이)
+        juce::uint64 callbacks = 0;
+        juce::uint64 overruns = 0;     // 처리 시간이 버퍼 길이를 넘은 콜백 수
+        juce::uint64 xruns = 0;        // 콜백 간격이 크게 벌어진 횟수 (드롭아웃 의심)
+        double sampleRate = 0.0;
+        int blockSize = 0;
+    };
+
+    // prepareToPlay에서 호출 (오디오 콜백이 멈춘 상태). 누적 통계는 유지
+    void prepare(double sampleRate, int blockSize);
+
+    // 오디오 스레드: 콜백 시작 시각을 반환하고 이전 콜백과의 간격을 기록
+    juce::int64 callbackStarted(int numSamples) noexcept;
+
+    // 오디오 스레드: 처리 시간을 기록
+    void callbackFinished(juce::int64 startTicks, int numSamples) noexcept;
+
+    Snapshot getSnapshot() const;
+
+    // 요약과 히스토그램을 CSV로 기록
+    bool writeCsv(const juce::File& file) const;
+
+    // 콜백 간격이 버퍼 길이의 이 배수를 넘으면 xrun으로 판단
+    static constexpr double XRUN_GAP_FACTOR = 1.5;
+
+private:
+    double ticksToMs(juce::int64 ticks) const noexcept { return (double)ticks * msPerTick; }
+
+    const double msPerTick = 1000.0 / (double)juce::Time::getHighResolutionTicksPerSecond();
+
+    std::atomic<double> currentSampleRate { 0.0 };
+    std::atomic<int> currentBlockSize { 0 };
+    std::atomic<bool> restartPending { true };
+
+    // 오디오 스레드 전용
+    juce::int64 lastStartTicks = 0;
+
+    LockFreeHistogram<400> loadHistogram { 0.5 };     // 0~200 %, 0.5 % 간격
+    LockFreeHistogram<400> jitterHistogram { 0.05 };  // 0~20 ms, 0.05 ms 간격
+    std::atomic<juce::uint64> overruns { 0 };
+    std::atomic<juce::uint64> xruns { 0 };
+};
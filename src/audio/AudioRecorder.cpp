@@ -0,0 +1,511 @@
+#include "AudioRecorder.h"
+#include "../app/AsyncLogger.h"
+
+namespace {
+    // 이 프로세스가 녹음 중인 임시 파일 목록
+    // POSIX의 InterProcessLock은 프로세스 단위라 같은 프로세스의 복구 과정도 락을 다시 잡을 수 있으므로 따로 기록
+    struct ActiveTempFiles {
+        juce::CriticalSection lock;
+        juce::Array<juce::File> files;
+    };
+
+    ActiveTempFiles& getActiveTempFiles() {
+        static ActiveTempFiles active;
+        return active;
+    }
+
+    void setTempFileActive(const juce::File& file, bool isActive) {
+        auto& active = getActiveTempFiles();
+        const juce::ScopedLock sl(active.lock);
+        if (isActive) active.files.addIfNotAlreadyThere(file);
+        else active.files.removeFirstMatchingValue(file);
+    }
+}
+
+//==============================================================================
+void RecordingRingBuffer::prepare(int numChannels, int capacityInSamples) {
+    // AbstractFifo는 (전체 크기 - 1)까지만 채울 수 있으므로 1 샘플 여유
+    storage.setSize(numChannels, capacityInSamples + 1, false, true, false);
+    fifo.setTotalSize(capacityInSamples + 1);
+    fifo.reset();
+}
+
+void RecordingRingBuffer::reset() {
+    fifo.reset();
+}
+
+int RecordingRingBuffer::push(const float* const* channelData, int numSourceChannels, int numSamples) {
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+
+    for (int ch = 0; ch < storage.getNumChannels(); ++ch) {
+        float* dest = storage.getWritePointer(ch);
+        const float* src = (channelData != nullptr && ch < numSourceChannels) ? channelData[ch] : nullptr;
+
+        if (src != nullptr) {
+            if (size1 > 0) juce::FloatVectorOperations::copy(dest + start1, src, size1);
+            if (size2 > 0) juce::FloatVectorOperations::copy(dest + start2, src + size1, size2);
+        } else {
+            // 소스 채널이 부족하면 무음으로 채움
+            if (size1 > 0) juce::FloatVectorOperations::clear(dest + start1, size1);
+            if (size2 > 0) juce::FloatVectorOperations::clear(dest + start2, size2);
+        }
+    }
+
+    fifo.finishedWrite(size1 + size2);
+    return numSamples - (size1 + size2);
+}
+
+int RecordingRingBuffer::pop(juce::AudioBuffer<float>& dest, int maxSamples) {
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(juce::jmin(maxSamples, dest.getNumSamples()), start1, size1, start2, size2);
+
+    for (int ch = 0; ch < juce::jmin(dest.getNumChannels(), storage.getNumChannels()); ++ch) {
+        if (size1 > 0) dest.copyFrom(ch, 0, storage, ch, start1, size1);
+        if (size2 > 0) dest.copyFrom(ch, size1, storage, ch, start2, size2);
+    }
+
+    fifo.finishedRead(size1 + size2);
+    return size1 + size2;
+}
+
+//==============================================================================
+AudioRecorder::AudioRecorder(int actualSampleRate, double retroactiveSecondsToKeep)
+    : juce::Thread("ClearHost Recorder"), sampleRate(actualSampleRate), numChannels(2),
+      retroactiveSeconds(juce::jmax(0.0, retroactiveSecondsToKeep)) {
+    // 지난 N초 링은 시작 시 한 번만 할당 (덮어쓰기 여유분 포함)
+    if (retroactiveSeconds > 0.0) {
+        const double rate = juce::jmax((double)actualSampleRate, RETROACTIVE_MAX_SAMPLE_RATE);
+        const int capacity = (int)(retroactiveSeconds * rate) + RetroactiveCaptureBuffer::WRITE_GUARD_FRAMES + WRITE_CHUNK_FRAMES;
+        retroactiveCapture.allocate(numChannels, capacity, RetroactiveCaptureBuffer::Storage::int16);
+    }
+
+    // 변환 커널 선택(정적 초기화)이 오디오 스레드의 첫 콜백에서 일어나지 않도록 미리 수행
+    CLR_LOG_INFO("Sample conversion kernel: " + juce::String(SampleConversion::getInt16KernelName()));
+}
+
+AudioRecorder::~AudioRecorder() {
+    if (isRecordingActive()) {
+        stopRecording();
+    }
+    stopThread(2000);
+    retroactiveSaver.removeAllJobs(false, 10000);
+}
+
+void AudioRecorder::prepare(double newSampleRate, int) {
+    // 녹음 중 샘플레이트를 바꾸면 파일 헤더와 데이터가 어긋나므로 무시
+    if (isRecordingActive()) {
+        CLR_LOG_WARNING("AudioRecorder: sample rate change ignored while recording");
+        return;
+    }
+    sampleRate = static_cast<int>(newSampleRate);
+    retroactiveCapture.reset(newSampleRate);
+}
+
+void AudioRecorder::setFormat(RecordingFormat newFormat) {
+    if (isRecordingActive()) {
+        CLR_LOG_WARNING("AudioRecorder: format change ignored while recording");
+        return;
+    }
+    format = newFormat;
+    CLR_LOG_INFO("Recording format: " + RecordingEncoder::getFormatName(format));
+}
+
+void AudioRecorder::setDirectories(const juce::File& newTempDirectory, const juce::File& newOutputDirectory) {
+    if (isRecordingActive()) {
+        CLR_LOG_WARNING("AudioRecorder: directory change ignored while recording");
+        return;
+    }
+    tempDirectory = newTempDirectory;
+    outputDirectory = newOutputDirectory;
+}
+
+void AudioRecorder::setCaptureDryInput(bool shouldCapture) {
+    if (isRecordingActive()) {
+        CLR_LOG_WARNING("AudioRecorder: dry input setting ignored while recording");
+        return;
+    }
+    captureDryInput = shouldCapture;
+}
+
+void AudioRecorder::startRecording() {
+    if (isRecordingActive()) return;
+
+    // 현재 시간으로 파일명 생성
+    filename = generateFilename();
+    CLR_LOG_INFO("Starting recording to: " + filename + " with sample rate: " + juce::String(sampleRate)
+                 + " (" + RecordingEncoder::getFormatName(format) + ", " + SampleConversion::getInt16KernelName() + " kernel)");
+
+    // 세션마다 고유한 임시 파일 (동시에 실행된 인스턴스끼리 덮어쓰지 않음)
+    tempDirectory.createDirectory();
+    const auto tempName = "clr_rec_" + juce::Time::getCurrentTime().formatted("%Y%m%d%H%M%S") + "_"
+                          + juce::Uuid().toString().substring(0, 8);
+    const auto extension = RecordingEncoder::getFileExtension(format);
+    tempFile = tempDirectory.getChildFile(tempName + extension);
+
+    if (!openTempFile(tempFile, tempFileLock, encoder)) {
+        CLR_LOG_ERROR("Failed to open recording file");
+        return;
+    }
+
+    // 처리 전 입력은 같은 포맷의 두 번째 파일로 (복구 과정은 clr_rec_* 파일을 모두 같은 방식으로 처리)
+    if (captureDryInput) {
+        dryTempFile = tempDirectory.getChildFile(tempName + "_dry" + extension);
+        if (!openTempFile(dryTempFile, dryTempFileLock, dryEncoder)) {
+            CLR_LOG_ERROR("Failed to open dry input recording file - recording processed output only");
+        }
+    }
+
+    // 모든 버퍼는 오디오 스레드가 링 버퍼를 보기 전에 여기서 미리 할당
+    ringBuffer.prepare(numChannels, static_cast<int>(sampleRate * RING_BUFFER_SECONDS));
+    writeScratch.setSize(numChannels, WRITE_CHUNK_FRAMES);
+    if (dryEncoder) {
+        dryRingBuffer.prepare(numChannels, static_cast<int>(sampleRate * RING_BUFFER_SECONDS));
+        dryWriteScratch.setSize(numChannels, WRITE_CHUNK_FRAMES);
+    }
+
+    totalSamples = 0;
+    flushCounter = 0;
+    liveStartPosition.store(-1, std::memory_order_relaxed);
+    lastCommitMs = juce::Time::getMillisecondCounter();
+    prerollPending = prependRetroactive && getRetroactiveSeconds() > 0.0;
+    droppedSamples.store(0, std::memory_order_relaxed);
+    overflowEvents.store(0, std::memory_order_relaxed);
+
+    startThread();
+    dryCaptureActive.store(dryEncoder != nullptr, std::memory_order_release);
+    isRecording.store(true, std::memory_order_release);
+}
+
+bool AudioRecorder::openTempFile(const juce::File& file, std::unique_ptr<juce::InterProcessLock>& lock,
+                                 std::unique_ptr<RecordingEncoder>& target) const {
+    // 녹음하는 동안 락을 잡아 두어 다른 인스턴스의 복구 과정이 이 파일을 건드리지 않게 함
+    lock = std::make_unique<juce::InterProcessLock>(getTempFileLockName(file));
+    if (!lock->enter(0)) {
+        CLR_LOG_ERROR("Recording temp file is locked by another process: " + file.getFileName());
+        lock.reset();
+        return false;
+    }
+
+    // 같은 프로세스의 복구 과정이 보지 않도록 파일을 만들기 전에 등록
+    setTempFileActive(file, true);
+
+    // 인코더 열기 (헤더는 여기서 기록, 이후 변환/쓰기는 쓰기 스레드에서만)
+    target = encoderFactory != nullptr ? encoderFactory(format) : RecordingEncoder::create(format);
+    if (!target->open(file, sampleRate, numChannels, WRITE_CHUNK_FRAMES)) {
+        target.reset();
+        setTempFileActive(file, false);
+        lock.reset();
+        return false;
+    }
+    return true;
+}
+
+juce::File AudioRecorder::finishTempFile(std::unique_ptr<RecordingEncoder>& target, const juce::File& file,
+                                         std::unique_ptr<juce::InterProcessLock>& lock, const juce::String& finalName) const {
+    // 헤더 크기 확정 후 파일 닫기
+    if (!target->finish()) {
+        CLR_LOG_ERROR("Failed to finalize recording header");
+    }
+    target.reset();
+
+    outputDirectory.createDirectory();
+    juce::File finalFile = outputDirectory.getChildFile(finalName);
+    if (file.moveFileTo(finalFile)) {
+        CLR_LOG_INFO("Recording saved to: " + finalFile.getFullPathName());
+    } else {
+        CLR_LOG_ERROR("Failed to save recording (kept at " + file.getFullPathName() + ")");
+        finalFile = juce::File();
+    }
+
+    // 이동에 실패했으면 임시 파일은 다음 실행의 복구 과정이 처리
+    setTempFileActive(file, false);
+    lock.reset();
+    return finalFile;
+}
+
+void AudioRecorder::stopRecording() {
+    if (!isRecordingActive()) return;
+
+    CLR_LOG_INFO("Stopping recording");
+
+    // 1. 오디오 스레드가 더 이상 링 버퍼에 쓰지 않도록 막고, 진행 중인 콜백이 끝날 때까지 대기
+    //    (각자 자기 플래그를 쓰고 상대 플래그를 읽는 Dekker 방식이므로 네 연산 모두 seq_cst -
+    //     release/acquire로는 store 뒤의 load가 앞당겨져 양쪽 모두 상대의 쓰기를 못 볼 수 있음)
+    isRecording.store(false, std::memory_order_seq_cst);
+    dryCaptureActive.store(false, std::memory_order_release);
+    while (activeCallbacks.load(std::memory_order_seq_cst) > 0) {
+        juce::Thread::yield();
+    }
+
+    // 2. 쓰기 스레드 종료 - run() 마지막에 링 버퍼에 남은 샘플을 모두 기록함
+    signalThreadShouldExit();
+    notify();
+    stopThread(5000);
+
+    if (getOverflowCount() > 0) {
+        CLR_LOG_EVENT(LogLevel::warning, LogCode::recorderOverflow, (double)getOverflowCount(), (double)getDroppedSampleCount());
+    }
+
+    // 최종 파일로 이동 (dry 파일은 "<이름>_dry"로 나란히)
+    if (dryEncoder) {
+        const juce::File named(filename);
+        finishTempFile(dryEncoder, dryTempFile, dryTempFileLock,
+                       named.getFileNameWithoutExtension() + "_dry" + named.getFileExtension());
+    }
+
+    if (encoder) {
+        const auto finalFile = finishTempFile(encoder, tempFile, tempFileLock, filename);
+        if (finalFile != juce::File() && onRecordingSaved != nullptr) onRecordingSaved(finalFile);
+    }
+}
+
+void AudioRecorder::processAudioData(const float* const* inputChannelData, int numInputChannels,
+                                     const float* const* outputChannelData, int numOutputChannels,
+                                     int numSamples) {
+    // stopRecording이 진행 중인 콜백을 기다릴 수 있도록 먼저 카운트
+    activeCallbacks.fetch_add(1, std::memory_order_seq_cst);
+
+    const auto blockPosition = retroactiveCapture.getWritePosition();
+    retroactiveCapture.push(outputChannelData, numOutputChannels, numSamples);
+
+    if (isRecording.load(std::memory_order_seq_cst)) {
+        // 녹음 링의 첫 블록이 캡처 링의 어디에 해당하는지 기록 (앞부분과 샘플 단위로 이어 붙이기 위함)
+        if (liveStartPosition.load(std::memory_order_relaxed) < 0) {
+            liveStartPosition.store(blockPosition, std::memory_order_release);
+        }
+
+        int dropped = 0;
+        if (dryCaptureActive.load(std::memory_order_relaxed)) {
+            // 한쪽 링에만 들어가면 두 파일이 어긋나므로 양쪽 모두 공간이 있을 때만 기록하고, 아니면 블록 전체를 버림
+            if (juce::jmin(ringBuffer.getFreeSpace(), dryRingBuffer.getFreeSpace()) >= numSamples) {
+                ringBuffer.push(outputChannelData, numOutputChannels, numSamples);
+                dryRingBuffer.push(inputChannelData, inputChannelData != nullptr ? numInputChannels : 0, numSamples);
+            } else {
+                dropped = numSamples;
+            }
+        } else {
+            dropped = ringBuffer.push(outputChannelData, numOutputChannels, numSamples);
+        }
+
+        if (dropped > 0) {
+            droppedSamples.fetch_add(static_cast<juce::uint64>(dropped), std::memory_order_relaxed);
+            overflowEvents.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    activeCallbacks.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void AudioRecorder::run() {
+    while (!threadShouldExit()) {
+        // 지난 N초를 먼저 기록한 뒤에 녹음 링을 비움 (그동안 녹음 링이 실시간 데이터를 받아 둠)
+        if (prerollPending) writeRetroactivePreroll(false);
+        if (!prerollPending) drainRingBuffer(false);
+        wait(WRITER_POLL_MS);
+    }
+
+    // 종료 시 남은 데이터 모두 기록
+    if (prerollPending) writeRetroactivePreroll(true);
+    drainRingBuffer(true);
+}
+
+void AudioRecorder::writeRetroactivePreroll(bool finalPass) {
+    auto end = liveStartPosition.load(std::memory_order_acquire);
+    if (end < 0) {
+        // 녹음 중 콜백이 아직 한 번도 오지 않음
+        if (!finalPass) return;
+        end = retroactiveCapture.getWritePosition();
+    }
+    prerollPending = false;
+
+    if (!encoder) return;
+
+    const auto start = juce::jmax((juce::int64)0, end - (juce::int64)(getRetroactiveSeconds() * sampleRate));
+    const auto written = writeRetroactiveRange(retroactiveCapture, start, end, *encoder, writeScratch);
+    totalSamples += written;
+
+    // 지난 N초 링에는 처리된 출력만 있으므로 dry 파일은 같은 길이의 무음으로 맞춤
+    if (dryEncoder) writeDrySilence(written);
+
+    CLR_LOG_INFO("Prepended " + juce::String((double)written / sampleRate, 1) + " s of retroactive capture");
+}
+
+void AudioRecorder::writeDrySilence(juce::int64 numFrames) {
+    dryWriteScratch.clear();
+    while (numFrames > 0) {
+        const int n = (int)juce::jmin<juce::int64>(dryWriteScratch.getNumSamples(), numFrames);
+        if (!dryEncoder->write(dryWriteScratch, n)) {
+            CLR_LOG_EVENT(LogLevel::error, LogCode::recorderDryWriteFailed);
+            return;
+        }
+        numFrames -= n;
+    }
+}
+
+juce::int64 AudioRecorder::writeRetroactiveRange(const RetroactiveCaptureBuffer& capture, juce::int64 start, juce::int64 end,
+                                                 RecordingEncoder& target, juce::AudioBuffer<float>& scratch) {
+    juce::int64 written = 0;
+    auto position = juce::jmax(start, capture.getOldestReadablePosition());
+
+    while (position < end) {
+        const int n = (int)juce::jmin<juce::int64>(scratch.getNumSamples(), end - position);
+        if (!capture.read(position, scratch, n)) {
+            // 읽는 사이 덮어쓰인 앞부분은 버리고 아직 남아 있는 위치부터 이어감
+            const auto oldest = capture.getOldestReadablePosition();
+            if (oldest <= position) break;
+            position = oldest;
+            continue;
+        }
+        if (!target.write(scratch, n)) break;
+        written += n;
+        position += n;
+    }
+    return written;
+}
+
+double AudioRecorder::getRetroactiveSeconds() const {
+    const double rate = retroactiveCapture.getSampleRate();
+    if (!retroactiveCapture.isAllocated() || rate <= 0.0) return 0.0;
+
+    const int usableFrames = retroactiveCapture.getCapacity() - RetroactiveCaptureBuffer::WRITE_GUARD_FRAMES - WRITE_CHUNK_FRAMES;
+    return juce::jmin(retroactiveSeconds, usableFrames / rate);
+}
+
+void AudioRecorder::saveRetroactiveCapture() {
+    const double seconds = getRetroactiveSeconds();
+    if (seconds <= 0.0) {
+        CLR_LOG_WARNING("Retroactive capture is not available");
+        return;
+    }
+
+    // 누른 순간까지의 구간을 스냅샷으로 잡고 변환/쓰기는 백그라운드에서
+    const double rate = retroactiveCapture.getSampleRate();
+    const auto end = retroactiveCapture.getWritePosition();
+    const auto start = juce::jmax((juce::int64)0, end - (juce::int64)(seconds * rate));
+    const auto saveFormat = format;
+    const auto file = outputDirectory.getChildFile("clr_last" + juce::String(juce::roundToInt(seconds)) + "s_"
+                                        + juce::Time::getCurrentTime().formatted("%Y%m%d%H%M%S")
+                                        + RecordingEncoder::getFileExtension(saveFormat));
+
+    retroactiveSaver.addJob([this, start, end, rate, saveFormat, file] {
+        auto target = RecordingEncoder::create(saveFormat);
+        if (!target->open(file, rate, numChannels, WRITE_CHUNK_FRAMES)) {
+            CLR_LOG_ERROR("Failed to open " + file.getFullPathName());
+            return;
+        }
+
+        juce::AudioBuffer<float> scratch(numChannels, WRITE_CHUNK_FRAMES);
+        const auto written = writeRetroactiveRange(retroactiveCapture, start, end, *target, scratch);
+        target->finish();
+
+        CLR_LOG_INFO("Saved last " + juce::String((double)written / rate, 1) + " s to: " + file.getFullPathName());
+        juce::MessageManager::callAsync([file] { file.revealToUser(); });
+    });
+}
+
+void AudioRecorder::drainRingBuffer(bool drainAll) {
+    // 두 링 모두에 들어온 만큼만 꺼내서 같은 길이로 기록 (오디오 스레드는 출력 → 입력 순서로 push)
+    auto numReady = [this] {
+        return dryEncoder ? juce::jmin(ringBuffer.getNumReady(), dryRingBuffer.getNumReady()) : ringBuffer.getNumReady();
+    };
+
+    // 평소에는 큰 덩어리가 모였을 때만 쓰고, 종료 시에는 남은 샘플을 전부 기록
+    for (int ready = numReady(); ready >= (drainAll ? 1 : WRITE_CHUNK_FRAMES / 2); ready = numReady()) {
+        int numRead = ringBuffer.pop(writeScratch, juce::jmin(ready, WRITE_CHUNK_FRAMES));
+        if (numRead <= 0) break;
+        if (dryEncoder) dryRingBuffer.pop(dryWriteScratch, numRead);
+        writeSamples(numRead);
+    }
+}
+
+void AudioRecorder::writeSamples(int numSamples) {
+    if (!encoder) return;
+
+    // 포맷 변환/인터리브는 인코더가 쓰기 스레드에서 수행
+    if (!encoder->write(writeScratch, numSamples)) {
+        CLR_LOG_EVENT(LogLevel::error, LogCode::recorderWriteFailed);
+        return;
+    }
+    if (dryEncoder && !dryEncoder->write(dryWriteScratch, numSamples)) {
+        CLR_LOG_EVENT(LogLevel::error, LogCode::recorderDryWriteFailed);
+    }
+    totalSamples += numSamples;
+    flushCounter++;
+
+    // 주기적으로 헤더 크기만 제자리에 갱신 - 강제 종료되어도 이 시점까지는 정상 파일
+    const auto nowMs = juce::Time::getMillisecondCounter();
+    if (nowMs - lastCommitMs >= (juce::uint32)HEADER_COMMIT_INTERVAL_MS) {
+        lastCommitMs = nowMs;
+        if (!encoder->commit() || (dryEncoder && !dryEncoder->commit())) {
+            CLR_LOG_EVENT(LogLevel::error, LogCode::recorderHeaderCommitFailed);
+        }
+    }
+
+    // 100번째 쓰기마다 로그 (문자열 조합 없이 숫자만 큐에 넣음)
+    if (flushCounter % 100 == 0) {
+        CLR_LOG_EVENT(LogLevel::debug, LogCode::recorderFlush, (double)flushCounter);
+    }
+}
+
+juce::File AudioRecorder::getDefaultTempDirectory() {
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+           .getChildFile("ClearHost")
+           .getChildFile("RecordingTemp");
+}
+
+juce::String AudioRecorder::getTempFileLockName(const juce::File& file) {
+    return "ClearHost_" + file.getFileNameWithoutExtension();
+}
+
+void AudioRecorder::recoverOrphanedRecordingsAsync() {
+    retroactiveSaver.addJob([tempFolder = tempDirectory, outputFolder = outputDirectory] {
+        recoverOrphanedRecordings(tempFolder, outputFolder);
+    });
+}
+
+void AudioRecorder::recoverOrphanedRecordings(const juce::File& tempFolder, const juce::File& outputFolder) {
+    auto files = tempFolder.findChildFiles(juce::File::findFiles, false, "clr_rec_*");
+
+    // 파일 하나를 처리하는 동안 이 프로세스의 녹음 시작/종료를 막아 목록 확인과 처리 사이에 상태가 바뀌지 않게 함
+    auto& active = getActiveTempFiles();
+
+    for (auto& file : files) {
+        const juce::ScopedLock activeLock(active.lock);
+
+        // 이 프로세스가 녹음 중인 파일이거나 그 사이 저장되어 옮겨진 파일
+        if (active.files.contains(file) || !file.existsAsFile()) continue;
+
+        // 락을 잡지 못하면 다른 인스턴스가 녹음 중인 파일
+        juce::InterProcessLock lock(getTempFileLockName(file));
+        if (!lock.enter(0)) continue;
+
+        juce::int64 frames = -1;
+        if (file.hasFileExtension(".wav")) {
+            frames = WavRecordingEncoder::repairFile(file);
+            if (frames == 0) {
+                CLR_LOG_INFO("Removing empty orphaned recording: " + file.getFileName());
+                file.deleteFile();
+                lock.exit();
+                continue;
+            }
+        }
+
+        // 헤더 복구 여부와 관계없이 데이터는 보존 (FLAC은 프레임 단위로 디코딩 가능)
+        auto recovered = outputFolder.getNonexistentChildFile("clr_recovered_" + file.getFileNameWithoutExtension().substring(8),
+                                                      file.getFileExtension(), false);
+        if (file.moveFileTo(recovered)) {
+            CLR_LOG_INFO("Recovered orphaned recording"
+                         + (frames > 0 ? " (" + juce::String(frames) + " frames)" : juce::String())
+                         + ": " + recovered.getFullPathName());
+        } else {
+            CLR_LOG_ERROR("Failed to recover orphaned recording: " + file.getFullPathName());
+        }
+        lock.exit();
+    }
+}
+
+juce::String AudioRecorder::generateFilename() const {
+    auto now = juce::Time::getCurrentTime();
+    return "clr_" + now.formatted("%Y%m%d%H%M%S") + RecordingEncoder::getFileExtension(format);
+}
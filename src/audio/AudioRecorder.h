@@ -0,0 +1,179 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <functional>
+#include "RecordingEncoder.h"
+#include "RetroactiveCapture.h"
+
+// 오디오 스레드 → 디스크 쓰기 스레드로 샘플을 넘기는 wait-free SPSC 링 버퍼
+// (producer: 오디오 콜백 1개, consumer: 쓰기 스레드 1개)
+class RecordingRingBuffer {
+public:
+    // 메시지 스레드에서만 호출 (할당 발생)
+    void prepare(int numChannels, int capacityInSamples);
+    void reset();
+
+    // 오디오 스레드: 채널별 memcpy만 수행. 공간이 부족하면 들어가지 못한 샘플 수를 반환
+    int push(const float* const* channelData, int numSourceChannels, int numSamples);
+
+    // 쓰기 스레드: dest에 최대 maxSamples 만큼 꺼내고 실제 꺼낸 샘플 수 반환
+    int pop(juce::AudioBuffer<float>& dest, int maxSamples);
+
+    int getNumReady() const { return fifo.getNumReady(); }
+    int getFreeSpace() const { return fifo.getFreeSpace(); }
+    int getNumChannels() const { return storage.getNumChannels(); }
+
+private:
+    juce::AbstractFifo fifo { 1 };
+    juce::AudioBuffer<float> storage;
+};
+
+// 녹음 엔진: 오디오 콜백은 링 버퍼에 복사만 하고, 변환/디스크 I/O는 전용 쓰기 스레드가 담당
+// - 파일 포맷은 RecordingEncoder로 교체 가능 (WAV 16/24비트, 32비트 float, RF64, FLAC)
+// - 녹음 여부와 관계없이 지난 N초를 메모리 링에 유지 → Rec 시 앞에 붙이거나 바로 파일로 저장
+// - 선택 시 플러그인 처리 전 입력을 "<이름>_dry" 파일로 함께 녹음 (두 파일은 같은 콜백의 같은 길이로 기록되므로
+//   샘플 단위로 맞추려면 호출하는 쪽이 dry 입력을 플러그인 지연만큼 늦춰서 넘겨야 함)
+class AudioRecorder : private juce::Thread {
+public:
+    // retroactiveSeconds: 항상 유지할 "지난 N초" 길이 (0이면 끔). 메모리는 여기서 한 번만 할당
+    explicit AudioRecorder(int actualSampleRate = 44100, double retroactiveSeconds = RETROACTIVE_SECONDS);
+    ~AudioRecorder() override;
+
+    // prepareToPlay에서 호출 - 녹음 중이 아닐 때만 샘플레이트 갱신
+    void prepare(double newSampleRate, int maxBlockSize);
+
+    void startRecording();
+    void stopRecording();
+
+    // 다음 녹음부터 적용 (녹음 중에는 무시)
+    void setFormat(RecordingFormat newFormat);
+    RecordingFormat getFormat() const { return format; }
+
+    // 인코더 생성 방식 교체 (테스트의 느린 싱크 등) - 비워 두면 RecordingEncoder::create, 다음 녹음부터 적용
+    using EncoderFactory = std::function<std::unique_ptr<RecordingEncoder>(RecordingFormat)>;
+    void setEncoderFactory(EncoderFactory factory) { encoderFactory = std::move(factory); }
+
+    bool isRecordingActive() const {
+        return isRecording.load(std::memory_order_acquire);
+    }
+
+    // Rec 시작 시 지난 N초를 파일 앞에 붙일지 (다음 녹음부터 적용)
+    void setPrependRetroactive(bool shouldPrepend) { prependRetroactive = shouldPrepend; }
+    bool isPrependRetroactiveEnabled() const { return prependRetroactive; }
+
+    // 처리 전 입력도 별도 파일로 녹음할지 (다음 녹음부터 적용, 녹음 중에는 무시)
+    void setCaptureDryInput(bool shouldCapture);
+    bool isCaptureDryInputEnabled() const { return captureDryInput; }
+
+    // 오디오 스레드: 이번 녹음이 입력을 받는지 - 아닐 때는 콜백에서 입력을 복사할 필요 없음
+    bool isCapturingDryInput() const { return dryCaptureActive.load(std::memory_order_acquire); }
+
+    // 지난 N초를 즉시 별도 파일로 저장 (스냅샷 위치만 잡고 쓰기는 백그라운드 스레드)
+    void saveRetroactiveCapture();
+
+    // 현재 샘플레이트에서 실제로 유지되는 길이 (초)
+    double getRetroactiveSeconds() const;
+
+    // 비정상 종료로 남은 임시 녹음 파일의 헤더를 복구해 출력 폴더로 옮김 (백그라운드 스레드)
+    // 다른 실행 중인 인스턴스가 쓰고 있는 파일(프로세스 간 락)과 이 프로세스가 녹음 중인 파일은 건드리지 않음
+    void recoverOrphanedRecordingsAsync();
+
+    // 녹음 중인 임시 파일 폴더와 완성된 녹음을 옮길 폴더 (녹음 중에는 무시)
+    // 기본값은 앱 데이터 폴더 / 데스크탑 - 테스트는 사용자 폴더를 건드리지 않도록 임시 폴더로 바꿈
+    void setDirectories(const juce::File& newTempDirectory, const juce::File& newOutputDirectory);
+    juce::File getTempDirectory() const { return tempDirectory; }
+    juce::File getOutputDirectory() const { return outputDirectory; }
+
+    // 재부팅 후에도 남도록 앱 데이터 폴더 사용
+    static juce::File getDefaultTempDirectory();
+
+    // 녹음을 출력 폴더로 옮긴 뒤 stopRecording을 호출한 스레드에서 호출 (앱은 폴더를 열어 보여 줌)
+    std::function<void(const juce::File&)> onRecordingSaved;
+
+    // 오디오 스레드에서 매 콜백 호출 - 지난 N초 링에는 항상, 녹음 링에는 녹음 중일 때만 복사 (할당/락/로그 없음)
+    // inputChannelData: 플러그인 지연만큼 늦춘 처리 전 입력 (dry 녹음 중이 아니거나 nullptr이면 무시/무음)
+    void processAudioData(const float* const* inputChannelData, int numInputChannels,
+                          const float* const* outputChannelData, int numOutputChannels,
+                          int numSamples);
+
+    // 오버플로 카운터 (링 버퍼가 가득 차서 버려진 샘플/콜백 수)
+    juce::uint64 getDroppedSampleCount() const { return droppedSamples.load(std::memory_order_relaxed); }
+    juce::uint64 getOverflowCount() const { return overflowEvents.load(std::memory_order_relaxed); }
+
+private:
+    void run() override;
+    void drainRingBuffer(bool drainAll);
+    void writeSamples(int numSamples);
+    void writeRetroactivePreroll(bool finalPass);
+    void writeDrySilence(juce::int64 numFrames);
+
+    // 임시 파일 락을 잡고 인코더를 엶 (락을 잡지 못하거나 열기 실패 시 false)
+    bool openTempFile(const juce::File& file, std::unique_ptr<juce::InterProcessLock>& lock,
+                      std::unique_ptr<RecordingEncoder>& target) const;
+    // 헤더를 확정하고 출력 폴더의 최종 파일로 옮김 (실패하면 임시 파일은 다음 실행의 복구 과정이 처리)
+    juce::File finishTempFile(std::unique_ptr<RecordingEncoder>& target, const juce::File& file,
+                              std::unique_ptr<juce::InterProcessLock>& lock, const juce::String& finalName) const;
+
+    // 캡처 링의 [start, end) 구간을 인코더로 기록하고 기록된 프레임 수 반환 (덮어쓴 앞부분은 건너뜀)
+    static juce::int64 writeRetroactiveRange(const RetroactiveCaptureBuffer& capture, juce::int64 start, juce::int64 end,
+                                             RecordingEncoder& target, juce::AudioBuffer<float>& scratch);
+
+    juce::String generateFilename() const;
+    static void recoverOrphanedRecordings(const juce::File& tempFolder, const juce::File& outputFolder);
+
+    // 임시 파일 이름 = "clr_rec_<시각>_<무작위>", 녹음 중에는 같은 이름의 프로세스 간 락을 잡고 있음
+    static juce::String getTempFileLockName(const juce::File& file);
+
+    // 링 버퍼 용량 (초) / 쓰기 스레드가 한 번에 꺼내는 최대 프레임 수
+    static constexpr double RING_BUFFER_SECONDS = 2.0;
+    static constexpr int WRITE_CHUNK_FRAMES = 8192;
+    // 쓰기 스레드 폴링 간격 (오디오 스레드에서 notify하지 않기 위해 폴링 방식 사용)
+    static constexpr int WRITER_POLL_MS = 5;
+    // 이 간격마다 헤더 크기를 갱신 (비정상 종료 시 잃는 길이의 상한)
+    static constexpr int HEADER_COMMIT_INTERVAL_MS = 1000;
+
+    // 지난 N초 기본값 / 메모리 크기를 정할 때 가정하는 최대 샘플레이트 (더 높으면 유지 시간이 줄어듦)
+    static constexpr double RETROACTIVE_SECONDS = 60.0;
+    static constexpr double RETROACTIVE_MAX_SAMPLE_RATE = 48000.0;
+
+    std::atomic<bool> isRecording { false };
+    std::atomic<int> activeCallbacks { 0 };
+    std::atomic<juce::uint64> droppedSamples { 0 };
+    std::atomic<juce::uint64> overflowEvents { 0 };
+
+    int sampleRate;
+    int numChannels;
+    RecordingFormat format = RecordingFormat::pcm16;
+    EncoderFactory encoderFactory;
+    std::unique_ptr<RecordingEncoder> encoder;
+    juce::String filename;
+    juce::File tempDirectory = getDefaultTempDirectory();
+    juce::File outputDirectory = juce::File::getSpecialLocation(juce::File::userDesktopDirectory);
+    juce::File tempFile;
+    std::unique_ptr<juce::InterProcessLock> tempFileLock;
+    juce::uint32 lastCommitMs = 0;
+
+    RecordingRingBuffer ringBuffer;
+
+    // 처리 전 입력 녹음 (처리된 출력과 같은 콜백에서 같은 길이로 기록)
+    bool captureDryInput = false;
+    std::atomic<bool> dryCaptureActive { false };
+    std::unique_ptr<RecordingEncoder> dryEncoder;
+    juce::File dryTempFile;
+    std::unique_ptr<juce::InterProcessLock> dryTempFileLock;
+    RecordingRingBuffer dryRingBuffer;
+
+    // 지난 N초 캡처 (오디오 스레드가 항상 기록)
+    RetroactiveCaptureBuffer retroactiveCapture;
+    const double retroactiveSeconds;
+    bool prependRetroactive = true;
+    bool prerollPending = false;                            // 쓰기 스레드가 아직 앞부분을 쓰지 않음
+    std::atomic<juce::int64> liveStartPosition { -1 };     // 녹음 링의 첫 샘플에 해당하는 캡처 링 위치
+    juce::ThreadPool retroactiveSaver { 1 };
+
+    // 쓰기 스레드 전용 스크래치 버퍼 (startRecording에서 미리 할당)
+    juce::AudioBuffer<float> writeScratch;
+    juce::AudioBuffer<float> dryWriteScratch;
+    juce::int64 totalSamples = 0;
+    int flushCounter = 0;
+};
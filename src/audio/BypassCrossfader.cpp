@@ -0,0 +1,72 @@
+#include "BypassCrossfader.h"
+
+void BypassCrossfader::prepare(double newSampleRate, int numChannels, int maxBlockSize, int latency) {
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+
+    dryBuffer.setSize(juce::jmax(1, numChannels), juce::jmax(1, maxBlockSize), false, true, false);
+    dryBuffer.clear();
+    dryDelay.prepare(dryBuffer.getNumChannels(), dryBuffer.getNumSamples(), latency);
+    dryLength = 0;
+
+    appliedFadeMs = fadeMs.load(std::memory_order_relaxed);
+    wetGain.reset(sampleRate, appliedFadeMs * 0.001);
+    wetGain.setCurrentAndTargetValue(isBypassed() ? 0.0f : 1.0f);
+}
+
+void BypassCrossfader::pushDry(const juce::AudioBuffer<float>& input, int startSample, int numSamples) noexcept {
+    // 블록이 dry 버퍼보다 길면 이번 블록은 dry 없이 wet 그대로
+    dryLength = 0;
+    if (numSamples > dryBuffer.getNumSamples()) return;
+
+    const int numInputChannels = input.getNumChannels();
+    for (int ch = 0; ch < dryBuffer.getNumChannels(); ++ch) {
+        if (numInputChannels == 0) {
+            dryBuffer.clear(ch, 0, numSamples);
+            continue;
+        }
+        // 모노 입력은 양쪽 채널에 복제
+        dryBuffer.copyFrom(ch, 0, input, juce::jmin(ch, numInputChannels - 1), startSample, numSamples);
+    }
+
+    // 블록 + 지연이 지연 라인 용량보다 길면 지연되지 않은 dry이므로 쓰지 않음
+    if (dryDelay.process(dryBuffer, numSamples)) dryLength = numSamples;
+}
+
+void BypassCrossfader::process(juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept {
+    // 페이드 길이 변경은 전환 중이 아닐 때만 반영 (reset은 현재 값을 목표로 맞춤)
+    const double requestedFadeMs = fadeMs.load(std::memory_order_relaxed);
+    if (requestedFadeMs != appliedFadeMs && !wetGain.isSmoothing()) {
+        appliedFadeMs = requestedFadeMs;
+        wetGain.reset(sampleRate, appliedFadeMs * 0.001);
+    }
+    wetGain.setTargetValue(isBypassed() ? 0.0f : 1.0f);
+
+    const bool fading = wetGain.isSmoothing();
+    if (!fading && wetGain.getCurrentValue() >= 0.5f) return;  // wet 그대로
+
+    if (dryLength != numSamples) {
+        if (fading) wetGain.skip(numSamples);
+        return;
+    }
+
+    const int numChannels = juce::jmin(buffer.getNumChannels(), dryBuffer.getNumChannels());
+    if (!fading) {
+        // bypass 유지 중: 지연된 dry로 교체
+        for (int ch = 0; ch < numChannels; ++ch) {
+            buffer.copyFrom(ch, startSample, dryBuffer, ch, 0, numSamples);
+        }
+        return;
+    }
+
+    // 전환 구간: 채널마다 같은 게인 곡선으로 dry ↔ wet
+    for (int ch = 0; ch < numChannels; ++ch) {
+        auto gain = wetGain;
+        auto* out = buffer.getWritePointer(ch, startSample);
+        const auto* dry = dryBuffer.getReadPointer(ch);
+        for (int i = 0; i < numSamples; ++i) {
+            const float g = gain.getNextValue();
+            out[i] = dry[i] + (out[i] - dry[i]) * g;
+        }
+    }
+    wetGain.skip(numSamples);
+}
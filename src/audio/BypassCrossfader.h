@@ -0,0 +1,45 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include "LatencyDelayLine.h"
+
+// 호스트 레벨 bypass - 플러그인에 bypass 파라미터가 없어도 동작
+// - 처리 전 입력(dry)을 복사해 LatencyDelayLine으로 플러그인 지연만큼 늦추고, 처리 후 wet과 크로스페이드
+//   → bypass를 켜고 꺼도 출력 타이밍이 같고 클릭이 없음
+// - bypass 전환은 atomic 플래그 하나 (파라미터 알림 없음), 페이드 길이는 다음 전환부터 적용
+// - 버퍼는 prepare에서만 할당, pushDry/process는 할당/락 없음
+class BypassCrossfader {
+public:
+    static constexpr double DEFAULT_FADE_MS = 10.0;
+
+    // 오디오 콜백이 이 객체를 쓰지 않는 동안 (prepareToPlay, 플러그인 교체 전)
+    void prepare(double sampleRate, int numChannels, int maxBlockSize, int latencySamples);
+
+    // 어느 스레드에서든 (오디오 스레드 포함) ---------------------------------
+    void setBypassed(bool shouldBypass) noexcept { bypassed.store(shouldBypass, std::memory_order_relaxed); }
+    bool isBypassed() const noexcept { return bypassed.load(std::memory_order_relaxed); }
+
+    void setFadeMs(double newFadeMs) noexcept { fadeMs.store(juce::jmax(0.0, newFadeMs), std::memory_order_relaxed); }
+
+    // 준비한 용량(LatencyDelayLine::MIN_LATENCY_CAPACITY 이상)을 넘으면 최대값으로 제한
+    void setLatencySamples(int newLatency) noexcept { dryDelay.setLatencySamples(newLatency); }
+
+    // 오디오 스레드 -------------------------------------------------------
+    // 플러그인 처리 직전: 입력을 복사해 지연 라인에 통과시킴
+    void pushDry(const juce::AudioBuffer<float>& input, int startSample, int numSamples) noexcept;
+
+    // 플러그인 처리 직후: bypass 상태에 따라 wet을 그대로 두거나, 지연된 dry로 바꾸거나, 둘을 크로스페이드
+    void process(juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept;
+
+private:
+    std::atomic<bool> bypassed { false };
+    std::atomic<double> fadeMs { DEFAULT_FADE_MS };
+    LatencyDelayLine dryDelay;
+
+    // 오디오 스레드 전용
+    juce::AudioBuffer<float> dryBuffer;     // 마지막 pushDry 블록에 맞춘 지연 dry
+    int dryLength = 0;                      // 0이면 이번 블록의 dry 없음 (용량 초과)
+    double sampleRate = 44100.0;
+    double appliedFadeMs = DEFAULT_FADE_MS;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> wetGain;
+};
@@ -0,0 +1,130 @@
+#include "DeviceTransitionScheduler.h"
+#include "../app/AsyncLogger.h"
+
+//==============================================================================
+void TransitionFader::prepare(double sampleRate) {
+    const double rampSamples = juce::jmax(1.0, sampleRate * FADE_MS / 1000.0);
+    gainStep = static_cast<float>(1.0 / rampSamples);
+    currentGain = 0.0f;
+    silent.store(targetGain.load(std::memory_order_acquire) == 0.0f, std::memory_order_release);
+}
+
+void TransitionFader::process(juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept {
+    const float target = targetGain.load(std::memory_order_acquire);
+
+    // 평상시(게인 1 유지)에는 아무것도 하지 않음
+    if (currentGain == target && target == 1.0f) return;
+
+    if (currentGain == target) {
+        // 게인 0 유지: 무음
+        buffer.clear(startSample, numSamples);
+        silent.store(true, std::memory_order_release);
+        return;
+    }
+
+    const float delta = gainStep * static_cast<float>(numSamples);
+    const float endGain = target > currentGain ? juce::jmin(target, currentGain + delta)
+                                               : juce::jmax(target, currentGain - delta);
+
+    buffer.applyGainRamp(startSample, numSamples, currentGain, endGain);
+    currentGain = endGain;
+    silent.store(currentGain == 0.0f, std::memory_order_release);
+}
+
+//==============================================================================
+DeviceTransitionScheduler::DeviceTransitionScheduler(juce::AudioDeviceManager& deviceManagerToUse, TransitionFader& faderToUse)
+    : deviceManager(deviceManagerToUse), fader(faderToUse) {}
+
+DeviceTransitionScheduler::~DeviceTransitionScheduler() {
+    stop();
+}
+
+void DeviceTransitionScheduler::requestInputDevice(const juce::String& deviceName) {
+    JUCE_ASSERT_MESSAGE_THREAD
+    pendingInput = deviceName;
+    hasPendingInput = true;
+    ++pendingCount;
+    scheduleTransition();
+}
+
+void DeviceTransitionScheduler::requestOutputDevice(const juce::String& deviceName) {
+    JUCE_ASSERT_MESSAGE_THREAD
+    pendingOutput = deviceName;
+    hasPendingOutput = true;
+    ++pendingCount;
+    scheduleTransition();
+}
+
+void DeviceTransitionScheduler::stop() {
+    stopTimer();
+    if (state == State::fading) fader.fadeIn();
+
+    state = State::idle;
+    hasPendingInput = hasPendingOutput = false;
+    pendingCount = 0;
+}
+
+void DeviceTransitionScheduler::scheduleTransition() {
+    // 드롭다운을 빠르게 훑는 동안에는 요청마다 대기 구간을 다시 시작해 마지막 것만 적용
+    // 이미 페이드 중이면 적용 시점에 최신 요청을 함께 가져가므로 그대로 둠
+    if (state == State::fading) return;
+
+    state = State::waitingForQuiet;
+    startTimer(COALESCE_WINDOW_MS);
+}
+
+void DeviceTransitionScheduler::timerCallback() {
+    if (state == State::waitingForQuiet) {
+        // 1. 출력을 무음까지 내림 (오디오 스레드가 페이더를 진행시키는 동안 메시지 루프는 계속 돎)
+        state = State::fading;
+        fadeStartMs = juce::Time::getMillisecondCounterHiRes();
+        fader.fadeOut();
+        startTimer(FADE_POLL_MS);
+        return;
+    }
+
+    // 장치가 이미 멈춰 있으면 타임아웃 후 진행
+    if (state == State::fading
+        && (fader.isSilent() || juce::Time::getMillisecondCounterHiRes() - fadeStartMs >= FADE_TIMEOUT_MS)) {
+        stopTimer();
+        applyPendingTransition();
+    }
+}
+
+void DeviceTransitionScheduler::applyPendingTransition() {
+    Result result;
+    result.inputRequested = hasPendingInput;
+    result.outputRequested = hasPendingOutput;
+    result.inputDevice = pendingInput;
+    result.outputDevice = pendingOutput;
+    result.coalescedRequests = pendingCount;
+    hasPendingInput = hasPendingOutput = false;
+    pendingCount = 0;
+    state = State::idle;
+
+    if (!result.inputRequested && !result.outputRequested) {
+        fader.fadeIn();
+        return;
+    }
+
+    // 2. 입출력을 한 번의 setAudioDeviceSetup으로 적용 (이름이 바뀌면 내부에서 이전 장치를 닫고 새로 열어 시작)
+    auto setup = deviceManager.getAudioDeviceSetup();
+    if (result.inputRequested) setup.inputDeviceName = result.inputDevice;
+    if (result.outputRequested) setup.outputDeviceName = result.outputDevice;
+    result.error = deviceManager.setAudioDeviceSetup(setup, true);
+
+    // 3. 새 장치는 prepareToPlay에서 무음으로 시작하므로 여기서 올려줌
+    fader.fadeIn();
+
+    result.durationMs = juce::Time::getMillisecondCounterHiRes() - fadeStartMs;
+    lastTransitionMs = result.durationMs;
+
+    CLR_LOG_INFO("Device transition "
+                 + juce::String(result.succeeded() ? "applied" : "failed (" + result.error + ")")
+                 + (result.inputRequested ? " input='" + result.inputDevice + "'" : juce::String())
+                 + (result.outputRequested ? " output='" + result.outputDevice + "'" : juce::String())
+                 + " in " + juce::String(result.durationMs, 1) + " ms"
+                 + " (" + juce::String(result.coalescedRequests) + " requests coalesced)");
+
+    if (onTransitionFinished != nullptr) onTransitionFinished(result);
+}
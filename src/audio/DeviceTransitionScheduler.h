@@ -0,0 +1,92 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <functional>
+
+// 장치 전환 전후로 출력을 무음까지 부드럽게 내리고 다시 올리는 페이더
+// - process()는 오디오 스레드, fadeOut()/fadeIn()/isSilent()는 다른 스레드에서 호출
+class TransitionFader {
+public:
+    // prepareToPlay에서 호출 - 새 장치는 무음에서 시작해 fadeIn()으로 올라감
+    void prepare(double sampleRate);
+
+    // 오디오 스레드: 활성 구간에 게인 램프 적용 (할당/락 없음)
+    void process(juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept;
+
+    void fadeOut() noexcept { targetGain.store(0.0f, std::memory_order_release); }
+    void fadeIn() noexcept { targetGain.store(1.0f, std::memory_order_release); }
+
+    // fadeOut 이후 출력이 완전히 0에 도달했는지
+    bool isSilent() const noexcept { return silent.load(std::memory_order_acquire); }
+
+    static constexpr double FADE_MS = 20.0;
+
+private:
+    std::atomic<float> targetGain { 1.0f };
+    std::atomic<bool> silent { false };
+    float currentGain = 0.0f;    // 오디오 스레드 전용
+    float gainStep = 1.0f;       // 샘플당 게인 변화량
+};
+
+// 입출력 장치 전환을 메시지 스레드에서 순서대로 처리 (AudioDeviceManager는 메시지 스레드 전용)
+// - 요청은 입력/출력별로 마지막 것만 남기고(코얼레싱) 짧은 대기 구간 동안 모인 요청을 한 번에 적용
+// - 대기/페이드 진행은 타이머로 나눠 처리하므로 그동안 메시지 스레드를 막지 않음
+// - 전환 시 페이더로 무음까지 내린 뒤 setAudioDeviceSetup 한 번으로 장치를 바꾸고, 걸린 시간을 기록
+// - 별도 스레드가 아닌 타이머 스케줄러: 장치를 다시 여는 setAudioDeviceSetup 자체는 여전히 메시지 스레드에서
+//   동기로 실행되므로, 그 호출 동안(드라이버에 따라 수백 ms)은 메시지 스레드가 멈춤
+class DeviceTransitionScheduler : private juce::Timer {
+public:
+    struct Result {
+        bool inputRequested = false;
+        bool outputRequested = false;
+        juce::String inputDevice;       // 빈 문자열 = 입력 비활성화
+        juce::String outputDevice;
+        juce::String error;             // 비어 있으면 성공
+        double durationMs = 0.0;        // 페이드 시작 → 장치 재시작 완료
+        int coalescedRequests = 0;      // 이번 전환에 합쳐진 요청 수
+
+        bool succeeded() const { return error.isEmpty(); }
+    };
+
+    DeviceTransitionScheduler(juce::AudioDeviceManager& deviceManagerToUse, TransitionFader& faderToUse);
+    ~DeviceTransitionScheduler() override;
+
+    // 메시지 스레드: 실제 장치 이름(입력은 빈 문자열이면 비활성화)으로 요청
+    void requestInputDevice(const juce::String& deviceName);
+    void requestOutputDevice(const juce::String& deviceName);
+
+    // 오디오 종료 전에 호출 - 아직 적용되지 않은 요청은 버림
+    void stop();
+
+    double getLastTransitionMs() const { return lastTransitionMs; }
+
+    // 전환을 적용한 직후 메시지 스레드에서 호출
+    std::function<void(const Result&)> onTransitionFinished;
+
+    // 이 시간 동안 새 요청이 없을 때까지 기다렸다가 적용
+    static constexpr int COALESCE_WINDOW_MS = 30;
+    // 콜백이 멈춘 장치라면 무음 도달을 기다리지 않음
+    static constexpr int FADE_TIMEOUT_MS = 100;
+    // 페이드 중 무음 도달 확인 간격
+    static constexpr int FADE_POLL_MS = 2;
+
+private:
+    enum class State { idle, waitingForQuiet, fading };
+
+    void timerCallback() override;
+    void scheduleTransition();
+    void applyPendingTransition();
+
+    juce::AudioDeviceManager& deviceManager;
+    TransitionFader& fader;
+
+    // 아래 멤버는 모두 메시지 스레드 전용
+    State state = State::idle;
+    bool hasPendingInput = false;
+    bool hasPendingOutput = false;
+    juce::String pendingInput;
+    juce::String pendingOutput;
+    int pendingCount = 0;
+    double fadeStartMs = 0.0;
+    double lastTransitionMs = 0.0;
+};
@@ -0,0 +1,193 @@
+#include "HostAudioCallback.h"
+#include "AudioRecorder.h"
+#include "RealtimeAllocationTracker.h"
+
+HostAudioCallback::HostAudioCallback(PluginChain& chain, BypassCrossfader& bypass, ParameterMap& parameters,
+                                     ParameterSmoother& smoother, TransitionFader& fader, AudioCallbackMeter& meter)
+    : pluginChain(chain), clearBypass(bypass), parameterMap(parameters), parameterSmoother(smoother),
+      transitionFader(fader), audioMeter(meter) {}
+
+void HostAudioCallback::prepare(double sampleRate, int blockSize, int totalLatencySamples) {
+    // 새 장치는 무음에서 시작해 페이드 인
+    transitionFader.prepare(sampleRate);
+    audioMeter.prepare(sampleRate, blockSize);
+    parameterSmoother.prepare(sampleRate);
+
+    // 오디오 콜백에서 쓰는 버퍼는 모두 여기서 미리 할당 (콜백 안에서는 할당/락/로그 금지)
+    audioThreadMidi.ensureSize(MIDI_BUFFER_BYTES);
+    audioThreadMidi.clear();
+    subBlockMidi.ensureSize(MIDI_BUFFER_BYTES);
+    subBlockMidi.clear();
+
+    const int dryFrames = juce::jmax(blockSize, MIN_DRY_INPUT_FRAMES);
+    dryInputBuffer.setSize(2, dryFrames, false, true, true);
+    // dry 입력을 Clear + 체인 지연만큼 늦춰 처리된 파일과 같은 위치에 기록
+    dryInputDelay.prepare(2, dryFrames, totalLatencySamples);
+    dryCaptureWasActive = false;
+
+    // 하드웨어 MIDI CC를 오디오 블록 내 샘플 위치로 변환하기 위한 컬렉터
+    midiCollector.reset(sampleRate);
+    midiCollectorReady = true;
+}
+
+void HostAudioCallback::release() {
+    midiCollectorReady = false;
+    parameterSmoother.release();
+}
+
+void HostAudioCallback::addMidiMessage(const juce::MidiMessage& message) {
+    if (midiCollectorReady) midiCollector.addMessageToQueue(message);
+}
+
+void HostAudioCallback::process(const juce::AudioSourceChannelInfo& bufferToFill, juce::AudioProcessor* clear,
+                                AudioRecorder* recorder) noexcept {
+    // MIDI 스레드에서 쌓인 CC를 이번 블록의 샘플 위치로 꺼내옴 (용량은 유지)
+    audioThreadMidi.clear();
+    if (midiCollectorReady) {
+        midiCollector.removeNextBlockOfMessages(audioThreadMidi, bufferToFill.numSamples);
+    }
+    processBlock(bufferToFill, clear, recorder);
+}
+
+void HostAudioCallback::processWithMidi(const juce::AudioSourceChannelInfo& bufferToFill, juce::AudioProcessor* clear,
+                                        AudioRecorder* recorder, const juce::MidiBuffer& midi) noexcept {
+    audioThreadMidi.clear();
+    audioThreadMidi.addEvents(midi, 0, bufferToFill.numSamples, 0);
+    processBlock(bufferToFill, clear, recorder);
+}
+
+void HostAudioCallback::processBlock(const juce::AudioSourceChannelInfo& bufferToFill, juce::AudioProcessor* clear,
+                                     AudioRecorder* recorder) noexcept {
+    // 디버그 빌드: 이 구간에서 호스트 코드가 힙 할당을 하면 jassert
+    RealtimeAllocationTracker::ScopedRealtimeSection realtimeSection;
+
+    // 콜백 간격(지터/xrun)과 처리 시간(부하) 계측
+    const auto callbackStartTicks = audioMeter.callbackStarted(bufferToFill.numSamples);
+    auto& buffer = *bufferToFill.buffer;
+
+    if (clear != nullptr) {
+        const bool captureDry = captureDryInput(bufferToFill, recorder);
+
+        // Clear 앞 이펙트 → Clear (MIDI CC/노브 램프 서브블록, bypass 크로스페이드) → Clear 뒤 이펙트
+        pluginChain.process(PluginChain::Position::beforeClear, buffer, bufferToFill.startSample, bufferToFill.numSamples);
+        clearBypass.pushDry(buffer, bufferToFill.startSample, bufferToFill.numSamples);
+        processClearWithMidiCC(bufferToFill, *clear);
+        clearBypass.process(buffer, bufferToFill.startSample, bufferToFill.numSamples);
+        pluginChain.process(PluginChain::Position::afterClear, buffer, bufferToFill.startSample, bufferToFill.numSamples);
+
+        // 장치 전환 전후 페이드 (평상시에는 바로 반환)
+        transitionFader.process(buffer, bufferToFill.startSample, bufferToFill.numSamples);
+
+        // 오디오 녹음 처리 (지난 N초 링은 항상, 녹음 링은 녹음 중일 때만 복사 - 디스크 쓰기는 녹음 스레드가 담당)
+        // 블록이 dry 버퍼보다 크면 입력 없이 넘김 → 그 구간은 dry 파일에 무음으로 기록되어 정렬은 유지
+        if (recorder != nullptr) {
+            // 출력 채널 포인터 배열은 버퍼가 이미 가지고 있으므로 할당 없음
+            const float* const* outputData = buffer.getArrayOfReadPointers();
+            recorder->processAudioData(captureDry ? dryInputBuffer.getArrayOfReadPointers() : nullptr,
+                                       captureDry ? dryInputBuffer.getNumChannels() : 0,
+                                       outputData, buffer.getNumChannels(), bufferToFill.numSamples);
+        }
+    } else {
+        bufferToFill.clearActiveBufferRegion();
+        transitionFader.process(buffer, bufferToFill.startSample, bufferToFill.numSamples);
+    }
+
+    audioMeter.callbackFinished(callbackStartTicks, bufferToFill.numSamples);
+}
+
+bool HostAudioCallback::captureDryInput(const juce::AudioSourceChannelInfo& bufferToFill, const AudioRecorder* recorder) noexcept {
+    // dry 녹음 중이면 플러그인이 덮어쓰기 전에 입력을 복사 (버퍼는 prepare에서 할당됨)
+    const bool captureDry = recorder != nullptr && recorder->isCapturingDryInput()
+                            && bufferToFill.numSamples <= dryInputBuffer.getNumSamples();
+    if (captureDry) {
+        const int numInputChannels = bufferToFill.buffer->getNumChannels();
+        for (int ch = 0; ch < dryInputBuffer.getNumChannels(); ++ch) {
+            if (numInputChannels > 0) {
+                // 모노 입력은 양쪽 채널에 복제
+                dryInputBuffer.copyFrom(ch, 0, *bufferToFill.buffer, juce::jmin(ch, numInputChannels - 1),
+                                        bufferToFill.startSample, bufferToFill.numSamples);
+            } else {
+                dryInputBuffer.clear(ch, 0, bufferToFill.numSamples);
+            }
+        }
+
+        // 새 녹음의 앞부분(지연 구간)은 무음 - 이전 녹음의 입력이 남지 않게 비움
+        if (!dryCaptureWasActive) dryInputDelay.reset();
+        dryInputDelay.process(dryInputBuffer, bufferToFill.numSamples);
+    }
+    dryCaptureWasActive = captureDry;
+    return captureDry;
+}
+
+// CC 타임스탬프 위치와 노브 램프에 맞춰 블록을 나눠 처리
+// - CC는 정확한 샘플 위치에서 노브 램프의 새 목표가 됨 (bypass는 바로 적용)
+// - 램프 중에는 RAMP_SUB_BLOCK마다 파라미터를 갱신해 계단 없이 이어지게 함
+void HostAudioCallback::processClearWithMidiCC(const juce::AudioSourceChannelInfo& bufferToFill, juce::AudioProcessor& clear) noexcept {
+    auto& buffer = *bufferToFill.buffer;
+    const int numSamples = bufferToFill.numSamples;
+
+    parameterSmoother.pullTargets(parameterMap);
+
+    auto midiIt = audioThreadMidi.cbegin();
+    const auto midiEnd = audioThreadMidi.cend();
+    int subBlockStart = 0;
+
+    while (subBlockStart < numSamples) {
+        // 너무 잘게 나누지 않도록 최소 서브블록 길이 안의 CC는 이 서브블록 시작에서 적용
+        int nextEventPos = numSamples;
+        for (; midiIt != midiEnd; ++midiIt) {
+            const auto metadata = *midiIt;
+            const int eventPos = juce::jlimit(0, numSamples, metadata.samplePosition);
+            if (eventPos - subBlockStart >= MIN_MIDI_SUB_BLOCK) {
+                nextEventPos = eventPos;
+                break;
+            }
+            applyMidiCC(metadata);
+        }
+
+        int subBlockEnd = nextEventPos;
+        if (parameterSmoother.isRamping()) {
+            subBlockEnd = juce::jmin(subBlockEnd, subBlockStart + ParameterSmoother::RAMP_SUB_BLOCK);
+        }
+
+        parameterSmoother.advance(parameterMap, subBlockEnd - subBlockStart);
+        processClearSubBlock(clear, buffer, bufferToFill.startSample, subBlockStart, subBlockEnd - subBlockStart);
+        subBlockStart = subBlockEnd;
+    }
+
+    // 블록 끝에 걸친 CC는 다음 블록부터 적용
+    for (; midiIt != midiEnd; ++midiIt) {
+        applyMidiCC(*midiIt);
+    }
+}
+
+void HostAudioCallback::applyMidiCC(const juce::MidiMessageMetadata& metadata) noexcept {
+    if (metadata.numBytes < 3 || (metadata.data[0] & 0xf0) != 0xb0) return; // 컨트롤 체인지만
+
+    const int cc = metadata.data[1];
+    const int ccValue = metadata.data[2];
+    if (cc < FIRST_MIDI_CC || cc >= FIRST_MIDI_CC + NUM_MIDI_CC_TARGETS) return;
+
+    const auto role = MIDI_CC_ROLES[(size_t)(cc - FIRST_MIDI_CC)];
+    if (role == ParameterMap::Role::bypass) {
+        // CC 24(bypass): 64 이상이면 bypass off, 미만이면 bypass on - 호스트 크로스페이드 (파라미터 불필요)
+        clearBypass.setBypassed(ccValue < 64);
+        return;
+    }
+
+    // 7비트 계단은 노브 램프로 이어줌 (노브 역할 번호 = 노브 인덱스)
+    if (!parameterMap.has(role)) return;
+    parameterSmoother.setTargetFromAudioThread(static_cast<int>(role), ccValue / 127.0f, parameterMap);
+}
+
+void HostAudioCallback::processClearSubBlock(juce::AudioProcessor& clear, juce::AudioBuffer<float>& buffer,
+                                             int bufferStart, int offset, int length) noexcept {
+    // 외부 데이터를 참조하는 AudioBuffer는 채널 포인터만 복사하므로 할당 없음
+    juce::AudioBuffer<float> subBuffer(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), bufferStart + offset, length);
+    subBlockMidi.clear();
+    subBlockMidi.addEvents(audioThreadMidi, offset, length, -offset);
+
+    // 플러그인 내부 할당은 호스트가 통제할 수 없으므로 검사에서 제외
+    RealtimeAllocationTracker::ScopedAllocationAllowed pluginCall;
+    clear.processBlock(subBuffer, subBlockMidi);
+}
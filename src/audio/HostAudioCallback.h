@@ -0,0 +1,85 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "AudioCallbackMeter.h"
+#include "BypassCrossfader.h"
+#include "DeviceTransitionScheduler.h"
+#include "LatencyDelayLine.h"
+#include "ParameterSmoother.h"
+#include "PluginChain.h"
+#include "../plugin/ParameterMap.h"
+
+class AudioRecorder;
+
+// 호스트 오디오 콜백 본체 - ClearHostApp::getNextAudioBlock은 그대로 넘기기만 하고, 실시간 할당 테스트도 이 객체를 돌림
+// 처리 순서: dry 입력 사본(녹음 중, 지연 보상) → Clear 앞 체인 → Clear(MIDI CC/노브 램프 서브블록, bypass 크로스페이드)
+//           → Clear 뒤 체인 → 장치 전환 페이드 → 녹음 링 → 계측
+// - 체인/bypass/스무더/페이더/계측기는 앱이 소유하고 메시지 스레드에서도 쓰므로 참조로 받음
+// - 콜백 전용 버퍼(dry 사본, MIDI)와 하드웨어 MIDI CC 수집기는 이 객체가 소유하고 모두 prepare에서 할당
+class HostAudioCallback {
+public:
+    HostAudioCallback(PluginChain& pluginChain, BypassCrossfader& clearBypass, ParameterMap& parameterMap,
+                      ParameterSmoother& parameterSmoother, TransitionFader& transitionFader, AudioCallbackMeter& audioMeter);
+
+    // 하드웨어 MIDI CC 21~24 → amb, vox, v. rev, bypass
+    static constexpr int FIRST_MIDI_CC = 21;
+    static constexpr int NUM_MIDI_CC_TARGETS = 4;
+    static constexpr std::array<ParameterMap::Role, NUM_MIDI_CC_TARGETS> MIDI_CC_ROLES {
+        ParameterMap::Role::ambience,     // CC 21
+        ParameterMap::Role::voice,        // CC 22
+        ParameterMap::Role::voiceReverb,  // CC 23
+        ParameterMap::Role::bypass        // CC 24
+    };
+    static constexpr int MIN_MIDI_SUB_BLOCK = 16;   // 이보다 짧은 구간은 분할하지 않음
+    static constexpr int MIDI_BUFFER_BYTES = 4096;
+    // 장치가 예고보다 큰 블록을 보내는 경우를 대비한 dry 버퍼 최소 길이
+    static constexpr int MIN_DRY_INPUT_FRAMES = 4096;
+
+    // prepareToPlay/releaseResources에서 (오디오 콜백이 멈춘 상태)
+    // 페이더, 계측기, 스무더와 콜백 전용 버퍼를 준비 - 체인과 Clear bypass는 플러그인과 함께 앱이 준비
+    void prepare(double sampleRate, int blockSize, int totalLatencySamples);
+    void release();
+
+    // 어느 스레드에서든 - dry 녹음을 Clear + 체인 지연만큼 늦춤
+    void setDryLatencySamples(int latencySamples) noexcept { dryInputDelay.setLatencySamples(latencySamples); }
+
+    // MIDI 스레드 - 오디오 스레드가 다음 블록에서 샘플 위치에 맞춰 적용
+    void addMidiMessage(const juce::MidiMessage& message);
+
+    // 오디오 스레드 -------------------------------------------------------
+    // clear가 없으면 무음 (페이더와 계측은 그대로), recorder는 없어도 됨
+    void process(const juce::AudioSourceChannelInfo& bufferToFill, juce::AudioProcessor* clear, AudioRecorder* recorder) noexcept;
+
+    // 수집기 대신 샘플 위치가 이미 정해진 MIDI로 한 블록 처리 (용량은 MIDI_BUFFER_BYTES 안)
+    void processWithMidi(const juce::AudioSourceChannelInfo& bufferToFill, juce::AudioProcessor* clear, AudioRecorder* recorder,
+                         const juce::MidiBuffer& midi) noexcept;
+
+private:
+    void processBlock(const juce::AudioSourceChannelInfo& bufferToFill, juce::AudioProcessor* clear, AudioRecorder* recorder) noexcept;
+    bool captureDryInput(const juce::AudioSourceChannelInfo& bufferToFill, const AudioRecorder* recorder) noexcept;
+    void processClearWithMidiCC(const juce::AudioSourceChannelInfo& bufferToFill, juce::AudioProcessor& clear) noexcept;
+    void applyMidiCC(const juce::MidiMessageMetadata& metadata) noexcept;
+    void processClearSubBlock(juce::AudioProcessor& clear, juce::AudioBuffer<float>& buffer, int bufferStart, int offset, int length) noexcept;
+
+    PluginChain& pluginChain;
+    BypassCrossfader& clearBypass;
+    ParameterMap& parameterMap;
+    ParameterSmoother& parameterSmoother;
+    TransitionFader& transitionFader;
+    AudioCallbackMeter& audioMeter;
+
+    // 하드웨어 MIDI CC → 오디오 스레드 전달
+    juce::MidiMessageCollector midiCollector;
+    std::atomic<bool> midiCollectorReady { false };
+
+    // 오디오 스레드 전용 -------------------------------------------------
+    // 플러그인 처리 전 입력 사본 (dry 녹음용) / 지연 보상 / 직전 콜백에서 dry를 녹음했는지
+    juce::AudioBuffer<float> dryInputBuffer;
+    LatencyDelayLine dryInputDelay;
+    bool dryCaptureWasActive = false;
+
+    // 콜백마다 재사용하는 MIDI 버퍼
+    juce::MidiBuffer audioThreadMidi;
+    juce::MidiBuffer subBlockMidi;
+};
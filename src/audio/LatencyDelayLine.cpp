@@ -0,0 +1,37 @@
+#include "LatencyDelayLine.h"
+
+void LatencyDelayLine::prepare(int numChannels, int maxBlockSize, int latency) {
+    setLatencySamples(latency);
+    maxLatency = juce::jmax(latency, MIN_LATENCY_CAPACITY);
+    ringSize = juce::jmax(1, maxBlockSize) + maxLatency;
+
+    ring.setSize(juce::jmax(1, numChannels), ringSize, false, true, false);
+    reset();
+}
+
+void LatencyDelayLine::reset() noexcept {
+    ring.clear();
+    writePosition = 0;
+}
+
+bool LatencyDelayLine::process(juce::AudioBuffer<float>& buffer, int numSamples) noexcept {
+    const int latency = juce::jmin(latencySamples.load(std::memory_order_relaxed), maxLatency);
+    if (ringSize == 0 || numSamples + latency > ringSize) return false;
+
+    const int numChannels = juce::jmin(buffer.getNumChannels(), ring.getNumChannels());
+    const int writeFirstPart = juce::jmin(numSamples, ringSize - writePosition);
+    const int readPosition = (writePosition - latency + ringSize) % ringSize;
+    const int readFirstPart = juce::jmin(numSamples, ringSize - readPosition);
+
+    for (int ch = 0; ch < numChannels; ++ch) {
+        // 먼저 이번 블록을 기록 → 지연이 블록보다 짧으면 읽는 구간에 이번 블록 앞부분이 포함됨
+        ring.copyFrom(ch, writePosition, buffer, ch, 0, writeFirstPart);
+        ring.copyFrom(ch, 0, buffer, ch, writeFirstPart, numSamples - writeFirstPart);
+
+        buffer.copyFrom(ch, 0, ring, ch, readPosition, readFirstPart);
+        buffer.copyFrom(ch, readFirstPart, ring, ch, 0, numSamples - readFirstPart);
+    }
+
+    writePosition = (writePosition + numSamples) % ringSize;
+    return true;
+}
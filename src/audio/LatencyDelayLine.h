@@ -0,0 +1,34 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+
+// 고정 지연 라인 - 처리 전 신호를 플러그인 지연만큼 늦춰 처리된 신호와 샘플 단위로 맞춤 (bypass dry, dry 녹음)
+// - 블록을 링에 쓰고 지연만큼 뒤에서 읽어 제자리에 덮어씀
+// - 버퍼는 prepare에서만 할당, process/reset은 할당/락 없음
+class LatencyDelayLine {
+public:
+    static constexpr int MIN_LATENCY_CAPACITY = 8192;  // 실행 중 지연이 늘어나도 재할당 없이 따라갈 여유
+
+    // 오디오 콜백이 이 객체를 쓰지 않는 동안 (prepareToPlay)
+    void prepare(int numChannels, int maxBlockSize, int latencySamples);
+
+    // 어느 스레드에서든 - 준비한 용량을 넘으면 최대값으로 제한
+    void setLatencySamples(int newLatency) noexcept { latencySamples.store(juce::jmax(0, newLatency), std::memory_order_relaxed); }
+    int getLatencySamples() const noexcept { return latencySamples.load(std::memory_order_relaxed); }
+
+    // 오디오 스레드 -------------------------------------------------------
+    // 링을 무음으로 비움 (새 녹음의 앞부분에 이전 입력이 섞이지 않도록)
+    void reset() noexcept;
+
+    // buffer의 [0, numSamples)를 지연된 신호로 교체. 블록 + 지연이 링보다 길면 그대로 두고 false
+    bool process(juce::AudioBuffer<float>& buffer, int numSamples) noexcept;
+
+private:
+    std::atomic<int> latencySamples { 0 };
+
+    // 오디오 스레드 전용
+    juce::AudioBuffer<float> ring;
+    int ringSize = 0;
+    int maxLatency = 0;
+    int writePosition = 0;
+};
@@ -0,0 +1,105 @@
+#include "ParameterSmoother.h"
+
+bool ParameterSmoother::setTarget(int knobIndex, float normalisedValue, double rampMs) noexcept {
+    if (!isActive() || !juce::isPositiveAndBelow(knobIndex, NUM_KNOBS)) return false;
+
+    auto& slot = targets[(size_t)knobIndex];
+    slot.value.store(juce::jlimit(0.0f, 1.0f, normalisedValue), std::memory_order_relaxed);
+    slot.rampMs.store((float)rampMs, std::memory_order_relaxed);
+    slot.sequence.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+bool ParameterSmoother::stopAllAndWait(int timeoutMs) noexcept {
+    const auto generation = stopRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+    const auto startMs = juce::Time::getMillisecondCounter();
+    while (stopAcknowledged.load(std::memory_order_acquire) != generation) {
+        // 콜백이 돌지 않으면 advance도 불리지 않으므로 기다릴 필요 없음 (다음 prepare에서 요청도 정리됨)
+        if (!isActive()) return true;
+        if (juce::Time::getMillisecondCounter() - startMs >= (juce::uint32)timeoutMs) return false;
+        juce::Thread::sleep(1);
+    }
+    return true;
+}
+
+void ParameterSmoother::prepare(double newSampleRate) noexcept {
+    sampleRate = newSampleRate > 0.0 ? newSampleRate : 44100.0;
+    for (auto& ramp : ramps) ramp.remaining = 0;
+    discardPendingTargets();
+    stopAcknowledged.store(stopRequested.load(std::memory_order_acquire), std::memory_order_release);
+    active.store(true, std::memory_order_release);
+}
+
+void ParameterSmoother::release() noexcept {
+    active.store(false, std::memory_order_release);
+    for (auto& ramp : ramps) ramp.remaining = 0;
+}
+
+void ParameterSmoother::discardPendingTargets() noexcept {
+    for (int i = 0; i < NUM_KNOBS; ++i) {
+        seenSequence[(size_t)i] = targets[(size_t)i].sequence.load(std::memory_order_acquire);
+    }
+}
+
+void ParameterSmoother::pullTargets(const ParameterMap& parameterMap) noexcept {
+    // 정지 요청: 램프와 그 전에 들어온 목표를 버리고 확인 (확인 후에는 이 블록의 advance도 쓰지 않음)
+    const auto stopGeneration = stopRequested.load(std::memory_order_acquire);
+    if (stopGeneration != stopAcknowledged.load(std::memory_order_relaxed)) {
+        for (auto& ramp : ramps) ramp.remaining = 0;
+        discardPendingTargets();
+        stopAcknowledged.store(stopGeneration, std::memory_order_release);
+        return;
+    }
+
+    for (int i = 0; i < NUM_KNOBS; ++i) {
+        auto& slot = targets[(size_t)i];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == seenSequence[(size_t)i]) continue;
+
+        const float value = slot.value.load(std::memory_order_relaxed);
+        const float rampMs = slot.rampMs.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_acquire) != sequence) continue;
+
+        seenSequence[(size_t)i] = sequence;
+        startRamp(i, value, rampMs, parameterMap);
+    }
+}
+
+void ParameterSmoother::setTargetFromAudioThread(int knobIndex, float normalisedValue, const ParameterMap& parameterMap) noexcept {
+    if (!juce::isPositiveAndBelow(knobIndex, NUM_KNOBS)) return;
+    startRamp(knobIndex, juce::jlimit(0.0f, 1.0f, normalisedValue), DEFAULT_RAMP_MS, parameterMap);
+}
+
+void ParameterSmoother::startRamp(int knobIndex, float value, double rampMs, const ParameterMap& parameterMap) noexcept {
+    auto& ramp = ramps[(size_t)knobIndex];
+
+    // 쉬고 있던 노브는 실제 파라미터 값에서 출발 (그 사이 플러그인 UI 등으로 바뀌었을 수 있음)
+    if (ramp.remaining == 0) {
+        ramp.current = parameterMap.getValue(ParameterMap::roleForKnob(knobIndex), value);
+    }
+
+    ramp.target = value;
+    ramp.remaining = juce::jmax(1, juce::roundToInt(rampMs * 0.001 * sampleRate));
+    ramp.step = (ramp.target - ramp.current) / (float)ramp.remaining;
+}
+
+bool ParameterSmoother::isRamping() const noexcept {
+    for (const auto& ramp : ramps) {
+        if (ramp.remaining > 0) return true;
+    }
+    return false;
+}
+
+void ParameterSmoother::advance(ParameterMap& parameterMap, int numSamples) noexcept {
+    for (int i = 0; i < NUM_KNOBS; ++i) {
+        auto& ramp = ramps[(size_t)i];
+        if (ramp.remaining == 0) continue;
+
+        const int n = juce::jmin(numSamples, ramp.remaining);
+        ramp.remaining -= n;
+        ramp.current = ramp.remaining == 0 ? ramp.target : ramp.current + ramp.step * (float)n;
+        parameterMap.setValue(ParameterMap::roleForKnob(i), ramp.current);
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "../plugin/ParameterMap.h"
+
+// 노브 파라미터(amb, vox, v. rev) 스무딩
+// - 메시지 스레드는 노브별 atomic 목표 슬롯에 마지막 값만 쓰고, 오디오 스레드가 processBlock 전에 서브블록 단위로 램프 적용
+//   (슬롯은 덮어쓰기이므로 큐처럼 가득 차서 목표가 버려지는 일이 없음)
+// - 드래그/휠/MIDI CC의 계단식 값 변화와 프리셋 전환이 UI 타이머(약 16ms)가 아닌 오디오 샘플 단위로 이어짐
+// - 램프 중이 아닐 때는 파라미터에 쓰지 않음 (플러그인 UI나 setStateInformation으로 바뀐 값을 덮어쓰지 않도록)
+class ParameterSmoother {
+public:
+    static constexpr int NUM_KNOBS = ParameterMap::NUM_KNOBS;
+    static constexpr double DEFAULT_RAMP_MS = 20.0;     // 노브 조작, MIDI CC
+    static constexpr int RAMP_SUB_BLOCK = 32;           // 램프 중에는 이 길이마다 파라미터 갱신
+
+    // 메시지 스레드 -------------------------------------------------------
+    // 오디오가 돌고 있지 않으면 false (호출자가 직접 적용)
+    bool setTarget(int knobIndex, float normalisedValue, double rampMs = DEFAULT_RAMP_MS) noexcept;
+
+    // 진행 중인 램프와 아직 반영되지 않은 목표를 모두 버리고, 오디오 스레드가 이를 확인할 때까지 대기
+    // (전체 상태 프리셋 적용 전 - 반환 후에는 advance가 불러온 값을 덮어쓰지 않음)
+    // 오디오 콜백이 멈춰 있으면 바로 true, timeoutMs 안에 확인이 없으면 false
+    bool stopAllAndWait(int timeoutMs = STOP_ACK_TIMEOUT_MS) noexcept;
+
+    static constexpr int STOP_ACK_TIMEOUT_MS = 100;
+
+    bool isActive() const noexcept { return active.load(std::memory_order_acquire); }
+
+    // 오디오 스레드 (prepare/release는 오디오 콜백이 멈춘 상태에서) -------------
+    void prepare(double sampleRate) noexcept;
+    void release() noexcept;
+
+    // 블록 시작: 메시지 스레드에서 온 목표값과 정지 요청 반영
+    void pullTargets(const ParameterMap& parameterMap) noexcept;
+
+    // 블록 안의 MIDI CC 목표값 (오디오 스레드에서 바로)
+    void setTargetFromAudioThread(int knobIndex, float normalisedValue, const ParameterMap& parameterMap) noexcept;
+
+    bool isRamping() const noexcept;
+
+    // 다음 numSamples 구간을 처리하기 전에 호출 - 램프를 진행하고 도달한 값을 파라미터에 설정
+    void advance(ParameterMap& parameterMap, int numSamples) noexcept;
+
+private:
+    // 메시지 스레드가 값/램프 길이를 쓴 뒤 sequence를 올림 → 오디오 스레드는 sequence가 바뀐 슬롯만 읽음
+    // 읽는 도중 sequence가 또 바뀌면 이번 블록은 건너뛰고 다음 블록에서 최신 값을 읽음
+    struct TargetSlot {
+        std::atomic<float> value { 0.0f };
+        std::atomic<float> rampMs { 0.0f };
+        std::atomic<juce::uint32> sequence { 0 };
+    };
+
+    struct Ramp {
+        float current = 0.0f;
+        float target = 0.0f;
+        float step = 0.0f;
+        int remaining = 0;
+    };
+
+    void startRamp(int knobIndex, float value, double rampMs, const ParameterMap& parameterMap) noexcept;
+
+    void discardPendingTargets() noexcept;
+
+    std::array<TargetSlot, NUM_KNOBS> targets;
+    std::array<juce::uint32, NUM_KNOBS> seenSequence {};   // 오디오 스레드 전용
+    std::atomic<juce::uint32> stopRequested { 0 };
+    std::atomic<juce::uint32> stopAcknowledged { 0 };
+    std::array<Ramp, NUM_KNOBS> ramps {};
+    double sampleRate = 44100.0;
+    std::atomic<bool> active { false };
+};
@@ -0,0 +1,151 @@
+#include "PluginChain.h"
+#include "RealtimeAllocationTracker.h"
+#include "../app/AsyncLogger.h"
+
+PluginChain::Slot::Slot(std::unique_ptr<juce::AudioPluginInstance> pluginToUse, Position positionToUse, bool startBypassed)
+    : plugin(std::move(pluginToUse)), position(positionToUse) {
+    bypass.setBypassed(startBypassed);
+    // 호스트 입출력에 맞춰 스테레오로 (사이드체인 버스가 있는 플러그인 등은 기본 레이아웃 유지)
+    juce::AudioProcessor::BusesLayout stereo;
+    stereo.inputBuses.add(juce::AudioChannelSet::stereo());
+    stereo.outputBuses.add(juce::AudioChannelSet::stereo());
+    if (!plugin->setBusesLayout(stereo)) {
+        CLR_LOG_DEBUG(plugin->getName() + ": keeping default bus layout");
+    }
+}
+
+PluginChain::Slot::~Slot() {
+    // 리스너 해제는 플러그인의 리스너 락을 잡으므로 이후에는 알림이 들어오지 않음
+    if (owner != nullptr) plugin->removeListener(this);
+    release();
+}
+
+void PluginChain::Slot::audioProcessorChanged(juce::AudioProcessor*, const ChangeDetails& details) {
+    if (!details.latencyChanged) return;
+
+    // atomic 저장만 - bypass dry 링은 준비한 용량 안에서 바로 새 지연을 따라감
+    const int newLatency = juce::jmax(0, plugin->getLatencySamples());
+    if (latencySamples.exchange(newLatency, std::memory_order_relaxed) == newLatency) return;
+    bypass.setLatencySamples(newLatency);
+
+    if (owner != nullptr && owner->onLatencyChanged) owner->onLatencyChanged();
+}
+
+PluginChain::SlotSnapshot PluginChain::Slot::capture() const {
+    SlotSnapshot snapshot;
+    snapshot.description = plugin->getPluginDescription();
+    snapshot.position = position;
+    snapshot.bypassed = isBypassed();
+    plugin->getStateInformation(snapshot.state);
+    return snapshot;
+}
+
+void PluginChain::Slot::prepare(double sampleRate, int blockSize) {
+    if (sampleRate <= 0.0 || blockSize <= 0) return;
+
+    plugin->prepareToPlay(sampleRate, blockSize);
+    const int latency = juce::jmax(0, plugin->getLatencySamples());
+    latencySamples.store(latency, std::memory_order_relaxed);
+    numOutputChannels = plugin->getTotalNumOutputChannels();
+    maxBlockSize = blockSize;
+
+    const int numPluginChannels = juce::jmax(NUM_CHANNELS, plugin->getTotalNumInputChannels(), numOutputChannels);
+    processBuffer.setSize(numPluginChannels, blockSize, false, true, false);
+    midi.ensureSize(256);
+    bypass.prepare(sampleRate, NUM_CHANNELS, blockSize, latency);
+
+    // 출력이 없는 플러그인은 준비만 하고 통과시킴
+    prepared = numOutputChannels > 0;
+}
+
+void PluginChain::Slot::release() {
+    if (maxBlockSize == 0) return;
+    plugin->releaseResources();
+    prepared = false;
+    maxBlockSize = 0;
+}
+
+void PluginChain::Slot::process(juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept {
+    if (!prepared) return;
+
+    // 장치가 예고보다 큰 블록을 보내면 준비한 크기로 나눠 처리
+    for (int offset = 0; offset < numSamples; offset += maxBlockSize) {
+        processChunk(buffer, startSample + offset, juce::jmin(maxBlockSize, numSamples - offset));
+    }
+}
+
+void PluginChain::Slot::processChunk(juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept {
+    const int numBufferChannels = buffer.getNumChannels();
+    const int numPluginChannels = processBuffer.getNumChannels();
+    bypass.pushDry(buffer, startSample, numSamples);
+
+    for (int ch = 0; ch < numPluginChannels; ++ch) {
+        if (ch < numBufferChannels) {
+            processBuffer.copyFrom(ch, 0, buffer, ch, startSample, numSamples);
+        } else {
+            processBuffer.clear(ch, 0, numSamples);
+        }
+    }
+
+    {
+        // 외부 데이터를 참조하는 AudioBuffer는 채널 포인터만 복사하므로 할당 없음
+        juce::AudioBuffer<float> pluginBuffer(processBuffer.getArrayOfWritePointers(), numPluginChannels, numSamples);
+        midi.clear();
+
+        // 플러그인 내부 할당은 호스트가 통제할 수 없으므로 검사에서 제외
+        RealtimeAllocationTracker::ScopedAllocationAllowed pluginCall;
+        plugin->processBlock(pluginBuffer, midi);
+    }
+
+    for (int ch = 0; ch < numBufferChannels; ++ch) {
+        buffer.copyFrom(ch, startSample, processBuffer, juce::jmin(ch, numOutputChannels - 1), 0, numSamples);
+    }
+    bypass.process(buffer, startSample, numSamples);
+}
+
+int PluginChain::getLatencySamples() const noexcept {
+    int total = 0;
+    for (const auto& slot : *layout) total += slot->getLatencySamples();
+    return total;
+}
+
+std::vector<PluginChain::SlotSnapshot> PluginChain::capture() const {
+    std::vector<SlotSnapshot> snapshots;
+    for (const auto& slot : *layout) snapshots.push_back(slot->capture());
+    return snapshots;
+}
+
+std::shared_ptr<const PluginChain::Layout> PluginChain::buildLayout(Layout slots) {
+    for (auto& slot : slots) {
+        if (slot->maxBlockSize == 0) slot->prepare(preparedSampleRate, preparedBlockSize);
+        // owner를 먼저 설정한 뒤 등록 → 리스너가 불릴 때는 항상 owner가 보임
+        if (slot->owner == nullptr) {
+            slot->owner = this;
+            slot->plugin->addListener(slot.get());
+        }
+    }
+    return std::make_shared<const Layout>(std::move(slots));
+}
+
+std::shared_ptr<const PluginChain::Layout> PluginChain::swapLayout(std::shared_ptr<const Layout> newLayout) noexcept {
+    std::swap(layout, newLayout);
+    return newLayout;
+}
+
+void PluginChain::prepare(double sampleRate, int blockSize) {
+    preparedSampleRate = sampleRate;
+    preparedBlockSize = blockSize;
+    for (auto& slot : *layout) slot->prepare(sampleRate, blockSize);
+}
+
+void PluginChain::release() {
+    preparedSampleRate = 0.0;
+    preparedBlockSize = 0;
+    for (auto& slot : *layout) slot->release();
+}
+
+void PluginChain::process(Position position, juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept {
+    for (auto& slot : *layout) {
+        if (slot->position == position) slot->process(buffer, startSample, numSamples);
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "BypassCrossfader.h"
+#include "../plugin/ChainSlotSnapshot.h"
+
+// Clear 앞뒤에 거는 추가 이펙트 체인 (예: Clear 앞 EQ, Clear 뒤 리미터)
+// - 슬롯 구성(Layout)은 메시지 스레드에서 새로 만들고 준비까지 끝낸 뒤 포인터만 교체 → 편집해도 소리가 끊기지 않음
+//   준비(buildLayout)는 pluginPrepareLock 안에서, 교체(swapLayout)는 거기에 오디오 콜백 락까지 잡고 호출
+// - 새 구성에 그대로 남는 슬롯은 이전 구성과 공유되므로 플러그인 상태와 지연 버퍼가 이어짐
+// - 슬롯 bypass는 BypassCrossfader (atomic 플래그 + 지연 맞춘 dry와 크로스페이드)
+//   bypass 중에도 플러그인은 계속 처리하므로 켜고 꺼도 체인 전체 지연이 같음
+// - 오디오 스레드에서 쓰는 버퍼는 모두 prepare에서 할당
+// - 실행 중 플러그인이 지연을 바꾸면 (예: lookahead 변경) 슬롯 리스너가 dry 지연을 맞추고 onLatencyChanged로 알림
+class PluginChain {
+public:
+    using Position = ChainPosition;
+    using SlotSnapshot = ChainSlotSnapshot;
+
+    static constexpr int NUM_CHANNELS = 2;          // 호스트 입출력 (setAudioChannels(2, 2))
+
+    class Slot : private juce::AudioProcessorListener {
+    public:
+        Slot(std::unique_ptr<juce::AudioPluginInstance> plugin, Position position, bool bypassed);
+        ~Slot() override;
+
+        juce::AudioPluginInstance& getPlugin() const noexcept { return *plugin; }
+        juce::String getName() const { return plugin->getName(); }
+        Position getPosition() const noexcept { return position; }
+        int getLatencySamples() const noexcept { return latencySamples.load(std::memory_order_relaxed); }
+
+        // 어느 스레드에서든 - 오디오 스레드가 다음 블록부터 크로스페이드
+        bool isBypassed() const noexcept { return bypass.isBypassed(); }
+        void setBypassed(bool shouldBypass) noexcept { bypass.setBypassed(shouldBypass); }
+
+        // 메시지 스레드
+        SlotSnapshot capture() const;
+
+    private:
+        friend class PluginChain;
+
+        void prepare(double sampleRate, int blockSize);
+        void release();
+        void process(juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept;
+        void processChunk(juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept;
+
+        // 플러그인이 보낸 알림 (어느 스레드에서든, 오디오 스레드 포함)
+        void audioProcessorParameterChanged(juce::AudioProcessor*, int, float) override {}
+        void audioProcessorChanged(juce::AudioProcessor*, const ChangeDetails& details) override;
+
+        std::unique_ptr<juce::AudioPluginInstance> plugin;
+        const Position position;
+        BypassCrossfader bypass;
+        PluginChain* owner = nullptr;               // 처음 buildLayout에 들어갈 때 설정하고 리스너 등록
+
+        bool prepared = false;
+        int maxBlockSize = 0;
+        std::atomic<int> latencySamples { 0 };
+        int numOutputChannels = 0;
+        juce::AudioBuffer<float> processBuffer;     // 플러그인 버스 채널 수 x 블록 크기
+        juce::MidiBuffer midi;
+    };
+
+    // 처리 순서대로 - 같은 위치(Clear 앞/뒤)의 슬롯끼리는 목록 순서로 처리
+    using Layout = std::vector<std::shared_ptr<Slot>>;
+
+    // 메시지 스레드 -------------------------------------------------------
+    const Layout& getLayout() const noexcept { return *layout; }
+    int getLatencySamples() const noexcept;
+    std::vector<SlotSnapshot> capture() const;
+
+    // 슬롯 플러그인의 지연이 바뀌면 호출 (어느 스레드에서든) - 구성을 읽으려면 메시지 스레드로 넘길 것
+    // 첫 구성을 만들기 전에 한 번만 설정
+    std::function<void()> onLatencyChanged;
+
+    // pluginPrepareLock 안에서 - 아직 준비되지 않은 슬롯을 현재 장치 설정으로 준비
+    std::shared_ptr<const Layout> buildLayout(Layout slots);
+
+    // pluginPrepareLock과 오디오 콜백 락 안에서 - 이전 구성을 돌려주므로 빠진 슬롯은 락 밖에서 해제
+    std::shared_ptr<const Layout> swapLayout(std::shared_ptr<const Layout> newLayout) noexcept;
+
+    // prepareToPlay/releaseResources에서 (pluginPrepareLock 안, 오디오 콜백이 멈춘 상태)
+    void prepare(double sampleRate, int blockSize);
+    void release();
+
+    // 오디오 스레드 -------------------------------------------------------
+    void process(Position position, juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept;
+
+private:
+    // 교체는 오디오 콜백 락 안에서만 일어나므로 오디오 스레드는 락 없이 읽음
+    std::shared_ptr<const Layout> layout = std::make_shared<const Layout>();
+    double preparedSampleRate = 0.0;
+    int preparedBlockSize = 0;
+};
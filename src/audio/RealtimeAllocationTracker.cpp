@@ -0,0 +1,187 @@
+#include "RealtimeAllocationTracker.h"
+
+#if JUCE_DEBUG
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if JUCE_MAC
+ #include <malloc/malloc.h>
+ #include <mach/mach.h>
+ #include <pthread.h>
+ #define CLEARHOST_HOOK_MALLOC_ZONE 1
+#elif defined(__GLIBC__)
+ #include <pthread.h>
+ #define CLEARHOST_HOOK_LIBC_MALLOC 1
+#endif
+
+// JUCE 컨테이너(HeapBlock → MidiBuffer, Array, AudioBuffer)는 operator new가 아니라 malloc/realloc을 직접 부르므로
+// operator new만 바꿔서는 보이지 않음 → malloc 계열 자체를 가로챔
+// - macOS: 기본 malloc 존의 함수 포인터를 감쌈 (operator new도 결국 이 존을 거침)
+// - glibc: 실행 파일에 malloc/calloc/realloc을 정의해 libc 심볼보다 먼저 연결되게 함
+// - 그 외: 이전처럼 전역 operator new만 교체
+namespace {
+#if CLEARHOST_HOOK_MALLOC_ZONE || CLEARHOST_HOOK_LIBC_MALLOC
+    // 스레드별 상태는 pthread 키에 정수로 보관
+    // thread_local은 첫 접근 때 malloc을 부를 수 있어(macOS TLV) malloc 훅 안에서 쓰면 재귀에 빠짐
+    constexpr intptr_t depthMask = 0x7fff;
+    constexpr int suspendShift = 15;
+    constexpr intptr_t reportingFlag = (intptr_t)1 << 30;
+
+    pthread_key_t stateKey;
+    std::atomic<bool> stateKeyReady { false };
+
+    intptr_t getState() noexcept {
+        return stateKeyReady.load(std::memory_order_acquire) ? (intptr_t)pthread_getspecific(stateKey) : 0;
+    }
+
+    void setState(intptr_t state) noexcept {
+        if (stateKeyReady.load(std::memory_order_acquire)) pthread_setspecific(stateKey, (void*)state);
+    }
+
+    int getRealtimeDepth(intptr_t state) noexcept { return (int)(state & depthMask); }
+    int getSuspendDepth(intptr_t state) noexcept { return (int)((state >> suspendShift) & depthMask); }
+
+    void addRealtimeDepth(int delta) noexcept { setState(getState() + delta); }
+    void addSuspendDepth(int delta) noexcept { setState(getState() + ((intptr_t)delta << suspendShift)); }
+#else
+    thread_local int realtimeDepth = 0;
+    thread_local int suspendDepth = 0;
+    thread_local bool reporting = false;
+#endif
+
+    std::atomic<juce::uint64> realtimeAllocations { 0 };
+
+    void noteAllocation() noexcept {
+#if CLEARHOST_HOOK_MALLOC_ZONE || CLEARHOST_HOOK_LIBC_MALLOC
+        const auto state = getState();
+        if (getRealtimeDepth(state) <= 0 || getSuspendDepth(state) > 0 || (state & reportingFlag) != 0) return;
+
+        realtimeAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        // jassert 자체가 문자열을 만들 수 있으므로 재진입 방지
+        setState(state | reportingFlag);
+        jassertfalse; // 오디오 스레드에서 힙 할당 발생!
+        setState(state);
+#else
+        if (realtimeDepth <= 0 || suspendDepth > 0 || reporting) return;
+
+        realtimeAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        // jassert 자체가 문자열을 만들 수 있으므로 재진입 방지
+        reporting = true;
+        jassertfalse; // 오디오 스레드에서 힙 할당 발생!
+        reporting = false;
+#endif
+    }
+
+#if CLEARHOST_HOOK_MALLOC_ZONE
+    malloc_zone_t* hookedZone = nullptr;
+    void* (*originalMalloc)(malloc_zone_t*, size_t) = nullptr;
+    void* (*originalCalloc)(malloc_zone_t*, size_t, size_t) = nullptr;
+    void* (*originalValloc)(malloc_zone_t*, size_t) = nullptr;
+    void* (*originalRealloc)(malloc_zone_t*, void*, size_t) = nullptr;
+    void* (*originalMemalign)(malloc_zone_t*, size_t, size_t) = nullptr;
+
+    void* zoneMalloc(malloc_zone_t* zone, size_t size) { noteAllocation(); return originalMalloc(zone, size); }
+    void* zoneCalloc(malloc_zone_t* zone, size_t count, size_t size) { noteAllocation(); return originalCalloc(zone, count, size); }
+    void* zoneValloc(malloc_zone_t* zone, size_t size) { noteAllocation(); return originalValloc(zone, size); }
+    void* zoneRealloc(malloc_zone_t* zone, void* p, size_t size) { noteAllocation(); return originalRealloc(zone, p, size); }
+    void* zoneMemalign(malloc_zone_t* zone, size_t alignment, size_t size) { noteAllocation(); return originalMemalign(zone, alignment, size); }
+
+    void installZoneHooks() {
+        // malloc_default_zone()은 최근 macOS에서 실제 존을 감싼 가상 존을 돌려주므로 등록된 첫 존(실제 기본 존)을 사용
+        vm_address_t* zones = nullptr;
+        unsigned int count = 0;
+        if (malloc_get_all_zones(mach_task_self(), nullptr, &zones, &count) != KERN_SUCCESS || count == 0) return;
+        hookedZone = reinterpret_cast<malloc_zone_t*>(zones[0]);
+
+        // 존 구조체는 읽기 전용 페이지에 있으므로 바꾸는 동안만 쓰기 허용
+        const auto pageStart = trunc_page((vm_address_t)hookedZone);
+        const auto pageEnd = round_page((vm_address_t)hookedZone + sizeof(malloc_zone_t));
+        if (vm_protect(mach_task_self(), pageStart, pageEnd - pageStart, false, VM_PROT_READ | VM_PROT_WRITE) != KERN_SUCCESS) return;
+
+        originalMalloc = hookedZone->malloc;
+        originalCalloc = hookedZone->calloc;
+        originalValloc = hookedZone->valloc;
+        originalRealloc = hookedZone->realloc;
+        hookedZone->malloc = zoneMalloc;
+        hookedZone->calloc = zoneCalloc;
+        hookedZone->valloc = zoneValloc;
+        hookedZone->realloc = zoneRealloc;
+        if (hookedZone->version >= 5 && hookedZone->memalign != nullptr) {
+            originalMemalign = hookedZone->memalign;
+            hookedZone->memalign = zoneMemalign;
+        }
+
+        vm_protect(mach_task_self(), pageStart, pageEnd - pageStart, false, VM_PROT_READ);
+    }
+#endif
+
+#if CLEARHOST_HOOK_MALLOC_ZONE || CLEARHOST_HOOK_LIBC_MALLOC
+    // 정적 초기화 시 한 번 - 그 전의 할당은 검사 없이 그대로 통과
+    struct HookInstaller {
+        HookInstaller() {
+            if (pthread_key_create(&stateKey, nullptr) == 0) stateKeyReady.store(true, std::memory_order_release);
+           #if CLEARHOST_HOOK_MALLOC_ZONE
+            installZoneHooks();
+           #endif
+        }
+    };
+    HookInstaller hookInstaller;
+#else
+    void* allocate(std::size_t size) {
+        noteAllocation();
+        if (void* p = std::malloc(size == 0 ? 1 : size))
+            return p;
+        throw std::bad_alloc();
+    }
+#endif
+}
+
+namespace RealtimeAllocationTracker {
+#if CLEARHOST_HOOK_MALLOC_ZONE || CLEARHOST_HOOK_LIBC_MALLOC
+    void enterRealtimeSection() noexcept { addRealtimeDepth(1); }
+    void exitRealtimeSection() noexcept { addRealtimeDepth(-1); }
+    void suspend() noexcept { addSuspendDepth(1); }
+    void resume() noexcept { addSuspendDepth(-1); }
+#else
+    void enterRealtimeSection() noexcept { ++realtimeDepth; }
+    void exitRealtimeSection() noexcept { --realtimeDepth; }
+    void suspend() noexcept { ++suspendDepth; }
+    void resume() noexcept { --suspendDepth; }
+#endif
+
+    juce::uint64 getAllocationCount() noexcept {
+        return realtimeAllocations.load(std::memory_order_relaxed);
+    }
+
+    void resetAllocationCount() noexcept {
+        realtimeAllocations.store(0, std::memory_order_relaxed);
+    }
+}
+
+#if CLEARHOST_HOOK_LIBC_MALLOC
+// glibc 할당 함수 교체 (디버그 빌드 전용) - 실제 할당은 glibc 내부 진입점으로 넘김
+// operator new도 malloc을 거치므로 따로 바꾸지 않음
+extern "C" {
+    void* __libc_malloc(size_t size) noexcept;
+    void* __libc_calloc(size_t count, size_t size) noexcept;
+    void* __libc_realloc(void* p, size_t size) noexcept;
+
+    void* malloc(size_t size) noexcept { noteAllocation(); return __libc_malloc(size); }
+    void* calloc(size_t count, size_t size) noexcept { noteAllocation(); return __libc_calloc(count, size); }
+    void* realloc(void* p, size_t size) noexcept { noteAllocation(); return __libc_realloc(p, size); }
+}
+#elif !CLEARHOST_HOOK_MALLOC_ZONE
+// 전역 할당 함수 교체 (디버그 빌드 전용)
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+#endif
+
+#endif
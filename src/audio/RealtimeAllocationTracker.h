@@ -0,0 +1,42 @@
+#pragma once
+#include <JuceHeader.h>
+
+// 디버그 빌드에서 오디오 콜백 중 힙 할당을 감지하는 추적기
+// - 릴리즈 빌드에서는 모든 기능이 빈 인라인 함수로 사라짐
+// - malloc/calloc/realloc 가로채기(macOS 기본 존, glibc)는 RealtimeAllocationTracker.cpp 한 곳에서만 수행
+//   → operator new뿐 아니라 HeapBlock을 쓰는 JUCE 컨테이너(MidiBuffer, Array, AudioBuffer)의 할당도 잡힘
+namespace RealtimeAllocationTracker {
+
+#if JUCE_DEBUG
+    // 콜백 진입/종료 (중첩 가능)
+    void enterRealtimeSection() noexcept;
+    void exitRealtimeSection() noexcept;
+
+    // 서드파티 코드(플러그인 processBlock 등)처럼 호스트가 통제할 수 없는 구간
+    void suspend() noexcept;
+    void resume() noexcept;
+
+    // 실시간 구간에서 발생한 할당 횟수 (모든 스레드 누적)
+    juce::uint64 getAllocationCount() noexcept;
+    void resetAllocationCount() noexcept;
+#else
+    inline void enterRealtimeSection() noexcept {}
+    inline void exitRealtimeSection() noexcept {}
+    inline void suspend() noexcept {}
+    inline void resume() noexcept {}
+    inline juce::uint64 getAllocationCount() noexcept { return 0; }
+    inline void resetAllocationCount() noexcept {}
+#endif
+
+    // getNextAudioBlock 전체를 감싸는 RAII 가드 - 이 안에서 할당이 일어나면 jassert
+    struct ScopedRealtimeSection {
+        ScopedRealtimeSection() noexcept { enterRealtimeSection(); }
+        ~ScopedRealtimeSection() noexcept { exitRealtimeSection(); }
+    };
+
+    // 실시간 구간 안에서 할당 검사를 잠시 끄는 RAII 가드
+    struct ScopedAllocationAllowed {
+        ScopedAllocationAllowed() noexcept { suspend(); }
+        ~ScopedAllocationAllowed() noexcept { resume(); }
+    };
+}
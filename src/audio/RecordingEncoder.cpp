@@ -0,0 +1,352 @@
+#if JUCE_WINDOWS || defined(_WIN32)
+ #include <io.h>
+ #include <fcntl.h>
+ #include <sys/stat.h>
+#else
+ #include <fcntl.h>
+ #include <unistd.h>
+ #include <sys/stat.h>
+ #include <cerrno>
+#endif
+
+#include "RecordingEncoder.h"
+
+namespace {
+    void writeTag(juce::uint8* dest, const char* tag) noexcept {
+        memcpy(dest, tag, 4);
+    }
+
+    void writeLE16(juce::uint8* dest, juce::uint16 value) noexcept {
+        dest[0] = (juce::uint8)(value & 0xff);
+        dest[1] = (juce::uint8)(value >> 8);
+    }
+
+    void writeLE32(juce::uint8* dest, juce::uint32 value) noexcept {
+        for (int i = 0; i < 4; ++i) dest[i] = (juce::uint8)(value >> (8 * i));
+    }
+
+    void writeLE64(juce::uint8* dest, juce::uint64 value) noexcept {
+        for (int i = 0; i < 8; ++i) dest[i] = (juce::uint8)(value >> (8 * i));
+    }
+
+    juce::uint32 readLE32(const juce::uint8* src) noexcept {
+        return (juce::uint32)src[0] | ((juce::uint32)src[1] << 8) | ((juce::uint32)src[2] << 16) | ((juce::uint32)src[3] << 24);
+    }
+
+    juce::uint16 readLE16(const juce::uint8* src) noexcept {
+        return (juce::uint16)(src[0] | (src[1] << 8));
+    }
+
+    bool hasTag(const juce::uint8* src, const char* tag) noexcept {
+        return memcmp(src, tag, 4) == 0;
+    }
+
+    // 32비트 크기 필드에 담을 수 있는 최대값 (이보다 크면 RF64 필요)
+    constexpr juce::uint64 maxRiffSize = 0xffffffffull;
+}
+
+//==============================================================================
+std::unique_ptr<RecordingEncoder> RecordingEncoder::create(RecordingFormat format) {
+    switch (format) {
+        case RecordingFormat::pcm24:   return std::make_unique<WavRecordingEncoder>(WavRecordingEncoder::SampleFormat::int24, false);
+        case RecordingFormat::float32: return std::make_unique<WavRecordingEncoder>(WavRecordingEncoder::SampleFormat::float32, false);
+        case RecordingFormat::rf64:    return std::make_unique<WavRecordingEncoder>(WavRecordingEncoder::SampleFormat::int24, true);
+        case RecordingFormat::flac:    return std::make_unique<FlacRecordingEncoder>();
+        case RecordingFormat::pcm16:
+        case RecordingFormat::numFormats:
+        default:                       return std::make_unique<WavRecordingEncoder>(WavRecordingEncoder::SampleFormat::int16, false);
+    }
+}
+
+juce::String RecordingEncoder::getFormatName(RecordingFormat format) {
+    switch (format) {
+        case RecordingFormat::pcm16:   return "WAV 16-bit";
+        case RecordingFormat::pcm24:   return "WAV 24-bit";
+        case RecordingFormat::float32: return "WAV 32-bit float";
+        case RecordingFormat::rf64:    return "RF64 24-bit";
+        case RecordingFormat::flac:    return "FLAC 24-bit";
+        case RecordingFormat::numFormats:
+        default:                       return {};
+    }
+}
+
+juce::String RecordingEncoder::getFileExtension(RecordingFormat format) {
+    return format == RecordingFormat::flac ? ".flac" : ".wav";
+}
+
+//==============================================================================
+#if JUCE_WINDOWS || defined(_WIN32)
+bool RecordingFile::open(const juce::File& file, bool truncate) {
+    close();
+    fd = _wopen(file.getFullPathName().toWideCharPointer(),
+                _O_RDWR | _O_BINARY | _O_CREAT | (truncate ? _O_TRUNC : 0), _S_IREAD | _S_IWRITE);
+    return fd >= 0;
+}
+
+void RecordingFile::close() {
+    if (fd >= 0) _close(fd);
+    fd = -1;
+}
+
+bool RecordingFile::append(const void* data, size_t numBytes) {
+    return fd >= 0 && _lseeki64(fd, 0, SEEK_END) >= 0 && _write(fd, data, (unsigned int)numBytes) == (int)numBytes;
+}
+
+bool RecordingFile::writeAt(juce::int64 offset, const void* data, size_t numBytes) {
+    // Windows에는 pwrite가 없으므로 위치를 옮겨 쓰고 append가 다시 끝으로 이동
+    return fd >= 0 && _lseeki64(fd, offset, SEEK_SET) >= 0 && _write(fd, data, (unsigned int)numBytes) == (int)numBytes;
+}
+
+bool RecordingFile::readAt(juce::int64 offset, void* data, size_t numBytes) const {
+    return fd >= 0 && _lseeki64(fd, offset, SEEK_SET) >= 0 && _read(fd, data, (unsigned int)numBytes) == (int)numBytes;
+}
+
+juce::int64 RecordingFile::getSize() const {
+    return fd >= 0 ? _filelengthi64(fd) : -1;
+}
+#else
+bool RecordingFile::open(const juce::File& file, bool truncate) {
+    close();
+    fd = ::open(file.getFullPathName().toRawUTF8(), O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), 0644);
+    return fd >= 0;
+}
+
+void RecordingFile::close() {
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+}
+
+bool RecordingFile::append(const void* data, size_t numBytes) {
+    if (fd < 0) return false;
+    auto* bytes = static_cast<const char*>(data);
+    while (numBytes > 0) {
+        const auto written = ::write(fd, bytes, numBytes);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        bytes += written;
+        numBytes -= (size_t)written;
+    }
+    return true;
+}
+
+bool RecordingFile::writeAt(juce::int64 offset, const void* data, size_t numBytes) {
+    // 파일 위치를 바꾸지 않으므로 이어지는 append에 영향 없음
+    return fd >= 0 && ::pwrite(fd, data, numBytes, (off_t)offset) == (ssize_t)numBytes;
+}
+
+bool RecordingFile::readAt(juce::int64 offset, void* data, size_t numBytes) const {
+    return fd >= 0 && ::pread(fd, data, numBytes, (off_t)offset) == (ssize_t)numBytes;
+}
+
+juce::int64 RecordingFile::getSize() const {
+    struct stat info;
+    return (fd >= 0 && fstat(fd, &info) == 0) ? (juce::int64)info.st_size : -1;
+}
+#endif
+
+//==============================================================================
+WavRecordingEncoder::WavRecordingEncoder(SampleFormat sampleFormatToUse, bool alwaysRF64)
+    : sampleFormat(sampleFormatToUse), forceRF64(alwaysRF64) {}
+
+WavRecordingEncoder::~WavRecordingEncoder() {
+    finish();
+}
+
+int WavRecordingEncoder::getBytesPerSample() const noexcept {
+    switch (sampleFormat) {
+        case SampleFormat::int24:   return 3;
+        case SampleFormat::float32: return 4;
+        case SampleFormat::int16:
+        default:                    return 2;
+    }
+}
+
+bool WavRecordingEncoder::open(const juce::File& target, double newSampleRate, int newNumChannels, int maxBlockFrames) {
+    finish();
+
+    sampleRate = newSampleRate;
+    numChannels = juce::jlimit(1, SampleConversion::MAX_CHANNELS, newNumChannels);
+    framesWritten = 0;
+
+    interleavedSize = (size_t)maxBlockFrames * (size_t)numChannels * (size_t)getBytesPerSample();
+    interleaved.allocate(interleavedSize, true);
+    silence.calloc((size_t)maxBlockFrames);
+
+    if (!file.open(target, true)) return false;
+
+    // 크기 0인 헤더를 먼저 기록 (commit/finish에서 실제 크기로 갱신)
+    juce::uint8 header[HEADER_SIZE];
+    buildHeader(header, sampleFormat == SampleFormat::float32 ? 3 : 1, numChannels, (juce::uint32)sampleRate,
+                getBytesPerSample(), 0, forceRF64);
+    return file.append(header, HEADER_SIZE);
+}
+
+bool WavRecordingEncoder::write(const juce::AudioBuffer<float>& source, int numFrames) {
+    if (!file.isOpen() || numFrames <= 0) return false;
+
+    const int bytesPerSample = getBytesPerSample();
+    const size_t numBytes = (size_t)numFrames * (size_t)numChannels * (size_t)bytesPerSample;
+    if (numBytes > interleavedSize) {
+        jassertfalse; // open에서 지정한 maxBlockFrames보다 큰 블록
+        return false;
+    }
+
+    // 인코더 채널 수보다 적은 소스 채널은 무음으로 채움
+    const float* channels[SampleConversion::MAX_CHANNELS];
+    for (int ch = 0; ch < numChannels; ++ch) {
+        channels[ch] = ch < source.getNumChannels() ? source.getReadPointer(ch) : silence.get();
+    }
+
+    // float → 대상 포맷 변환 및 인터리브 (쓰기 스레드)
+    auto* out = interleaved.getData();
+    switch (sampleFormat) {
+        case SampleFormat::int16:
+            SampleConversion::floatToInt16Interleaved(channels, numChannels, numFrames, reinterpret_cast<juce::int16*>(out), &dither);
+            break;
+        case SampleFormat::int24:
+            SampleConversion::floatToInt24Interleaved(channels, numChannels, numFrames, reinterpret_cast<juce::uint8*>(out));
+            break;
+        case SampleFormat::float32:
+            SampleConversion::floatToFloat32Interleaved(channels, numChannels, numFrames, reinterpret_cast<float*>(out));
+            break;
+    }
+
+    if (!file.append(out, numBytes)) return false;
+    framesWritten += numFrames;
+    return true;
+}
+
+bool WavRecordingEncoder::commit() {
+    // 데이터는 이미 write()로 커널에 넘어갔으므로 헤더 80바이트만 제자리에 덮어씀
+    return file.isOpen() && writeHeader();
+}
+
+bool WavRecordingEncoder::finish() {
+    if (!file.isOpen()) return true;
+
+    // RIFF 청크는 짝수 바이트 정렬 - 데이터 길이가 홀수면(모노 24비트, 홀수 프레임) 0 패드 바이트를 덧붙임
+    // (헤더의 RIFF/ds64 크기는 commit 때부터 패드를 포함, data 청크 크기는 포함하지 않음)
+    bool ok = true;
+    const juce::uint64 dataBytes = (juce::uint64)framesWritten * (juce::uint64)numChannels * (juce::uint64)getBytesPerSample();
+    if ((dataBytes & 1) != 0) {
+        const juce::uint8 pad = 0;
+        ok = file.append(&pad, 1);
+    }
+
+    ok = writeHeader() && ok;
+    file.close();
+    return ok;
+}
+
+bool WavRecordingEncoder::writeHeader() {
+    juce::uint8 header[HEADER_SIZE];
+    buildHeader(header, sampleFormat == SampleFormat::float32 ? 3 : 1, numChannels, (juce::uint32)sampleRate,
+                getBytesPerSample(), framesWritten, forceRF64);
+    return file.writeAt(0, header, HEADER_SIZE);
+}
+
+juce::int64 WavRecordingEncoder::repairFile(const juce::File& target) {
+    RecordingFile file;
+    if (!file.open(target, false)) return -1;
+
+    juce::uint8 header[HEADER_SIZE];
+    const auto fileSize = file.getSize();
+    if (fileSize < HEADER_SIZE || !file.readAt(0, header, HEADER_SIZE)) return -1;
+
+    // 이 인코더가 쓰는 고정 배치인지 확인
+    if (!(hasTag(header, "RIFF") || hasTag(header, "RF64")) || !hasTag(header + 8, "WAVE")
+        || !(hasTag(header + 12, "JUNK") || hasTag(header + 12, "ds64"))
+        || !hasTag(header + 48, "fmt ") || !hasTag(header + 72, "data")) {
+        return -1;
+    }
+
+    const int formatTag = readLE16(header + 56);
+    const int numChannels = readLE16(header + 58);
+    const auto sampleRate = readLE32(header + 60);
+    const int bytesPerSample = readLE16(header + 70) / 8;
+    const int blockAlign = numChannels * bytesPerSample;
+    if (blockAlign <= 0) return -1;
+
+    // 마지막 불완전 프레임은 버림 (데이터 길이가 홀수면 그 자리에 finish처럼 패드 바이트)
+    const juce::int64 frames = (fileSize - HEADER_SIZE) / blockAlign;
+    const juce::int64 dataBytes = frames * blockAlign;
+    if ((dataBytes & 1) != 0) {
+        const juce::uint8 pad = 0;
+        if (!file.writeAt(HEADER_SIZE + dataBytes, &pad, 1)) return -1;
+    }
+
+    buildHeader(header, formatTag, numChannels, sampleRate, bytesPerSample, frames, hasTag(header, "RF64"));
+    return file.writeAt(0, header, HEADER_SIZE) ? frames : -1;
+}
+
+void WavRecordingEncoder::buildHeader(juce::uint8* dest, int formatTag, int numChannels, juce::uint32 sampleRate,
+                                      int bytesPerSample, juce::int64 frames, bool forceRF64) {
+    const juce::uint64 dataBytes = (juce::uint64)frames * (juce::uint64)numChannels * (juce::uint64)bytesPerSample;
+    // 홀수 길이 data 청크 뒤의 패드 바이트는 RIFF 크기에만 포함
+    const juce::uint64 riffBytes = (juce::uint64)HEADER_SIZE - 8 + dataBytes + (dataBytes & 1);
+    const bool isRF64 = forceRF64 || riffBytes > maxRiffSize;
+
+    memset(dest, 0, HEADER_SIZE);
+
+    // RIFF/RF64 헤더
+    writeTag(dest, isRF64 ? "RF64" : "RIFF");
+    writeLE32(dest + 4, isRF64 ? 0xffffffffu : (juce::uint32)riffBytes);
+    writeTag(dest + 8, "WAVE");
+
+    // ds64 (RF64) 또는 같은 크기의 JUNK 예약 청크
+    writeTag(dest + 12, isRF64 ? "ds64" : "JUNK");
+    writeLE32(dest + 16, 28);
+    if (isRF64) {
+        writeLE64(dest + 20, riffBytes);
+        writeLE64(dest + 28, dataBytes);
+        writeLE64(dest + 36, (juce::uint64)frames);
+        writeLE32(dest + 44, 0); // 추가 청크 크기 테이블 없음
+    }
+
+    // fmt (1 = PCM, 3 = IEEE float)
+    writeTag(dest + 48, "fmt ");
+    writeLE32(dest + 52, 16);
+    writeLE16(dest + 56, (juce::uint16)formatTag);
+    writeLE16(dest + 58, (juce::uint16)numChannels);
+    writeLE32(dest + 60, sampleRate);
+    writeLE32(dest + 64, sampleRate * (juce::uint32)(numChannels * bytesPerSample));
+    writeLE16(dest + 68, (juce::uint16)(numChannels * bytesPerSample));
+    writeLE16(dest + 70, (juce::uint16)(bytesPerSample * 8));
+
+    // data
+    writeTag(dest + 72, "data");
+    writeLE32(dest + 76, isRF64 ? 0xffffffffu : (juce::uint32)dataBytes);
+}
+
+//==============================================================================
+bool FlacRecordingEncoder::open(const juce::File& file, double sampleRate, int numChannels, int) {
+    finish();
+    framesWritten = 0;
+
+    file.deleteFile();
+    auto stream = std::make_unique<juce::FileOutputStream>(file);
+    if (stream->failedToOpen()) return false;
+
+    juce::FlacAudioFormat flac;
+    writer.reset(flac.createWriterFor(stream.get(), sampleRate, (unsigned int)juce::jmax(1, numChannels),
+                                      BITS_PER_SAMPLE, {}, 0));
+    if (writer == nullptr) return false;
+
+    stream.release(); // writer가 소유
+    return true;
+}
+
+bool FlacRecordingEncoder::write(const juce::AudioBuffer<float>& source, int numFrames) {
+    if (writer == nullptr || numFrames <= 0) return false;
+    if (!writer->writeFromAudioSampleBuffer(source, 0, numFrames)) return false;
+    framesWritten += numFrames;
+    return true;
+}
+
+bool FlacRecordingEncoder::finish() {
+    // AudioFormatWriter 소멸 시 STREAMINFO(총 샘플 수 등)가 기록됨
+    writer.reset();
+    return true;
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <JuceHeader.h>
+#include "SampleConversion.h"
+
+// 녹음 파일 포맷
+enum class RecordingFormat {
+    pcm16 = 0,      // 16비트 PCM WAV (기존 기본값)
+    pcm24,          // 24비트 PCM WAV
+    float32,        // 32비트 float WAV
+    rf64,           // 24비트 PCM RF64 (처음부터 64비트 크기 필드, 4 GB 이상 세션용)
+    flac,           // FLAC 24비트 (juce::FlacAudioFormat)
+    numFormats
+};
+
+// 녹음 쓰기 스레드의 인코딩 단계
+// - open/finish는 녹음 시작/정지 시 호출, write는 쓰기 스레드에서만 호출 (오디오 스레드는 관여하지 않음)
+// - 모든 크기는 64비트로 계산하므로 긴 세션에서도 넘치지 않음
+class RecordingEncoder {
+public:
+    virtual ~RecordingEncoder() = default;
+
+    // maxBlockFrames: write 한 번에 넘길 최대 프레임 수 (변환 버퍼를 여기서 미리 할당)
+    virtual bool open(const juce::File& file, double sampleRate, int numChannels, int maxBlockFrames) = 0;
+
+    // 쓰기 스레드: 비인터리브 float 블록을 변환해 기록
+    virtual bool write(const juce::AudioBuffer<float>& source, int numFrames) = 0;
+
+    // 쓰기 스레드: 지금까지 기록한 크기로 헤더만 갱신 (비정상 종료 시에도 파일을 열 수 있도록)
+    // 기본 구현은 아무것도 하지 않음 (FLAC 등 스트림 포맷)
+    virtual bool commit() { return true; }
+
+    // 헤더 크기 확정 후 파일 닫기
+    virtual bool finish() = 0;
+
+    virtual juce::int64 getFramesWritten() const = 0;
+
+    static std::unique_ptr<RecordingEncoder> create(RecordingFormat format);
+    static juce::String getFormatName(RecordingFormat format);
+    static juce::String getFileExtension(RecordingFormat format);
+};
+
+// 덧붙여 쓰기와 위치 지정 쓰기(pwrite)만 하는 최소 파일 핸들
+// - 헤더 커밋이 데이터 쓰기 위치를 옮기거나 버퍼를 비우지(fsync) 않도록 직접 디스크립터를 다룸
+class RecordingFile {
+public:
+    RecordingFile() = default;
+    ~RecordingFile() { close(); }
+
+    bool open(const juce::File& file, bool truncate);
+    void close();
+    bool isOpen() const noexcept { return fd >= 0; }
+
+    bool append(const void* data, size_t numBytes);
+    bool writeAt(juce::int64 offset, const void* data, size_t numBytes);
+    bool readAt(juce::int64 offset, void* data, size_t numBytes) const;
+    juce::int64 getSize() const;
+
+private:
+    int fd = -1;
+
+    JUCE_DECLARE_NON_COPYABLE(RecordingFile)
+};
+
+// WAV/RF64 인코더 (PCM 16/24비트, 32비트 float) - 녹음과 오프라인 렌더가 함께 사용
+// - 변환은 SampleConversion 커널 (16비트는 SIMD + TPDF 디더)
+// - 헤더에 ds64 크기만큼 JUNK 청크를 예약해 두고, 데이터가 4 GB를 넘으면 finish에서 RF64로 승격
+//   (EBU Tech 3306 방식 - 4 GB 이하 파일은 일반 WAV로 그대로 읽힘)
+class WavRecordingEncoder : public RecordingEncoder {
+public:
+    enum class SampleFormat { int16, int24, float32 };
+
+    WavRecordingEncoder(SampleFormat sampleFormatToUse, bool alwaysRF64);
+    ~WavRecordingEncoder() override;
+
+    bool open(const juce::File& target, double sampleRate, int numChannels, int maxBlockFrames) override;
+    bool write(const juce::AudioBuffer<float>& source, int numFrames) override;
+    bool commit() override;
+    bool finish() override;
+    juce::int64 getFramesWritten() const override { return framesWritten; }
+
+    // 비정상 종료로 헤더 크기가 실제 데이터보다 작은 파일을 복구 (이 인코더가 쓴 헤더 구조일 때만)
+    // 복구된 프레임 수, 이 인코더의 파일이 아니면 -1
+    static juce::int64 repairFile(const juce::File& file);
+
+    // RIFF/WAVE + JUNK(ds64) + fmt + data 청크 헤더
+    static constexpr int HEADER_SIZE = 80;
+
+private:
+    static void buildHeader(juce::uint8* dest, int formatTag, int numChannels, juce::uint32 sampleRate,
+                            int bytesPerSample, juce::int64 frames, bool forceRF64);
+    bool writeHeader();
+    int getBytesPerSample() const noexcept;
+
+    const SampleFormat sampleFormat;
+    const bool forceRF64;
+
+    RecordingFile file;
+    double sampleRate = 44100.0;
+    int numChannels = 2;
+    juce::int64 framesWritten = 0;
+    juce::HeapBlock<char> interleaved;
+    size_t interleavedSize = 0;
+    juce::HeapBlock<float> silence;     // 소스 채널이 부족할 때 쓰는 무음
+    SampleConversion::Dither dither;    // 16비트 변환 시 TPDF 디더
+};
+
+// FLAC 인코더 - juce::AudioFormatWriter에 그대로 위임
+class FlacRecordingEncoder : public RecordingEncoder {
+public:
+    bool open(const juce::File& file, double sampleRate, int numChannels, int maxBlockFrames) override;
+    bool write(const juce::AudioBuffer<float>& source, int numFrames) override;
+    bool finish() override;
+    juce::int64 getFramesWritten() const override { return framesWritten; }
+
+    static constexpr int BITS_PER_SAMPLE = 24;
+
+private:
+    std::unique_ptr<juce::AudioFormatWriter> writer;
+    juce::int64 framesWritten = 0;
+};
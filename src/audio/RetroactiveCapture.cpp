@@ -0,0 +1,96 @@
+#include "RetroactiveCapture.h"
+#include "SampleConversion.h"
+
+void RetroactiveCaptureBuffer::allocate(int newNumChannels, int capacityFrames, Storage storageToUse) {
+    numChannels = juce::jlimit(1, SampleConversion::MAX_CHANNELS, newNumChannels);
+    storageType = storageToUse;
+    capacity = juce::jmax(0, capacityFrames);
+    storage.calloc((size_t)capacity * getBytesPerFrame());
+    writePosition.store(0, std::memory_order_release);
+}
+
+size_t RetroactiveCaptureBuffer::getBytesPerFrame() const noexcept {
+    return (size_t)numChannels * (storageType == Storage::int16 ? sizeof(juce::int16) : sizeof(float));
+}
+
+void RetroactiveCaptureBuffer::reset(double newSampleRate) noexcept {
+    if (newSampleRate != sampleRate.load(std::memory_order_relaxed)) {
+        writePosition.store(0, std::memory_order_release);
+        sampleRate.store(newSampleRate, std::memory_order_relaxed);
+    }
+}
+
+juce::int64 RetroactiveCaptureBuffer::getOldestReadablePosition() const noexcept {
+    return juce::jmax((juce::int64)0, getWritePosition() - capacity + WRITE_GUARD_FRAMES);
+}
+
+void RetroactiveCaptureBuffer::push(const float* const* channelData, int numSourceChannels, int numSamples) noexcept {
+    if (capacity == 0 || channelData == nullptr || numSourceChannels <= 0 || numSamples <= 0) return;
+
+    // 소스 채널이 부족하면 첫 채널을 복제 (모노 → 스테레오)
+    const float* channels[SampleConversion::MAX_CHANNELS];
+    for (int ch = 0; ch < numChannels; ++ch) {
+        channels[ch] = channelData[ch < numSourceChannels ? ch : 0];
+    }
+
+    // 블록이 링보다 길면 마지막 부분만 남음
+    const int skip = juce::jmax(0, numSamples - capacity);
+    const int toWrite = numSamples - skip;
+    const auto position = writePosition.load(std::memory_order_relaxed) + skip;
+    const int ringIndex = (int)(position % capacity);
+
+    const int firstPart = juce::jmin(toWrite, capacity - ringIndex);
+    writeFrames(channels, skip, ringIndex, firstPart);
+    if (firstPart < toWrite) {
+        writeFrames(channels, skip + firstPart, 0, toWrite - firstPart);
+    }
+
+    writePosition.store(position + toWrite, std::memory_order_release);
+}
+
+void RetroactiveCaptureBuffer::writeFrames(const float* const* channels, int frameOffset, int ringIndex, int numFrames) noexcept {
+    const float* offsetChannels[SampleConversion::MAX_CHANNELS];
+    for (int ch = 0; ch < numChannels; ++ch) {
+        offsetChannels[ch] = channels[ch] + frameOffset;
+    }
+
+    if (storageType == Storage::int16) {
+        auto* dest = reinterpret_cast<juce::int16*>(storage.getData()) + (size_t)ringIndex * (size_t)numChannels;
+        SampleConversion::floatToInt16Interleaved(offsetChannels, numChannels, numFrames, dest);
+    } else {
+        auto* dest = reinterpret_cast<float*>(storage.getData()) + (size_t)ringIndex * (size_t)numChannels;
+        SampleConversion::floatToFloat32Interleaved(offsetChannels, numChannels, numFrames, dest);
+    }
+}
+
+bool RetroactiveCaptureBuffer::read(juce::int64 startPosition, juce::AudioBuffer<float>& dest, int numFrames) const {
+    if (capacity == 0 || startPosition < getOldestReadablePosition()
+        || startPosition + numFrames > getWritePosition() || numFrames > dest.getNumSamples()) {
+        return false;
+    }
+
+    constexpr float int16ToFloat = 1.0f / 32768.0f;
+    const int destChannels = dest.getNumChannels();
+
+    for (int done = 0; done < numFrames;) {
+        const int ringIndex = (int)((startPosition + done) % capacity);
+        const int n = juce::jmin(numFrames - done, capacity - ringIndex);
+
+        for (int ch = 0; ch < destChannels; ++ch) {
+            float* out = dest.getWritePointer(ch, done);
+            const int srcChannel = juce::jmin(ch, numChannels - 1);
+
+            if (storageType == Storage::int16) {
+                const auto* src = reinterpret_cast<const juce::int16*>(storage.getData()) + (size_t)ringIndex * (size_t)numChannels + srcChannel;
+                for (int i = 0; i < n; ++i) out[i] = src[(size_t)i * (size_t)numChannels] * int16ToFloat;
+            } else {
+                const auto* src = reinterpret_cast<const float*>(storage.getData()) + (size_t)ringIndex * (size_t)numChannels + srcChannel;
+                for (int i = 0; i < n; ++i) out[i] = src[(size_t)i * (size_t)numChannels];
+            }
+        }
+        done += n;
+    }
+
+    // 복사하는 동안 오디오 스레드가 시작 구간까지 따라왔으면 내용을 믿을 수 없음
+    return startPosition >= getOldestReadablePosition();
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+
+// 항상 켜져 있는 "지난 N초" 캡처 링 (플러그인 처리 후 출력)
+// - 메모리는 allocate에서 한 번만 잡고 이후 크기가 바뀌지 않음
+// - push는 오디오 스레드 (할당/락 없음), read는 쓰기/덤프 스레드
+// - int16 인터리브로 저장하면 float 대비 절반 크기
+// - 위치는 링 시작 이후 누적 프레임 번호 (64비트, 되감기지 않음)
+class RetroactiveCaptureBuffer {
+public:
+    enum class Storage { int16, float32 };
+
+    // 메시지 스레드, 시작 시 한 번
+    void allocate(int numChannels, int capacityFrames, Storage storageToUse);
+
+    // prepareToPlay에서 호출 (오디오 콜백이 멈춘 상태) - 샘플레이트가 바뀌면 이전 내용은 버림
+    void reset(double newSampleRate) noexcept;
+
+    // 오디오 스레드: 블록 추가 (가장 오래된 프레임을 덮어씀)
+    void push(const float* const* channelData, int numSourceChannels, int numSamples) noexcept;
+
+    // 다음에 기록될 프레임 번호 (= 지금까지 기록된 프레임 수)
+    juce::int64 getWritePosition() const noexcept { return writePosition.load(std::memory_order_acquire); }
+
+    // 덮어쓰기 전에 읽을 수 있다고 보장되는 가장 오래된 프레임 번호
+    juce::int64 getOldestReadablePosition() const noexcept;
+
+    // [startPosition, startPosition + numFrames)를 dest의 0번 위치부터 float로 복사
+    // 복사 중 오디오 스레드가 해당 구간을 덮어썼으면 false
+    bool read(juce::int64 startPosition, juce::AudioBuffer<float>& dest, int numFrames) const;
+
+    bool isAllocated() const noexcept { return capacity > 0; }
+    int getNumChannels() const noexcept { return numChannels; }
+    int getCapacity() const noexcept { return capacity; }
+    double getSampleRate() const noexcept { return sampleRate.load(std::memory_order_relaxed); }
+
+    // 한 번의 push로 덮어쓸 수 있는 최대 프레임 수 - 이만큼은 읽기 여유로 남김
+    static constexpr int WRITE_GUARD_FRAMES = 8192;
+
+private:
+    void writeFrames(const float* const* channels, int frameOffset, int ringIndex, int numFrames) noexcept;
+    size_t getBytesPerFrame() const noexcept;
+
+    juce::HeapBlock<char> storage;
+    Storage storageType = Storage::int16;
+    int numChannels = 0;
+    int capacity = 0;
+
+    std::atomic<juce::int64> writePosition { 0 };
+    std::atomic<double> sampleRate { 0.0 };
+};
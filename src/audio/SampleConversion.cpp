@@ -0,0 +1,325 @@
+#include "SampleConversion.h"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <immintrin.h>
+ #define CLEARHOST_SSE2 1
+ // AVX2는 빌드 플래그 없이 함수 단위로 켜고 실행 시 CPU 지원 여부로 선택
+ #if defined(__GNUC__) || defined(__clang__)
+  #define CLEARHOST_AVX2 1
+  #define CLEARHOST_AVX2_TARGET __attribute__((target("avx2")))
+ #endif
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+ #include <arm_neon.h>
+ #define CLEARHOST_NEON 1
+#endif
+
+namespace SampleConversion {
+
+namespace {
+    constexpr float int16Scale = 32767.0f;
+    constexpr float int24Scale = 8388607.0f;
+
+    // 연속된 한 채널 변환 (dither는 nullptr 가능)
+    using ConvertFn = void (*)(const float* src, const float* dither, juce::int16* dest, int n) noexcept;
+    // 스테레오 변환 + 인터리브
+    using StereoFn = void (*)(const float* left, const float* right, const float* ditherL, const float* ditherR,
+                              juce::int16* dest, int n) noexcept;
+
+    struct Int16Kernel {
+        const char* name;
+        ConvertFn convert;
+        StereoFn stereo;
+    };
+
+    //==========================================================================
+    // NaN은 모든 경로에서 0 (플러그인이 NaN을 내도 풀스케일 클릭이 되지 않도록 - SIMD min/max는 NaN을 한쪽 끝으로 보냄)
+    inline float zeroIfNaN(float sample) noexcept {
+        return std::isnan(sample) ? 0.0f : sample;
+    }
+
+    // 스칼라
+    inline juce::int16 convertSample(float sample, float dither) noexcept {
+        // 곱과 덧셈을 나눠 FMA로 합쳐지지 않게 함 (SIMD 경로와 같은 반올림)
+        const float clipped = juce::jlimit(-1.0f, 1.0f, zeroIfNaN(sample)) * int16Scale;
+        const float scaled = clipped + dither;
+        return (juce::int16)juce::jlimit(-32768, 32767, juce::roundToInt(scaled));
+    }
+
+    void convertScalar(const float* src, const float* dither, juce::int16* dest, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            dest[i] = convertSample(src[i], dither != nullptr ? dither[i] : 0.0f);
+        }
+    }
+
+    void stereoScalar(const float* left, const float* right, const float* ditherL, const float* ditherR,
+                      juce::int16* dest, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            dest[2 * i]     = convertSample(left[i], ditherL != nullptr ? ditherL[i] : 0.0f);
+            dest[2 * i + 1] = convertSample(right[i], ditherR != nullptr ? ditherR[i] : 0.0f);
+        }
+    }
+
+    //==========================================================================
+   #if CLEARHOST_SSE2
+    // NaN 레인을 0으로 (cmpord는 NaN이 아닌 레인만 모든 비트가 1)
+    inline __m128 sse2ZeroNaN(__m128 x) noexcept {
+        return _mm_and_ps(x, _mm_cmpord_ps(x, x));
+    }
+
+    // 8개 샘플 → int16 8개 (packs가 포화 처리하므로 디더로 범위를 넘어도 안전)
+    inline __m128i sse2Convert8(const float* src, const float* dither) noexcept {
+        const __m128 lo = _mm_set1_ps(-1.0f), hi = _mm_set1_ps(1.0f), scale = _mm_set1_ps(int16Scale);
+        __m128 a = _mm_mul_ps(_mm_max_ps(_mm_min_ps(sse2ZeroNaN(_mm_loadu_ps(src)), hi), lo), scale);
+        __m128 b = _mm_mul_ps(_mm_max_ps(_mm_min_ps(sse2ZeroNaN(_mm_loadu_ps(src + 4)), hi), lo), scale);
+        if (dither != nullptr) {
+            a = _mm_add_ps(a, _mm_loadu_ps(dither));
+            b = _mm_add_ps(b, _mm_loadu_ps(dither + 4));
+        }
+        // cvtps는 기본 MXCSR(가장 가까운 짝수)로 반올림
+        return _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b));
+    }
+
+    void convertSSE2(const float* src, const float* dither, juce::int16* dest, int n) noexcept {
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), sse2Convert8(src + i, dither != nullptr ? dither + i : nullptr));
+        }
+        convertScalar(src + i, dither != nullptr ? dither + i : nullptr, dest + i, n - i);
+    }
+
+    void stereoSSE2(const float* left, const float* right, const float* ditherL, const float* ditherR,
+                    juce::int16* dest, int n) noexcept {
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m128i l = sse2Convert8(left + i, ditherL != nullptr ? ditherL + i : nullptr);
+            const __m128i r = sse2Convert8(right + i, ditherR != nullptr ? ditherR + i : nullptr);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 2 * i), _mm_unpacklo_epi16(l, r));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 2 * i + 8), _mm_unpackhi_epi16(l, r));
+        }
+        stereoScalar(left + i, right + i, ditherL != nullptr ? ditherL + i : nullptr,
+                     ditherR != nullptr ? ditherR + i : nullptr, dest + 2 * i, n - i);
+    }
+   #endif
+
+    //==========================================================================
+   #if CLEARHOST_AVX2
+    CLEARHOST_AVX2_TARGET inline __m256 avx2ZeroNaN(__m256 x) noexcept {
+        return _mm256_and_ps(x, _mm256_cmp_ps(x, x, _CMP_ORD_Q));
+    }
+
+    // 16개 샘플 → 순서대로 정렬된 int16 16개
+    CLEARHOST_AVX2_TARGET inline __m256i avx2Convert16(const float* src, const float* dither) noexcept {
+        const __m256 lo = _mm256_set1_ps(-1.0f), hi = _mm256_set1_ps(1.0f), scale = _mm256_set1_ps(int16Scale);
+        __m256 a = _mm256_mul_ps(_mm256_max_ps(_mm256_min_ps(avx2ZeroNaN(_mm256_loadu_ps(src)), hi), lo), scale);
+        __m256 b = _mm256_mul_ps(_mm256_max_ps(_mm256_min_ps(avx2ZeroNaN(_mm256_loadu_ps(src + 8)), hi), lo), scale);
+        if (dither != nullptr) {
+            a = _mm256_add_ps(a, _mm256_loadu_ps(dither));
+            b = _mm256_add_ps(b, _mm256_loadu_ps(dither + 8));
+        }
+        // packs는 128비트 레인 단위로 섞이므로 [a0-3 b0-3 | a4-7 b4-7] → [a0-7 b0-7]로 재배치
+        const __m256i packed = _mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b));
+        return _mm256_permute4x64_epi64(packed, 0xD8);
+    }
+
+    CLEARHOST_AVX2_TARGET void convertAVX2(const float* src, const float* dither, juce::int16* dest, int n) noexcept {
+        int i = 0;
+        for (; i + 16 <= n; i += 16) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), avx2Convert16(src + i, dither != nullptr ? dither + i : nullptr));
+        }
+        convertSSE2(src + i, dither != nullptr ? dither + i : nullptr, dest + i, n - i);
+    }
+
+    CLEARHOST_AVX2_TARGET void stereoAVX2(const float* left, const float* right, const float* ditherL, const float* ditherR,
+                                          juce::int16* dest, int n) noexcept {
+        int i = 0;
+        for (; i + 16 <= n; i += 16) {
+            const __m256i l = avx2Convert16(left + i, ditherL != nullptr ? ditherL + i : nullptr);
+            const __m256i r = avx2Convert16(right + i, ditherR != nullptr ? ditherR + i : nullptr);
+            // 레인별 unpack: lo = [L0-3R0-3 | L8-11R8-11], hi = [L4-7R4-7 | L12-15R12-15]
+            const __m256i lo = _mm256_unpacklo_epi16(l, r);
+            const __m256i hi = _mm256_unpackhi_epi16(l, r);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 2 * i), _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 2 * i + 16), _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+        stereoSSE2(left + i, right + i, ditherL != nullptr ? ditherL + i : nullptr,
+                   ditherR != nullptr ? ditherR + i : nullptr, dest + 2 * i, n - i);
+    }
+   #endif
+
+    //==========================================================================
+   #if CLEARHOST_NEON
+    // NaN 레인을 0으로 (vceqq(x, x)는 NaN이 아닌 레인만 모든 비트가 1)
+    inline float32x4_t neonZeroNaN(float32x4_t x) noexcept {
+        return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(x), vceqq_f32(x, x)));
+    }
+
+    inline int16x8_t neonConvert8(const float* src, const float* dither) noexcept {
+        const float32x4_t lo = vdupq_n_f32(-1.0f), hi = vdupq_n_f32(1.0f);
+        float32x4_t a = vmulq_n_f32(vmaxq_f32(vminq_f32(neonZeroNaN(vld1q_f32(src)), hi), lo), int16Scale);
+        float32x4_t b = vmulq_n_f32(vmaxq_f32(vminq_f32(neonZeroNaN(vld1q_f32(src + 4)), hi), lo), int16Scale);
+        if (dither != nullptr) {
+            a = vaddq_f32(a, vld1q_f32(dither));
+            b = vaddq_f32(b, vld1q_f32(dither + 4));
+        }
+        // vcvtnq: 가장 가까운 짝수로 반올림, vqmovn: 포화 축소
+        return vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(a)), vqmovn_s32(vcvtnq_s32_f32(b)));
+    }
+
+    void convertNEON(const float* src, const float* dither, juce::int16* dest, int n) noexcept {
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            vst1q_s16(dest + i, neonConvert8(src + i, dither != nullptr ? dither + i : nullptr));
+        }
+        convertScalar(src + i, dither != nullptr ? dither + i : nullptr, dest + i, n - i);
+    }
+
+    void stereoNEON(const float* left, const float* right, const float* ditherL, const float* ditherR,
+                    juce::int16* dest, int n) noexcept {
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            int16x8x2_t lr;
+            lr.val[0] = neonConvert8(left + i, ditherL != nullptr ? ditherL + i : nullptr);
+            lr.val[1] = neonConvert8(right + i, ditherR != nullptr ? ditherR + i : nullptr);
+            vst2q_s16(dest + 2 * i, lr); // 인터리브 저장
+        }
+        stereoScalar(left + i, right + i, ditherL != nullptr ? ditherL + i : nullptr,
+                     ditherR != nullptr ? ditherR + i : nullptr, dest + 2 * i, n - i);
+    }
+   #endif
+
+    //==========================================================================
+    Int16Kernel selectKernel() noexcept {
+       #if CLEARHOST_AVX2
+        if (juce::SystemStats::hasAVX2()) return { "AVX2", convertAVX2, stereoAVX2 };
+       #endif
+       #if CLEARHOST_SSE2
+        return { "SSE2", convertSSE2, stereoSSE2 };
+       #elif CLEARHOST_NEON
+        return { "NEON", convertNEON, stereoNEON };
+       #else
+        return { "scalar", convertScalar, stereoScalar };
+       #endif
+    }
+
+    const Int16Kernel& getKernel() noexcept {
+        static const Int16Kernel kernel = selectKernel();
+        return kernel;
+    }
+
+    const Int16Kernel scalarKernel { "scalar", convertScalar, stereoScalar };
+
+    // 3채널 이상: 채널별로 벡터 변환한 뒤 스택 버퍼에서 인터리브
+    void convertInterleaved(const Int16Kernel& kernel, const float* const* source, const float* const* dither,
+                            int numChannels, int numFrames, juce::int16* dest) noexcept {
+        if (numChannels == 1) {
+            kernel.convert(source[0], dither != nullptr ? dither[0] : nullptr, dest, numFrames);
+            return;
+        }
+        if (numChannels == 2) {
+            kernel.stereo(source[0], source[1], dither != nullptr ? dither[0] : nullptr,
+                          dither != nullptr ? dither[1] : nullptr, dest, numFrames);
+            return;
+        }
+
+        constexpr int chunk = 256;
+        juce::int16 temp[chunk];
+        for (int start = 0; start < numFrames; start += chunk) {
+            const int n = juce::jmin(chunk, numFrames - start);
+            for (int ch = 0; ch < numChannels; ++ch) {
+                kernel.convert(source[ch] + start, dither != nullptr ? dither[ch] + start : nullptr, temp, n);
+                juce::int16* out = dest + (size_t)start * (size_t)numChannels + (size_t)ch;
+                for (int i = 0; i < n; ++i) {
+                    out[(size_t)i * (size_t)numChannels] = temp[i];
+                }
+            }
+        }
+    }
+
+    void convertWithKernel(const Int16Kernel& kernel, const float* const* source, int numChannels, int numFrames,
+                           juce::int16* dest, Dither* dither) noexcept {
+        jassert(numChannels >= 1 && numChannels <= MAX_CHANNELS);
+        numChannels = juce::jlimit(1, MAX_CHANNELS, numChannels);
+
+        if (dither == nullptr) {
+            convertInterleaved(kernel, source, nullptr, numChannels, numFrames, dest);
+            return;
+        }
+
+        // 디더 테이블에서 연속으로 읽을 수 있는 길이 단위로 나눠 처리
+        for (int start = 0; start < numFrames; start += Dither::MAX_RUN) {
+            const int n = juce::jmin(Dither::MAX_RUN, numFrames - start);
+            const float* channels[MAX_CHANNELS];
+            const float* noise[MAX_CHANNELS];
+            for (int ch = 0; ch < numChannels; ++ch) {
+                channels[ch] = source[ch] + start;
+                noise[ch] = dither->next(n);
+            }
+            convertInterleaved(kernel, channels, noise, numChannels, n, dest + (size_t)start * (size_t)numChannels);
+        }
+    }
+}
+
+//==============================================================================
+Dither::Dither() : table((size_t)MAX_RUN * 2) {
+    fillTable();
+}
+
+Dither::Dither(juce::int64 seed) : table((size_t)MAX_RUN * 2), random(seed) {
+    fillTable();
+}
+
+void Dither::fillTable() {
+    for (auto& value : table) {
+        value = random.nextFloat() - random.nextFloat();
+    }
+}
+
+const float* Dither::next(int numSamples) noexcept {
+    jassert(numSamples <= MAX_RUN);
+    juce::ignoreUnused(numSamples);
+    return table.data() + random.nextInt(MAX_RUN);
+}
+
+void floatToInt16Interleaved(const float* const* source, int numChannels, int numFrames,
+                             juce::int16* dest, Dither* dither) noexcept {
+    convertWithKernel(getKernel(), source, numChannels, numFrames, dest, dither);
+}
+
+void floatToInt16InterleavedScalar(const float* const* source, int numChannels, int numFrames,
+                                   juce::int16* dest, Dither* dither) noexcept {
+    convertWithKernel(scalarKernel, source, numChannels, numFrames, dest, dither);
+}
+
+void floatToInt24Interleaved(const float* const* source, int numChannels, int numFrames, juce::uint8* dest) noexcept {
+    for (int ch = 0; ch < numChannels; ++ch) {
+        const float* src = source[ch];
+        juce::uint8* out = dest + ch * 3;
+        const size_t stride = (size_t)numChannels * 3;
+
+        for (int i = 0; i < numFrames; ++i, out += stride) {
+            const auto value = (juce::uint32)juce::roundToInt(juce::jlimit(-1.0f, 1.0f, zeroIfNaN(src[i])) * int24Scale);
+            out[0] = (juce::uint8)(value);
+            out[1] = (juce::uint8)(value >> 8);
+            out[2] = (juce::uint8)(value >> 16);
+        }
+    }
+}
+
+void floatToFloat32Interleaved(const float* const* source, int numChannels, int numFrames, float* dest) noexcept {
+    for (int ch = 0; ch < numChannels; ++ch) {
+        const float* src = source[ch];
+        float* out = dest + ch;
+        for (int i = 0; i < numFrames; ++i) {
+            out[(size_t)i * (size_t)numChannels] = src[i];
+        }
+    }
+}
+
+const char* getInt16KernelName() noexcept {
+    return getKernel().name;
+}
+
+}
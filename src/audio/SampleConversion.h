@@ -0,0 +1,46 @@
+#pragma once
+#include <JuceHeader.h>
+#include <vector>
+
+// float 비인터리브 → 파일용 인터리브 샘플 변환 (녹음 인코더, 오프라인 렌더 공용)
+// - int16: 실행 시 CPU에 맞춰 AVX2 / SSE2 / NEON / 스칼라 커널 중 하나를 선택
+//   NaN은 0 → ±1로 클립 → 스케일 → (선택) TPDF 디더 → 가장 가까운 정수로 반올림 → 인터리브
+// - 1~MAX_CHANNELS 채널, 할당/락 없음
+namespace SampleConversion {
+    static constexpr int MAX_CHANNELS = 8;
+
+    // ±1 LSB 삼각 분포(TPDF) 디더 노이즈
+    // - 테이블은 생성 시 한 번만 채우고, 변환 중에는 임의 위치에서 연속 구간을 읽기만 함
+    class Dither {
+    public:
+        Dither();
+        // 같은 시드면 같은 노이즈 순서 (커널 비교 테스트용)
+        explicit Dither(juce::int64 seed);
+
+        // numSamples(<= MAX_RUN) 개의 연속된 노이즈 (LSB 단위)
+        const float* next(int numSamples) noexcept;
+
+        static constexpr int MAX_RUN = 1 << 14;
+
+    private:
+        void fillTable();
+
+        std::vector<float> table;   // MAX_RUN * 2 (어느 시작 위치에서도 MAX_RUN개를 연속으로 읽을 수 있도록)
+        juce::Random random;
+    };
+
+    void floatToInt16Interleaved(const float* const* source, int numChannels, int numFrames,
+                                 juce::int16* dest, Dither* dither = nullptr) noexcept;
+
+    // 디스패치 없이 항상 스칼라 경로 (기준 구현)
+    void floatToInt16InterleavedScalar(const float* const* source, int numChannels, int numFrames,
+                                       juce::int16* dest, Dither* dither = nullptr) noexcept;
+
+    // 24비트 little-endian packed PCM
+    void floatToInt24Interleaved(const float* const* source, int numChannels, int numFrames, juce::uint8* dest) noexcept;
+
+    void floatToFloat32Interleaved(const float* const* source, int numChannels, int numFrames, float* dest) noexcept;
+
+    // 선택된 int16 커널 이름 ("AVX2", "SSE2", "NEON", "scalar")
+    const char* getInt16KernelName() noexcept;
+}
@@ -0,0 +1,224 @@
+#if defined(__APPLE__)
+ #include <CoreAudio/CoreAudio.h>
+ #include <map>
+#endif
+
+#include "SystemAudioRouter.h"
+#include "../app/AsyncLogger.h"
+
+#if JUCE_MAC
+namespace {
+    // kAudioObjectPropertyElementMain (macOS 12 이전 이름: ...ElementMaster) - 둘 다 0
+    constexpr AudioObjectPropertyElement elementMain = 0;
+
+    // CoreAudio HAL을 직접 호출하는 백엔드 - 프로세스 생성 없이 수 ms 이내에 끝남
+    class CoreAudioSystemRouter : public SystemAudioRouter {
+    public:
+        juce::String getBackendName() const override { return "CoreAudio"; }
+
+        bool isAvailable() override {
+            refreshDeviceCache();
+            return !deviceIds.empty();
+        }
+
+        juce::StringArray getOutputDevices() override {
+            refreshDeviceCache();
+            juce::StringArray names;
+            for (auto& entry : deviceIds) names.add(entry.first);
+            return names;
+        }
+
+        juce::String getDefaultOutputDevice() override {
+            AudioObjectPropertyAddress address { kAudioHardwarePropertyDefaultOutputDevice,
+                                                 kAudioObjectPropertyScopeGlobal, elementMain };
+            AudioObjectID deviceId = kAudioObjectUnknown;
+            UInt32 size = sizeof(deviceId);
+            if (AudioObjectGetPropertyData(kAudioObjectSystemObject, &address, 0, nullptr, &size, &deviceId) != noErr
+                || deviceId == kAudioObjectUnknown) {
+                return {};
+            }
+            return getDeviceName(deviceId);
+        }
+
+        bool setDefaultOutputDevice(const juce::String& deviceName) override {
+            // 캐시에서 먼저 찾고, 없으면(장치 연결/해제) 한 번만 다시 읽음
+            auto it = deviceIds.find(deviceName);
+            if (it == deviceIds.end()) {
+                refreshDeviceCache();
+                it = deviceIds.find(deviceName);
+                if (it == deviceIds.end()) return false;
+            }
+
+            AudioObjectPropertyAddress address { kAudioHardwarePropertyDefaultOutputDevice,
+                                                 kAudioObjectPropertyScopeGlobal, elementMain };
+            AudioObjectID deviceId = it->second;
+            if (AudioObjectSetPropertyData(kAudioObjectSystemObject, &address, 0, nullptr, sizeof(deviceId), &deviceId) == noErr) {
+                return true;
+            }
+
+            // 캐시된 ID가 오래되었을 수 있으므로 다음 호출에서 다시 읽도록 비움
+            deviceIds.clear();
+            return false;
+        }
+
+    private:
+        void refreshDeviceCache() {
+            deviceIds.clear();
+
+            AudioObjectPropertyAddress address { kAudioHardwarePropertyDevices,
+                                                 kAudioObjectPropertyScopeGlobal, elementMain };
+            UInt32 size = 0;
+            if (AudioObjectGetPropertyDataSize(kAudioObjectSystemObject, &address, 0, nullptr, &size) != noErr) return;
+
+            std::vector<AudioObjectID> ids(size / sizeof(AudioObjectID));
+            if (ids.empty()
+                || AudioObjectGetPropertyData(kAudioObjectSystemObject, &address, 0, nullptr, &size, ids.data()) != noErr) {
+                return;
+            }
+
+            for (auto id : ids) {
+                if (hasOutputStreams(id)) {
+                    auto name = getDeviceName(id);
+                    if (name.isNotEmpty()) deviceIds[name] = id;
+                }
+            }
+        }
+
+        static bool hasOutputStreams(AudioObjectID deviceId) {
+            AudioObjectPropertyAddress address { kAudioDevicePropertyStreams,
+                                                 kAudioObjectPropertyScopeOutput, elementMain };
+            UInt32 size = 0;
+            return AudioObjectGetPropertyDataSize(deviceId, &address, 0, nullptr, &size) == noErr && size > 0;
+        }
+
+        static juce::String getDeviceName(AudioObjectID deviceId) {
+            AudioObjectPropertyAddress address { kAudioObjectPropertyName,
+                                                 kAudioObjectPropertyScopeGlobal, elementMain };
+            CFStringRef name = nullptr;
+            UInt32 size = sizeof(name);
+            if (AudioObjectGetPropertyData(deviceId, &address, 0, nullptr, &size, &name) != noErr || name == nullptr) {
+                return {};
+            }
+            auto result = juce::String::fromCFString(name);
+            CFRelease(name);
+            return result;
+        }
+
+        std::map<juce::String, AudioObjectID> deviceIds;
+    };
+}
+#endif
+
+//==============================================================================
+std::unique_ptr<SystemAudioRouter> SystemAudioRouter::createDefault() {
+   #if JUCE_MAC
+    return std::make_unique<CoreAudioSystemRouter>();
+   #else
+    return nullptr;
+   #endif
+}
+
+//==============================================================================
+SystemAudioRoutingService::SystemAudioRoutingService() {
+    backends.push_back(SystemAudioRouter::createDefault());
+}
+
+SystemAudioRoutingService::SystemAudioRoutingService(std::vector<std::unique_ptr<SystemAudioRouter>> candidateBackends)
+    : backends(std::move(candidateBackends)) {}
+
+SystemAudioRoutingService::~SystemAudioRoutingService() {
+    // 대기 중인 작업은 버리고, 실행 중인 작업은 시간 제한 없이 끝날 때까지 기다림
+    // (작업이 this와 백엔드를 잡고 있으므로 제한 시간 후 먼저 파괴되면 해제된 메모리를 건드림)
+    worker.removeAllJobs(true, -1);
+}
+
+void SystemAudioRoutingService::addJob(std::function<void()> job) {
+    worker.addJob(std::move(job));
+}
+
+SystemAudioRouter* SystemAudioRoutingService::resolveBackend() {
+    if (cachedBackend != nullptr) return cachedBackend;
+
+    for (auto& backend : backends) {
+        if (backend != nullptr && backend->isAvailable()) {
+            cachedBackend = backend.get();
+            CLR_LOG_INFO("System audio routing backend: " + cachedBackend->getBackendName());
+            break;
+        }
+    }
+    return cachedBackend;
+}
+
+void SystemAudioRoutingService::getOutputDevices(std::function<void(juce::StringArray)> onComplete) {
+    addJob([this, onComplete] {
+        auto* backend = resolveBackend();
+        deliver(onComplete, backend != nullptr ? backend->getOutputDevices() : juce::StringArray());
+    });
+}
+
+void SystemAudioRoutingService::getDefaultOutputDevice(std::function<void(juce::String)> onComplete) {
+    addJob([this, onComplete] {
+        auto* backend = resolveBackend();
+        deliver(onComplete, backend != nullptr ? backend->getDefaultOutputDevice() : juce::String());
+    });
+}
+
+void SystemAudioRoutingService::setDefaultOutputDevice(const juce::String& deviceName, std::function<void(bool)> onComplete) {
+    addJob([this, deviceName, onComplete] {
+        auto* backend = resolveBackend();
+        const bool success = backend != nullptr && backend->setDefaultOutputDevice(deviceName);
+        CLR_LOG_INFO(success ? "System output set to: " + deviceName
+                             : "Failed to set system output to: " + deviceName);
+        deliver(onComplete, success);
+    });
+}
+
+void SystemAudioRoutingService::saveDefaultOutputDevice(const juce::String& fallbackDevice, std::function<void(juce::String)> onComplete) {
+    addJob([this, fallbackDevice, onComplete] {
+        auto* backend = resolveBackend();
+        auto device = backend != nullptr ? backend->getDefaultOutputDevice() : juce::String();
+
+        if (device.isNotEmpty()) {
+            CLR_LOG_INFO("Saved current system output device: " + device);
+        } else {
+            device = fallbackDevice;
+            CLR_LOG_WARNING("Failed to get current device, using default: " + device);
+        }
+
+        savedOutputDevice = device;
+        deliver(onComplete, device);
+    });
+}
+
+void SystemAudioRoutingService::restoreSavedOutputDevice(std::function<void(bool)> onComplete) {
+    addJob([this, onComplete] {
+        deliver(onComplete, restoreSavedOnWorker());
+    });
+}
+
+bool SystemAudioRoutingService::restoreSavedOutputDeviceAndWait(int timeoutMs) {
+    auto done = std::make_shared<juce::WaitableEvent>();
+    auto success = std::make_shared<std::atomic<bool>>(false);
+
+    addJob([this, done, success] {
+        success->store(restoreSavedOnWorker());
+        done->signal();
+    });
+
+    return done->wait(timeoutMs) && success->load();
+}
+
+bool SystemAudioRoutingService::restoreSavedOnWorker() {
+    if (savedOutputDevice.isEmpty()) {
+        CLR_LOG_INFO("No saved system output device to restore");
+        return false;
+    }
+
+    CLR_LOG_INFO("Restoring system output device to: " + savedOutputDevice);
+    auto* backend = resolveBackend();
+    const bool success = backend != nullptr && backend->setDefaultOutputDevice(savedOutputDevice);
+    if (!success) {
+        CLR_LOG_ERROR("Failed to restore system output device");
+    }
+    return success;
+}
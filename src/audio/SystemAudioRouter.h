@@ -0,0 +1,66 @@
+#pragma once
+#include <JuceHeader.h>
+#include <functional>
+
+// OS 기본 출력 장치 조회/변경 백엔드 (SwitchAudioSource 셸 호출 대체)
+// - 모든 함수는 블로킹이므로 SystemAudioRoutingService의 워커 스레드에서만 호출
+class SystemAudioRouter {
+public:
+    virtual ~SystemAudioRouter() = default;
+
+    virtual juce::String getBackendName() const = 0;
+
+    // 이 백엔드를 현재 환경에서 쓸 수 있는지 (처음 한 번 확인 후 서비스가 결과를 캐시)
+    virtual bool isAvailable() = 0;
+
+    virtual juce::StringArray getOutputDevices() = 0;
+
+    // 실패 시 빈 문자열
+    virtual juce::String getDefaultOutputDevice() = 0;
+    virtual bool setDefaultOutputDevice(const juce::String& deviceName) = 0;
+
+    // macOS: CoreAudio 직접 호출, 그 외 플랫폼: nullptr (서비스는 사용 가능한 백엔드 없음으로 처리)
+    static std::unique_ptr<SystemAudioRouter> createDefault();
+};
+
+// 백엔드 호출을 전용 워커 스레드 하나에서 순서대로 실행하는 비동기 서비스
+// - 완료 콜백은 메시지 스레드에서 호출
+// - 처음 사용 가능한 백엔드를 찾으면 이후에는 다시 탐색하지 않음
+// - "원래 출력 장치" 저장/복구 상태는 워커 스레드가 관리하므로 저장 → 변경 → 복구 순서가 항상 지켜짐
+class SystemAudioRoutingService {
+public:
+    SystemAudioRoutingService();
+    explicit SystemAudioRoutingService(std::vector<std::unique_ptr<SystemAudioRouter>> candidateBackends);
+    ~SystemAudioRoutingService();
+
+    void getOutputDevices(std::function<void(juce::StringArray)> onComplete);
+    void getDefaultOutputDevice(std::function<void(juce::String)> onComplete);
+    void setDefaultOutputDevice(const juce::String& deviceName, std::function<void(bool)> onComplete = nullptr);
+
+    // 현재 기본 출력 장치를 기억 (조회 실패 시 fallbackDevice 사용)
+    void saveDefaultOutputDevice(const juce::String& fallbackDevice, std::function<void(juce::String)> onComplete = nullptr);
+
+    // 기억해 둔 장치로 복구 (저장된 장치가 없으면 아무것도 하지 않음)
+    void restoreSavedOutputDevice(std::function<void(bool)> onComplete = nullptr);
+
+    // 앱 종료 시처럼 메시지 루프가 곧 멈출 때 사용 - 앞서 예약된 작업까지 끝날 때까지 대기
+    bool restoreSavedOutputDeviceAndWait(int timeoutMs);
+
+private:
+    void addJob(std::function<void()> job);
+    SystemAudioRouter* resolveBackend();
+    bool restoreSavedOnWorker();
+
+    template <typename Result>
+    static void deliver(std::function<void(Result)> onComplete, Result result) {
+        if (onComplete == nullptr) return;
+        juce::MessageManager::callAsync([onComplete, result] { onComplete(result); });
+    }
+
+    // 아래 멤버는 워커 스레드에서만 접근
+    std::vector<std::unique_ptr<SystemAudioRouter>> backends;
+    SystemAudioRouter* cachedBackend = nullptr;
+    juce::String savedOutputDevice;
+
+    juce::ThreadPool worker { 1 };
+};
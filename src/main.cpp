@@ -1,15 +1,40 @@
 #include <JuceHeader.h>
 #include <map>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <optional>
+
+#include "audio/AudioRecorder.h"
+#include "audio/RealtimeAllocationTracker.h"
+#include "audio/SystemAudioRouter.h"
+#include "audio/DeviceTransitionScheduler.h"
+#include "audio/AudioCallbackMeter.h"
+#include "audio/ParameterSmoother.h"
+#include "audio/PluginChain.h"
+#include "audio/BypassCrossfader.h"
+#include "audio/HostAudioCallback.h"
+#include "plugin/ParameterMap.h"
+#include "plugin/PluginDescriptionCache.h"
+#include "plugin/ClearPluginLocator.h"
+#include "plugin/PresetStore.h"
+#include "app/StartupProfiler.h"
+#include "app/AsyncLogger.h"
+#include "app/HostSettings.h"
+#include "render/OfflineRenderer.h"
+#include "ui/AudioMeterOverlay.h"
+#include "ui/AnimationScheduler.h"
+#include "ui/GlyphLayoutCache.h"
+#include "ui/KnobCluster.h"
 
 // 기본 투명도 설정 (80%)
 static constexpr float DEFAULT_ALPHA = 0.8f;
 // 폰트 크기 상수 정의
 static constexpr float DEFAULT_FONT_SIZE = 16.0f;
-// 노브 주변 점 표시 여부
-static constexpr bool KnobDot = false;
+
+// 기본 LookAndFeel(EuclidLookAndFeel)의 글리프 캐시 - Component가 아닌 그리기 클래스들이 공유
+static GlyphLayoutCache& uiText();
 
 void drawDropdownList(juce::Graphics& g,
                       const std::vector<juce::String>& items,
@@ -31,7 +56,8 @@ void drawDropdownList(juce::Graphics& g,
     }
     
     int visibleCount = std::min(maxVisible, (int)items.size() - scrollOffset);
-    g.setFont(juce::Font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain));
+    auto& text = uiText();
+    g.setFont(text.getFont(DEFAULT_FONT_SIZE));
     
     for (int i = 0; i < visibleCount; ++i) {
         int actualIndex = i + scrollOffset;
@@ -45,13 +71,14 @@ void drawDropdownList(juce::Graphics& g,
         outRects.push_back(itemRect);
         
         const juce::String& currentItem = items[actualIndex];
+        const juce::String label = currentItem.toLowerCase();
         bool isSelected = (currentItem == selectedItem);
         
         g.setColour(textColor.withAlpha(alpha));
-        g.drawText(currentItem.toLowerCase(), itemRect.reduced(textPad, 0), textJustify);
+        text.drawText(g, label, itemRect.reduced(textPad, 0), textJustify, DEFAULT_FONT_SIZE);
         
         if (isSelected) {
-            int textWidth = g.getCurrentFont().getStringWidth(currentItem.toLowerCase());
+            int textWidth = text.getStringWidth(label, DEFAULT_FONT_SIZE);
             int underlineY = itemRect.getY() + 15;
             int underlineX;
             if (textJustify == juce::Justification::centredRight) {
@@ -70,6 +97,19 @@ void drawDropdownList(juce::Graphics& g,
 class EuclidLookAndFeel : public juce::LookAndFeel_V4 {
 public:
     EuclidLookAndFeel() { loadAllFonts(); }
+    
+    GlyphLayoutCache& getGlyphLayoutCache() { return glyphLayoutCache; }
+    
+    // 기본 LookAndFeel로 설정된 인스턴스의 캐시 (설정 전이면 임시 캐시)
+    static GlyphLayoutCache& getSharedGlyphLayoutCache() {
+        if (auto* euclid = dynamic_cast<EuclidLookAndFeel*>(&juce::LookAndFeel::getDefaultLookAndFeel())) {
+            return euclid->glyphLayoutCache;
+        }
+        static GlyphLayoutCache fallback { TYPEFACE_NAME };
+        return fallback;
+    }
+    
+    static constexpr const char* TYPEFACE_NAME = "Euclid Circular B";
 
     juce::Typeface::Ptr getTypefaceForFont(const juce::Font& font) override {
         auto key = getKey(font);
@@ -116,15 +156,20 @@ public:
                     auto tf = juce::Typeface::createSystemTypefaceFor(fontData.getData(), fontData.getSize());
                     if (tf != nullptr) {
                         typefaceMap[{info.weight, info.italic}] = tf;
-                        juce::Logger::writeToLog("Loaded font: " + fontFile.getFileName());
+                        CLR_LOG_INFO("Loaded font: " + fontFile.getFileName());
                     }
                 }
             }
         }
+        
+        // 폰트가 바뀌면 이전에 잰 폭/배치는 모두 무효 - 고정 레이블은 바로 다시 계산
+        glyphLayoutCache.clear();
+        glyphLayoutCache.precompute({ "in", "out", "preset", "bypass", "stereo", "mono", "rec", "amb", "vox", "v. rev" }, DEFAULT_FONT_SIZE);
     }
 
 private:
     std::map<std::pair<int, bool>, juce::Typeface::Ptr> typefaceMap;
+    GlyphLayoutCache glyphLayoutCache { TYPEFACE_NAME };
     std::pair<int, bool> getKey(const juce::Font& font) const {
         int weight = 400;
         bool italic = font.isItalic();
@@ -136,10 +181,14 @@ private:
     }
 };
 
+static GlyphLayoutCache& uiText() {
+    return EuclidLookAndFeel::getSharedGlyphLayoutCache();
+}
+
 class Face {
 public:
-    Face() : color(juce::Colour(0xFFFF9625)) {
-        loadSavedColor();
+    explicit Face(HostSettings& settingsToUse) : settings(settingsToUse) {
+        color = settings.getFaceColour(juce::Colour(0xFFFF9625));
         updateMode();
     }
     
@@ -165,7 +214,7 @@ public:
     void setColor(juce::Colour newColor) {
         color = newColor;
         updateMode();
-        saveColor();
+        settings.setFaceColour(color);
     }
     
     bool isDarkMode() const {
@@ -187,249 +236,30 @@ private:
         darkMode = luminance <= 0.3f; // 30% 이하이면 다크모드
         
         // 디버깅용 로그
-        juce::Logger::writeToLog("Face color: " + color.toString() + 
-                                ", Luminance: " + juce::String(luminance, 3) + 
-                                ", Dark mode: " + (darkMode ? "ON" : "OFF"));
-    }
-    
-    void saveColor() {
-        juce::File colorFile = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
-                              .getChildFile("ClearHost")
-                              .getChildFile("face_color.conf");
-        colorFile.getParentDirectory().createDirectory();
-        
-        juce::PropertiesFile settings(colorFile, juce::PropertiesFile::Options());
-        settings.setValue("faceColor", color.toString());
-        settings.saveIfNeeded();
-    }
-    
-    void loadSavedColor() {
-        juce::File colorFile = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
-                              .getChildFile("ClearHost")
-                              .getChildFile("face_color.conf");
-        
-        if (colorFile.existsAsFile()) {
-            juce::PropertiesFile settings(colorFile, juce::PropertiesFile::Options());
-            juce::String savedColor = settings.getValue("faceColor", "");
-            if (savedColor.isNotEmpty()) {
-                color = juce::Colour::fromString(savedColor);
-            }
-        }
+        CLR_LOG_DEBUG("Face color: " + color.toString() + 
+                     ", Luminance: " + juce::String(luminance, 3) + 
+                     ", Dark mode: " + (darkMode ? "ON" : "OFF"));
     }
     
+    HostSettings& settings;
     juce::Colour color;
     bool darkMode = false;
 };
 
-class KnobWithLabel {
-public:
-    KnobWithLabel(juce::Rectangle<int> area, float value, const juce::String& labelText, juce::Colour knobColour, juce::Colour labelColour, juce::Colour indicatorColour, bool showValue = false, bool darkMode = false)
-        : area(area), value(value), labelText(labelText), knobColour(knobColour), labelColour(labelColour), indicatorColour(indicatorColour), showValue(showValue), darkMode(darkMode) {}
-
-    void draw(juce::Graphics& g, juce::Point<int> mousePos = juce::Point<int>(-1, -1)) const {
-        // 노브 중심점
-        float cx = area.getCentreX();
-        float cy = area.getCentreY();
-        float radius = 19.0f;
-        
-        // 마우스 위치가 유효한 경우 그림자 계산
-        if (mousePos.x >= 0 && mousePos.y >= 0) {
-            // 마우스와 노브 중심 간의 벡터 계산
-            float dx = mousePos.x - cx;
-            float dy = mousePos.y - cy;
-            float distance = std::sqrt(dx * dx + dy * dy);
-            
-            float maxDistance = 100.0f; // 최대 거리 100px
-            float normalizedDistance = std::min(distance / maxDistance, 1.0f);
-            
-            // 그림자 offset: 1px ~ 6.6px (기존의 60%)
-            float shadowOffset = 1.0f + normalizedDistance * 6.0f;
-            // 그림자 스케일: 고정값 1.05
-            float shadowScale = 1.05f;
-            // 그림자 알파: 고정값 0.2(20%)
-            float shadowAlpha = 0.2f;
-            if (darkMode) shadowAlpha = std::min(1.0f, shadowAlpha * 1.5f);
-            
-            if (distance > 0) {
-                float normalizedDx = -dx / distance; // 반대 방향
-                float normalizedDy = -dy / distance; // 반대 방향
-                float shadowOffsetX = normalizedDx * shadowOffset;
-                float shadowOffsetY = normalizedDy * shadowOffset;
-                // 그림자 그리기
-                g.setColour(juce::Colours::black.withAlpha(shadowAlpha));
-                float shadowRadius = radius * shadowScale;
-                g.fillEllipse(cx - shadowRadius + shadowOffsetX, cy - shadowRadius + shadowOffsetY, shadowRadius * 2, shadowRadius * 2);
-            }
-        } else {
-            // 음수 좌표 처리: 노브 중심부터 마우스까지의 거리 계산
-            float dx, dy;
-            
-            // X축 음수 좌표 처리
-            if (mousePos.x < 0) {
-                // 노브 중심부터 마우스까지의 거리 (음수 좌표는 절댓값으로 처리)
-                dx = mousePos.x - cx;
-            } else {
-                dx = mousePos.x - cx;
-            }
-            
-            // Y축 음수 좌표 처리
-            if (mousePos.y < 0) {
-                // 노브 중심부터 마우스까지의 거리 (음수 좌표는 절댓값으로 처리)
-                dy = mousePos.y - cy;
-            } else {
-                dy = mousePos.y - cy;
-            }
-            
-            float distance = std::sqrt(dx * dx + dy * dy);
-            
-            float maxDistance = 100.0f; // 최대 거리 100px
-            float normalizedDistance = std::min(distance / maxDistance, 1.0f);
-            
-            // 그림자 offset: 1px ~ 6.6px (기존의 60%)
-            float shadowOffset = 1.0f + normalizedDistance * 6.0f;
-            // 그림자 스케일: 고정값 1.05
-            float shadowScale = 1.05f;
-            // 그림자 알파: 고정값 0.2(20%)
-            float shadowAlpha = 0.2f;
-            if (darkMode) shadowAlpha = std::min(1.0f, shadowAlpha * 1.5f);
-            
-            if (distance > 0) {
-                float normalizedDx = -dx / distance; // 반대 방향
-                float normalizedDy = -dy / distance; // 반대 방향
-                float shadowOffsetX = normalizedDx * shadowOffset;
-                float shadowOffsetY = normalizedDy * shadowOffset;
-                // 그림자 그리기
-                g.setColour(juce::Colours::black.withAlpha(shadowAlpha));
-                float shadowRadius = radius * shadowScale;
-                g.fillEllipse(cx - shadowRadius + shadowOffsetX, cy - shadowRadius + shadowOffsetY, shadowRadius * 2, shadowRadius * 2);
-            }
-        }
-        
-        // 노브 원
-        g.setColour(knobColour);
-        g.fillEllipse(cx - radius, cy - radius, radius * 2, radius * 2);
-        
-        // 인디케이터 - Face 색상 사용
-        // 270도 범위로 확장: minAngle을 15도 더 반시계, maxAngle을 15도 더 시계방향
-        float minAngle = juce::MathConstants<float>::pi * 5.0f/6.0f - juce::MathConstants<float>::pi * 15.0f/180.0f; // 15도 반시계 추가
-        float maxAngle = juce::MathConstants<float>::pi * 13.0f/6.0f + juce::MathConstants<float>::pi * 15.0f/180.0f; // 15도 시계방향 추가
-        // 0~2 범위를 0~1로 변환하여 각도 계산 (270도 회전 범위)
-        float normalizedValue = value / 2.0f;
-        float angle = minAngle + normalizedValue * (maxAngle - minAngle);
-        float startX = cx + std::cos(angle) * (radius + 0.0f); // 시작점을 노브 중심쪽으로 1px 이동
-        float startY = cy + std::sin(angle) * (radius + 0.0f);
-        float endX = cx + std::cos(angle) * (radius - DEFAULT_FONT_SIZE - 1.0f); // 끝점을 노브 중심쪽으로 1px 이동
-        float endY = cy + std::sin(angle) * (radius - DEFAULT_FONT_SIZE - 1.0f);
-        g.setColour(indicatorColour); // Face 색상으로 변경
-        g.drawLine(startX, startY, endX, endY, 4.0f);
-        
-        // 노브 주변 점 2개 그리기 (KnobDot 변수에 따라 조건부 표시)
-        if (KnobDot) {
-            float dotDistance = 24.0f; // 점과 노브 중심간의 거리 (+1px)
-            float dotRadius = 1.5f; // 점 크기 (지름 3px, -1px)
-            
-            // 1번점: 225도 - 90도 = 135도
-            float dot1Angle = juce::MathConstants<float>::pi + juce::MathConstants<float>::pi * 45.0f / 180.0f - juce::MathConstants<float>::pi * 90.0f / 180.0f; // 135도
-            float dot1X = cx + std::cos(dot1Angle) * dotDistance;
-            float dot1Y = cy + std::sin(dot1Angle) * dotDistance;
-            
-            // 2번점: 135도 - 90도 = 45도
-            float dot2Angle = juce::MathConstants<float>::pi - juce::MathConstants<float>::pi * 45.0f / 180.0f - juce::MathConstants<float>::pi * 90.0f / 180.0f; // 45도
-            float dot2X = cx + std::cos(dot2Angle) * dotDistance;
-            float dot2Y = cy + std::sin(dot2Angle) * dotDistance;
-            
-            // 점 그리기 (노브와 동일한 컬러, 알파값 적용)
-            g.setColour(knobColour);
-            g.fillEllipse(dot1X - dotRadius, dot1Y - dotRadius, dotRadius * 2, dotRadius * 2);
-            g.fillEllipse(dot2X - dotRadius, dot2Y - dotRadius, dotRadius * 2, dotRadius * 2);
-        }
-        
-        // 레이블 또는 값 표시
-        int labelW = area.getWidth();
-        int labelH = 20;
-        int labelX = area.getX();
-        int labelY = static_cast<int>(cy + radius - 1); // 노브 원 아래 -1px (2px 아래)
-        g.setColour(labelColour);
-        g.setFont(juce::Font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain));
-        
-        juce::String displayText;
-        if (showValue) {
-            // 소숫점 두자리까지 표시
-            displayText = juce::String(value, 2);
-        } else {
-            displayText = labelText;
-        }
-        
-        g.drawText(displayText, labelX, labelY, labelW, labelH, juce::Justification::centred);
-    }
-    
-    void setShowValue(bool shouldShow) {
-        showValue = shouldShow;
-    }
-    
-    juce::Rectangle<int> area;
-    float value;
-    juce::String labelText;
-    juce::Colour knobColour;
-    juce::Colour labelColour;
-    juce::Colour indicatorColour;
-    bool showValue;
-    bool darkMode;
-};
-
-class KnobCluster {
-public:
-    KnobCluster(juce::Point<int> center, std::vector<float>& values, std::vector<juce::Rectangle<int>>& rects, juce::Colour faceColor, std::vector<bool>& showValues, float alpha = 1.0f, juce::Colour textColor = juce::Colours::black, bool darkMode = false)
-        : center(center), values(values), knobRects(rects), faceColor(faceColor), showValues(showValues), alpha(alpha), textColor(textColor), darkMode(darkMode) {}
-    void draw(juce::Graphics& g, juce::Point<int> mousePos = juce::Point<int>(-1, -1)) const {
-        struct KnobPos { int dx, dy; const char* label; };
-        KnobPos knobPos[3] = {
-            {-46, -37, "amb"},
-            {  0,  -2, "vox"},
-            { 46, -37, "v. rev"}
-        };
-        for (int i = 0; i < 3; ++i) {
-            int cx = center.x + knobPos[i].dx;
-            int cy = center.y + knobPos[i].dy;
-            knobRects[i] = juce::Rectangle<int>(cx - 20, cy - 20, 40, 40);
-            KnobWithLabel knob(
-                knobRects[i],
-                values[i],
-                knobPos[i].label,
-                textColor.withAlpha(alpha),
-                textColor.withAlpha(alpha),
-                faceColor,
-                showValues[i],
-                darkMode
-            );
-            knob.draw(g, mousePos);
-        }
-    }
-    // 값을 외부에서 바꿀 수 있도록 참조로 보관
-    std::vector<float>& values;
-    std::vector<juce::Rectangle<int>>& knobRects;
-    juce::Point<int> center;
-    juce::Colour faceColor;
-    std::vector<bool>& showValues;
-    float alpha;
-    juce::Colour textColor;
-    bool darkMode;
-};
-
 class TextButtonLike {
 public:
     TextButtonLike(const juce::String& text, juce::Point<int> position, float alpha = DEFAULT_ALPHA, juce::Colour textColor = juce::Colours::black)
         : text(text), position(position), alpha(alpha), textColor(textColor) {}
     void draw(juce::Graphics& g) const {
         g.setColour(textColor.withAlpha(alpha));
-        g.setFont(juce::Font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain));
         
-        // 텍스트 크기 계산
-        int textW = g.getCurrentFont().getStringWidth(text);
-        int textH = (int)g.getCurrentFont().getHeight();
+        // 텍스트 크기 (캐시)
+        const auto& layout = uiText().get(text, DEFAULT_FONT_SIZE);
+        int textW = layout.width;
+        int textH = (int)layout.height;
         
         // 텍스트 그리기
-        g.drawText(text, position.x, position.y, textW, textH, juce::Justification::centred);
+        uiText().drawText(g, text, { position.x, position.y, textW, textH }, juce::Justification::centred, DEFAULT_FONT_SIZE);
         
         // Underline - 텍스트 기준으로 위치 계산
         int underlineY = position.y + textH - 1; // 텍스트 아래 0px (8px 아래로 이동)
@@ -440,9 +270,9 @@ public:
     }
     bool hitTest(juce::Point<int> pos) const { 
         // 텍스트 크기에 맞춰서 상하좌우 3px 확장
-        juce::Font font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain);
-        int textW = font.getStringWidth(text);
-        int textH = (int)font.getHeight();
+        const auto& layout = uiText().get(text, DEFAULT_FONT_SIZE);
+        int textW = layout.width;
+        int textH = (int)layout.height;
         return juce::Rectangle<int>(position.x - 3, position.y - 3, textW + 6, textH + 6).contains(pos); 
     }
     juce::String text;
@@ -455,7 +285,8 @@ enum class LEDState {
     OFF,           // 꺼짐 (어두운 녹색)
     PLUGIN_ON,     // 플러그인 로딩 성공 (밝은 녹색)
     PLUGIN_OFF,    // 플러그인 로딩 실패 (빨간색)
-    BYPASS_ON      // 바이패스 활성화 (어두운 녹색)
+    BYPASS_ON,     // 바이패스 활성화 (어두운 녹색)
+    LOADING        // 플러그인 비동기 로딩 중 (호박색)
 };
 
 class LED {
@@ -482,6 +313,9 @@ public:
             case LEDState::BYPASS_ON:
                 ledColour = juce::Colour(0x4D000000); // 검정색, 30% 알파값 (preset LED OFF와 동일)
                 break;
+            case LEDState::LOADING:
+                ledColour = juce::Colour(0xFFE0A030); // 호박색 (로딩 중)
+                break;
         }
         
         g.setColour(ledColour);
@@ -509,193 +343,6 @@ public:
     LEDState state;
 };
 
-class AudioRecorder {
-public:
-    AudioRecorder(int actualSampleRate = 44100) : isRecording(false), sampleRate(actualSampleRate), numChannels(2), fileStream(nullptr), 
-                     bufferSize(32768), bufferIndex(0), audioBuffer(nullptr), flushCounter(0) {
-        // WAV 파일 헤더 초기화 (실제 샘플레이트 사용)
-        initializeWavHeader();
-        // 오디오 버퍼 초기화 (32KB 버퍼로 증가)
-        audioBuffer = new int16_t[bufferSize * numChannels];
-    }
-    
-    ~AudioRecorder() {
-        if (fileStream) {
-            fileStream->close();
-            delete fileStream;
-        }
-        if (audioBuffer) {
-            delete[] audioBuffer;
-        }
-    }
-    
-    void startRecording() {
-        if (isRecording) return;
-        
-        // 현재 시간으로 파일명 생성
-        filename = generateFilename();
-        juce::Logger::writeToLog("Starting recording to: " + filename + " with sample rate: " + juce::String(sampleRate));
-        
-        // 임시 파일 생성
-        tempFile = juce::File::getSpecialLocation(juce::File::tempDirectory)
-                  .getChildFile("clr_temp_recording.wav");
-        
-        // 파일 스트림 열기
-        fileStream = new std::ofstream(tempFile.getFullPathName().toRawUTF8(), std::ios::binary);
-        if (!fileStream->is_open()) {
-            juce::Logger::writeToLog("Failed to open recording file");
-            return;
-        }
-        
-        // WAV 헤더 쓰기
-        fileStream->write(reinterpret_cast<const char*>(&wavHeader), sizeof(wavHeader));
-        
-        isRecording = true;
-        bufferIndex = 0;
-        flushCounter = 0;
-        totalSamples = 0;
-    }
-    
-    void stopRecording() {
-        if (!isRecording) return;
-        
-        juce::Logger::writeToLog("Stopping recording");
-        
-        // 남은 버퍼 데이터 플러시
-        if (bufferIndex > 0) {
-            flushBuffer();
-        }
-        
-        // 파일 닫기
-        if (fileStream) {
-            fileStream->close();
-            delete fileStream;
-            fileStream = nullptr;
-        }
-        
-        // WAV 헤더 갱신 (실제 데이터 크기)
-        wavHeader.dataChunkSize = totalSamples * numChannels * sizeof(int16_t);
-        wavHeader.chunkSize = 36 + wavHeader.dataChunkSize;
-        {
-            std::fstream wavFile(tempFile.getFullPathName().toRawUTF8(), std::ios::in | std::ios::out | std::ios::binary);
-            if (wavFile.is_open()) {
-                wavFile.seekp(0);
-                wavFile.write(reinterpret_cast<const char*>(&wavHeader), sizeof(wavHeader));
-                wavFile.close();
-            }
-        }
-        
-        // 최종 파일로 이동
-        juce::File desktopFolder = juce::File::getSpecialLocation(juce::File::userDesktopDirectory);
-        juce::File finalFile = desktopFolder.getChildFile(filename);
-        
-        if (tempFile.moveFileTo(finalFile)) {
-            juce::Logger::writeToLog("Recording saved to: " + finalFile.getFullPathName());
-            finalFile.revealToUser();
-            juce::Logger::writeToLog("Successfully opened desktop folder");
-        } else {
-            juce::Logger::writeToLog("Failed to save recording");
-        }
-        
-        isRecording = false;
-    }
-    
-    bool isRecordingActive() const {
-        return isRecording;
-    }
-    
-    // 오디오 스레드에서 호출되는 함수 - 최소한의 처리만 수행
-    void processAudioData(const float* const* inputChannelData, int numInputChannels,
-                         const float* const* outputChannelData, int numOutputChannels,
-                         int numSamples) {
-        if (!isRecording || !fileStream || !fileStream->is_open() || !audioBuffer) return;
-        
-        // 출력 오디오 데이터를 버퍼에 추가 (최소한의 처리)
-        for (int sample = 0; sample < numSamples; ++sample) {
-            for (int channel = 0; channel < std::min(numOutputChannels, numChannels); ++channel) {
-                float sampleValue = outputChannelData[channel][sample];
-                // 클리핑 방지
-                sampleValue = juce::jlimit(-1.0f, 1.0f, sampleValue);
-                // float를 16비트 정수로 변환
-                int16_t intSample = static_cast<int16_t>(sampleValue * 32767.0f);
-                
-                int bufferPos = (bufferIndex + sample) * numChannels + channel;
-                if (bufferPos < bufferSize * numChannels) {
-                    audioBuffer[bufferPos] = intSample;
-                }
-            }
-        }
-        
-        bufferIndex += numSamples;
-        totalSamples += numSamples;
-        
-        // 버퍼가 가득 찰 때만 플러시 (매우 드물게)
-        if (bufferIndex >= bufferSize) {
-            flushBuffer();
-        }
-    }
-    
-private:
-    bool isRecording;
-    int sampleRate;
-    int numChannels;
-    std::ofstream* fileStream;
-    juce::String filename;
-    juce::File tempFile;
-    
-    // 큰 버퍼로 변경 (32KB)
-    int bufferSize;
-    int bufferIndex;
-    int16_t* audioBuffer;
-    int flushCounter;
-    int totalSamples;
-    
-    struct WavHeader {
-        char riff[4] = {'R', 'I', 'F', 'F'};
-        uint32_t chunkSize = 0;
-        char wave[4] = {'W', 'A', 'V', 'E'};
-        char fmt[4] = {'f', 'm', 't', ' '};
-        uint32_t fmtChunkSize = 16;
-        uint16_t audioFormat = 1;
-        uint16_t numChannels = 2;
-        uint32_t sampleRate = 44100; // 기본값, initializeWavHeader에서 실제 값으로 변경
-        uint32_t byteRate = 176400; // 기본값, initializeWavHeader에서 실제 값으로 변경
-        uint16_t blockAlign = 4;
-        uint16_t bitsPerSample = 16;
-        char data[4] = {'d', 'a', 't', 'a'};
-        uint32_t dataChunkSize = 0;
-    } wavHeader;
-    
-    void initializeWavHeader() {
-        // 실제 샘플레이트로 WAV 헤더 설정
-        wavHeader.sampleRate = sampleRate;
-        wavHeader.byteRate = wavHeader.sampleRate * wavHeader.numChannels * wavHeader.bitsPerSample / 8;
-        wavHeader.blockAlign = wavHeader.numChannels * wavHeader.bitsPerSample / 8;
-    }
-    
-    juce::String generateFilename() {
-        auto now = juce::Time::getCurrentTime();
-        return "clr_" + now.formatted("%Y%m%d%H%M%S") + ".wav";
-    }
-    
-    // 버퍼 플러시 - 매우 드물게 호출됨
-    void flushBuffer() {
-        if (!fileStream || !fileStream->is_open() || bufferIndex == 0) return;
-        
-        // 버퍼 데이터를 파일에 쓰기
-        fileStream->write(reinterpret_cast<const char*>(audioBuffer), 
-                         bufferIndex * numChannels * sizeof(int16_t));
-        
-        bufferIndex = 0;
-        flushCounter++;
-        
-        // 10번째 플러시마다 로그 (매우 드물게)
-        if (flushCounter % 10 == 0) {
-            juce::Logger::writeToLog("Audio buffer flushed " + juce::String(flushCounter) + " times");
-        }
-    }
-};
-
 class RecButton {
 public:
     RecButton() : isOn(false), blinkTimer(0), blinkState(false), darkMode(false) {}
@@ -743,8 +390,7 @@ public:
         
         // rec LED가 빨간색이고 녹음 기능이 ON일 때만 왼쪽에 'rec' 텍스트 표시
         if (isRed && isOn) {
-            g.setFont(juce::Font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain));
-            
+
             // 다크모드 지원: 다크모드일 때 흰색, 라이트모드일 때 검은색
             juce::Colour textColour = darkMode ? juce::Colours::white : juce::Colours::black;
             
@@ -752,8 +398,8 @@ public:
             float alpha = bypassActive ? 0.3f : DEFAULT_ALPHA;
             
             g.setColour(textColour.withAlpha(alpha));
-            int textWidth = g.getCurrentFont().getStringWidth("rec");
-            g.drawText("rec", center.x - textWidth - 6, center.y - 10, textWidth, 16, juce::Justification::centredRight);
+            int textWidth = uiText().getStringWidth("rec", DEFAULT_FONT_SIZE);
+            uiText().drawText(g, "rec", { center.x - textWidth - 6, center.y - 10, textWidth, 16 }, juce::Justification::centredRight, DEFAULT_FONT_SIZE);
         }
     }
     
@@ -799,7 +445,7 @@ public:
         float alpha = bypassActive ? 0.3f : DEFAULT_ALPHA; // bypass on일 때 30%, off일 때 기본 알파값
         
         // 1. 노브 3개 그리기 (알파값 적용, 단 인디케이터는 제외)
-        KnobCluster cluster(center, knobValues, knobRects, faceColor, showValues, alpha, textColor, darkMode);
+        KnobCluster cluster(uiText(), center, knobValues, knobRects, faceColor, showValues, alpha, textColor, darkMode);
         cluster.draw(g, mousePos);
         
         // 2. LED 그리기 (2번 노브 중앙 기준, 위로 69px) - LED는 알파값 적용 안함
@@ -811,11 +457,7 @@ public:
         }
         
         // 3. Rec 버튼 그리기 (separator 우측 상단 기준으로 위로 13px, 좌로 12px)
-        int separatorWidth = 145;
-        int separatorX = 80 - separatorWidth / 2; // 중앙정렬
-        int separatorY = 121 - 4 / 2; // 중앙정렬 (5px 아래로 이동)
-        juce::Point<int> recCenter(separatorX + separatorWidth - 12, separatorY - 13); // separator 우측 상단에서 위로 13px, 좌로 12px
-        recButton.draw(g, recCenter, bypassActive);
+        recButton.draw(g, getRecButtonCentre(), bypassActive);
         
         // 4. Stereo/Mono 토글 버튼 그리기 (알파값 적용)
         // stereoText는 외부에서 updateStereoText()로 업데이트됨
@@ -823,10 +465,10 @@ public:
         int stereoX = (knobRects.size() >= 2 && knobRects[1].getWidth() > 0 && knobRects[1].getHeight() > 0) ? knobRects[1].getCentreX() : center.x;
         int stereoY = center.y - 51; // 노브 클러스터 중앙에서 위로 51px (5px 아래로 이동)
         
-        // 텍스트 크기에 맞춰서 위치 계산
-        g.setFont(juce::Font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain));
-        int textW = g.getCurrentFont().getStringWidth(stereoText);
-        int textH = (int)g.getCurrentFont().getHeight();
+        // 텍스트 크기에 맞춰서 위치 계산 (캐시)
+        const auto& layout = uiText().get(stereoText, DEFAULT_FONT_SIZE);
+        int textW = layout.width;
+        int textH = (int)layout.height;
         int stereoStartX = stereoX - textW/2;
         
         stereoMonoRect = juce::Rectangle<int>(stereoStartX, stereoY, textW, textH);
@@ -863,6 +505,19 @@ public:
     }
     
     // Rec 버튼 관련 메서드들
+    static juce::Point<int> getRecButtonCentre() {
+        int separatorWidth = 145;
+        int separatorX = 80 - separatorWidth / 2; // 중앙정렬
+        int separatorY = 121 - 4 / 2; // 중앙정렬 (5px 아래로 이동)
+        return { separatorX + separatorWidth - 12, separatorY - 13 }; // separator 우측 상단에서 위로 13px, 좌로 12px
+    }
+    
+    // 깜빡일 때 다시 그릴 영역 (LED + 왼쪽 'rec' 텍스트)
+    static juce::Rectangle<int> getRecButtonArea() {
+        auto centre = getRecButtonCentre();
+        return { centre.x - 44, centre.y - 10, 48, 20 };
+    }
+    
     void updateRecButton() {
         recButton.update();
     }
@@ -912,21 +567,23 @@ class Preset {
 public:
     Preset(juce::Colour faceColor, juce::Colour textColor = juce::Colours::black) : faceColor(faceColor), textColor(textColor), ledOn(false), labelText("preset") {}
     void setLedOn(bool on) { ledOn = on; }
-    void setLabelText(const juce::String& text) { labelText = text; }
+    void setLabelText(const juce::String& text) {
+        if (text != labelText) ++labelVersion;
+        labelText = text;
+    }
+    // 레이블이 바뀔 때마다 증가 (Bottom의 hit 영역 표 갱신 기준)
+    int getLabelVersion() const { return labelVersion; }
     void setTextColor(juce::Colour color) { textColor = color; }
     juce::String getLabelText() const { return labelText; }
     
     void draw(juce::Graphics& g, int buttonY, float alpha = DEFAULT_ALPHA) const {
-        juce::Font font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain);
-        
         // 동적 레이블 텍스트와 언더라인 그리기
-        int presetTextWidth = font.getStringWidth(labelText);
+        int presetTextWidth = uiText().getStringWidth(labelText, DEFAULT_FONT_SIZE);
         int presetX = 80 - presetTextWidth / 2; // 80px 중앙에서 텍스트 중앙 정렬
         
         // preset 텍스트 그리기 (bypass 상태에 따른 알파값 적용)
         g.setColour(textColor.withAlpha(alpha));
-        g.setFont(font);
-        g.drawText(labelText, presetX, buttonY, presetTextWidth, 20, juce::Justification::centredLeft);
+        uiText().drawText(g, labelText, { presetX, buttonY, presetTextWidth, 20 }, juce::Justification::centredLeft, DEFAULT_FONT_SIZE);
         
         // preset 언더라인 그리기 (bypass 상태에 따른 알파값 적용)
         g.setColour(textColor.withAlpha(alpha));
@@ -965,16 +622,15 @@ public:
         // g.strokePath(dropdownPath, juce::PathStrokeType(1.0f));
     }
     
-    bool hitTestPresetButton(juce::Point<int> pos, int buttonY) const {
-        juce::Font font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain);
-        int presetTextWidth = font.getStringWidth(labelText);
+    juce::Rectangle<int> getButtonHitArea(int buttonY) const {
+        int presetTextWidth = uiText().getStringWidth(labelText, DEFAULT_FONT_SIZE);
         int presetX = 80 - presetTextWidth / 2;
-        return juce::Rectangle<int>(presetX - 5, buttonY - 5, presetTextWidth + 10, 20 + 10).contains(pos);
+        return juce::Rectangle<int>(presetX - 5, buttonY - 5, presetTextWidth + 10, 20 + 10);
     }
     
-    bool hitTestPresetDropdownButton(juce::Point<int> pos, int buttonY) const {
-        juce::Font font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain);
-        int presetTextWidth = font.getStringWidth(labelText);
+    juce::Rectangle<int> getDropdownButtonHitArea(int buttonY) const {
+        const auto& layout = uiText().get(labelText, DEFAULT_FONT_SIZE);
+        int presetTextWidth = layout.width;
         int presetX = 80 - presetTextWidth / 2;
         int presetRightX = presetX + presetTextWidth;
         int dropdownX = presetRightX + 8 - 6 + 2 - 1; // 왼쪽으로 6px 이동, 그리고 오른쪽으로 2px 이동, 그리고 왼쪽으로 1px 이동
@@ -985,10 +641,10 @@ public:
         float height = 8.0f * scale; // 3.2px
         
         // x-height 기준으로 세로 중앙 정렬, 그리고 아래로 5px 이동
-        float xHeight = font.getHeight() * 0.6f;
+        float xHeight = layout.height * 0.6f;
         int dropdownY = buttonY + (20 - xHeight) / 2 + 5;
         
-        return juce::Rectangle<int>(dropdownX, dropdownY, width, height).contains(pos);
+        return juce::Rectangle<int>(dropdownX, dropdownY, width, height);
     }
     
 private:
@@ -996,6 +652,7 @@ private:
     juce::Colour textColor;
     bool ledOn;
     juce::String labelText;
+    int labelVersion = 0;
 };
 
 class ColorPicker {
@@ -1141,6 +798,15 @@ public:
         bypassOn = on;
     }
     
+    // 오디오 성능 오버레이 토글 ("cpu" 라벨) 상태
+    void setMeterVisible(bool visible) {
+        meterVisible = visible;
+    }
+    
+    bool isMeterVisible() const {
+        return meterVisible;
+    }
+    
     void draw(juce::Graphics& g, juce::Drawable* arrowDrawableB = nullptr, juce::Drawable* arrowDrawableW = nullptr, const Face* face = nullptr) const {
         // bypass 상태에 따른 알파값 설정 (Panel과 동일하게)
         float alpha = bypassOn ? 0.3f : DEFAULT_ALPHA; // bypass on일 때 30%, off일 때 기본 알파값
@@ -1148,7 +814,7 @@ public:
         // 세퍼레이터 기준 아래로 23px 위치에서 위로 10px 이동, 그리고 위로 8px 더 이동, 그리고 위로 2px 더 이동 (세퍼레이터 Y=126, 높이 4px)
         int buttonY = 121 + 4 + 23 - 10 - 8 - 2; // 세퍼레이터 아래 끝 + 23px - 10px - 8px - 2px (5px 아래로 이동)
         
-        juce::Font font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain);
+        auto& text = uiText();
         
         if (arrowVisible) {
             // 화살표 모드: 텍스트와 언더라인 숨기고 화살표 표시
@@ -1173,7 +839,7 @@ public:
                     g.setOpacity(1.0f);
                 } catch (...) {
                     // SVG 그리기 실패 시 기본 삼각형으로 대체
-                    juce::Logger::writeToLog("Warning: Failed to draw arrow SVG, using fallback");
+                    CLR_LOG_WARNING("Warning: Failed to draw arrow SVG, using fallback");
                     g.setOpacity(1.0f);
                     juce::Colour arrowColor = isDarkMode ? juce::Colours::white : juce::Colours::black;
                     g.setColour(arrowColor.withAlpha(alpha));
@@ -1204,62 +870,55 @@ public:
         } else {
             // 텍스트 모드: 기존 로직 유지
             int inX = 8 + 2; // 세퍼레이터 왼쪽 끝 + 2px
-            int inTextWidth = font.getStringWidth("in");
+            int inTextWidth = text.getStringWidth("in", DEFAULT_FONT_SIZE);
             g.setColour(textColor.withAlpha(alpha * 0.5f));
-            g.setFont(font);
-            g.drawText("in", inX, buttonY, inTextWidth, 20, juce::Justification::centredLeft);
+            text.drawText(g, "in", { inX, buttonY, inTextWidth, 20 }, juce::Justification::centredLeft, DEFAULT_FONT_SIZE);
             g.setColour(textColor.withAlpha(alpha));
             g.drawLine(inX, buttonY + 17, inX + inTextWidth, buttonY + 17, 1.0f);
-            int outTextWidth = font.getStringWidth("out");
+            int outTextWidth = text.getStringWidth("out", DEFAULT_FONT_SIZE);
             int outX = 152 - outTextWidth - 2;
             g.setColour(textColor.withAlpha(alpha * 0.5f));
-            g.drawText("out", outX, buttonY, outTextWidth, 20, juce::Justification::centredLeft);
+            text.drawText(g, "out", { outX, buttonY, outTextWidth, 20 }, juce::Justification::centredLeft, DEFAULT_FONT_SIZE);
             g.setColour(textColor.withAlpha(alpha));
             g.drawLine(outX, buttonY + 17, outX + outTextWidth, buttonY + 17, 1.0f);
         }
         // preset 클래스 사용하여 그리기 (bypass 상태 전달)
         preset.draw(g, buttonY, alpha);
         int bypassY = 265 - 4 - 20; // 5px 아래로 이동
-        int bypassTextWidth = font.getStringWidth("bypass");
+        int bypassTextWidth = text.getStringWidth("bypass", DEFAULT_FONT_SIZE);
         int bypassX = 80 - bypassTextWidth / 2;
         float bypassAlpha = bypassOn ? 1.0f : 0.2f;
         g.setColour(textColor.withAlpha(bypassAlpha));
-        g.setFont(font);
-        g.drawText("bypass", bypassX, bypassY, bypassTextWidth, 20, juce::Justification::centred);
+        text.drawText(g, "bypass", { bypassX, bypassY, bypassTextWidth, 20 }, juce::Justification::centred, DEFAULT_FONT_SIZE);
+        
+        // 성능 오버레이 토글 (좌하단, bypass와 같은 줄)
+        g.setColour(textColor.withAlpha(meterVisible ? 1.0f : 0.2f));
+        text.drawText(g, "cpu", getMeterToggleRect(), juce::Justification::centredLeft, METER_TOGGLE_FONT_SIZE);
+    }
+    
+    bool hitTestMeterToggle(juce::Point<int> pos) const {
+        return getMeterToggleRect().expanded(2).contains(pos);
     }
     
+    // hit test는 미리 계산한 영역 표 조회 (마우스 이동마다 글자 폭을 다시 재지 않음)
     bool hitTestInButton(juce::Point<int> pos) const {
-        int buttonY = 121 + 4 + 23 - 10 - 8 - 2; // 5px 아래로 이동
-        int inX = 8 + 2;
-        juce::Font font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain);
-        int inTextWidth = font.getStringWidth("in");
-        return juce::Rectangle<int>(inX - 5, buttonY - 5, inTextWidth + 10, 20 + 10).contains(pos);
+        return getHitAreas().inButton.contains(pos);
     }
     
     bool hitTestOutButton(juce::Point<int> pos) const {
-        int buttonY = 121 + 4 + 23 - 10 - 8 - 2; // 5px 아래로 이동
-        juce::Font font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain);
-        int outTextWidth = font.getStringWidth("out");
-        int outX = 152 - outTextWidth - 2;
-        return juce::Rectangle<int>(outX - 5, buttonY - 5, outTextWidth + 10, 20 + 10).contains(pos);
+        return getHitAreas().outButton.contains(pos);
     }
     
     bool hitTestPresetButton(juce::Point<int> pos) const {
-        int buttonY = 126 + 4 + 23 - 10 - 8 - 2;
-        return preset.hitTestPresetButton(pos, buttonY);
+        return getHitAreas().presetButton.contains(pos);
     }
     
     bool hitTestPresetDropdownButton(juce::Point<int> pos) const {
-        int buttonY = 121 + 4 + 23 - 10 - 8 - 2; // 5px 아래로 이동
-        return preset.hitTestPresetDropdownButton(pos, buttonY);
+        return getHitAreas().presetDropdownButton.contains(pos);
     }
     
     bool hitTestBypassButton(juce::Point<int> pos) const {
-        int bypassY = 265 - 4 - 20; // 5px 아래로 이동
-        juce::Font font("Euclid Circular B", DEFAULT_FONT_SIZE, juce::Font::plain);
-        int bypassTextWidth = font.getStringWidth("bypass");
-        int bypassX = 80 - bypassTextWidth / 2;
-        return juce::Rectangle<int>(bypassX, bypassY, bypassTextWidth, 20).contains(pos);
+        return getHitAreas().bypassButton.contains(pos);
     }
     
     Preset& getPreset() { return preset; }
@@ -1282,103 +941,151 @@ public:
     }
     
 private:
+    struct HitAreas {
+        juce::Rectangle<int> inButton, outButton, presetButton, presetDropdownButton, bypassButton;
+    };
+    
+    // 글리프 캐시가 비워졌거나 preset 레이블이 바뀌었을 때만 다시 계산
+    const HitAreas& getHitAreas() const {
+        auto& text = uiText();
+        if (hitAreasGeneration == text.getGeneration() && hitAreasPresetVersion == preset.getLabelVersion()) {
+            return hitAreas;
+        }
+        
+        int buttonY = 121 + 4 + 23 - 10 - 8 - 2; // 5px 아래로 이동
+        int inX = 8 + 2;
+        int inTextWidth = text.getStringWidth("in", DEFAULT_FONT_SIZE);
+        hitAreas.inButton = juce::Rectangle<int>(inX - 5, buttonY - 5, inTextWidth + 10, 20 + 10);
+        
+        int outTextWidth = text.getStringWidth("out", DEFAULT_FONT_SIZE);
+        int outX = 152 - outTextWidth - 2;
+        hitAreas.outButton = juce::Rectangle<int>(outX - 5, buttonY - 5, outTextWidth + 10, 20 + 10);
+        
+        hitAreas.presetButton = preset.getButtonHitArea(126 + 4 + 23 - 10 - 8 - 2);
+        hitAreas.presetDropdownButton = preset.getDropdownButtonHitArea(buttonY);
+        
+        int bypassY = 265 - 4 - 20; // 5px 아래로 이동
+        int bypassTextWidth = text.getStringWidth("bypass", DEFAULT_FONT_SIZE);
+        int bypassX = 80 - bypassTextWidth / 2;
+        hitAreas.bypassButton = juce::Rectangle<int>(bypassX, bypassY, bypassTextWidth, 20);
+        
+        hitAreasGeneration = text.getGeneration();
+        hitAreasPresetVersion = preset.getLabelVersion();
+        return hitAreas;
+    }
+    
+    static juce::Rectangle<int> getMeterToggleRect() {
+        int bypassY = 265 - 4 - 20;
+        return { 10, bypassY, 24, 20 };
+    }
+    
+    static constexpr float METER_TOGGLE_FONT_SIZE = 11.0f;
+    
     juce::Colour faceColor;
     juce::Colour textColor;
     bool bypassOn;
     Preset preset;
     bool arrowVisible;
+    mutable HitAreas hitAreas;
+    mutable juce::uint32 hitAreasGeneration = 0;
+    mutable int hitAreasPresetVersion = -1;
+    bool meterVisible = false;
 };
 
-class ClearHostApp : public juce::AudioAppComponent, public juce::AudioProcessorPlayer, public juce::AudioProcessorListener, public juce::Slider::Listener, public juce::ComboBox::Listener, public juce::Button::Listener, public juce::Timer {
+class ClearHostApp : public juce::AudioAppComponent, public juce::AudioProcessorPlayer, public juce::AudioProcessorListener, public juce::Slider::Listener, public juce::ComboBox::Listener, public juce::Button::Listener, private juce::AsyncUpdater {
 public:
-    ClearHostApp() {
+    explicit ClearHostApp(HostSettings& settings) : hostSettings(settings) {
         animationDuration = 1.0;
-        animationTimerInterval = 16;
-        originalSystemOutputDevice = "";
+        registerAnimationTracks();
+        clearBypass.setFadeMs(hostSettings.getBypassFadeMs());
+        
+        // 체인 이펙트가 실행 중 지연을 바꾸면 dry 녹음 지연도 맞춤 (슬롯 bypass는 슬롯 리스너가 이미 맞춤)
+        juce::Component::SafePointer<ClearHostApp> chainOwner(this);
+        pluginChain.onLatencyChanged = [chainOwner] {
+            juce::MessageManager::callAsync([chainOwner] {
+                if (chainOwner == nullptr) return;
+                chainOwner->audioCallback.setDryLatencySamples(chainOwner->getTotalLatencySamples());
+                CLR_LOG_INFO("Effect chain latency changed: " + juce::String(chainOwner->getTotalLatencySamples()) + " samples");
+            });
+        };
         isWindowMinimized = false; // 창 최소화 상태 추적
         
         static EuclidLookAndFeel euclidLF;
         juce::LookAndFeel::setDefaultLookAndFeel(&euclidLF);
         
-        performAutoSetup();
-        pluginManager.addDefaultFormats();
+        // 첫 페인트, 자동 설정, 플러그인 로드가 모두 끝나면 단계별 시간을 한 줄로 기록
+        startupProfiler.setFirstPaintBudgetMs(FIRST_PAINT_BUDGET_MS);
+        startupProfiler.setPendingTasks(3);
         
-        // LED 초기화 (플러그인 로드 전에 먼저 생성)
-        pluginStatusLED = std::make_unique<LED>(juce::Point<int>(0, 0), LEDState::OFF);
-        
-        // Face 초기화
-        face = std::make_unique<Face>();
-        
-        // Panel 초기화 (LED 초기화 후에 생성)
-        controlPanel = std::make_unique<Panel>(juce::Point<int>(0, 0), knobValues, knobRects, pluginStatusLED, face->getColor(), knobShowValues, face->getTextColor(), face->isDarkMode());
-        
-        // Bottom 초기화
-        bottom = std::make_unique<Bottom>(face->getColor(), face->getTextColor());
-        
-        // ColorPicker 초기화 (오른쪽 아래 위치)
-        colorPicker = std::make_unique<ColorPicker>();
-        colorPicker->setPosition(juce::Point<int>(143, 252)); // 좌로 1px, 아래로 1px 이동
-        
-        // AudioRecorder 초기화
-        audioRecorder = std::make_unique<AudioRecorder>();
+        {
+            StartupProfiler::ScopedPhase phase(startupProfiler, "components");
+            pluginManager.addDefaultFormats();
+            
+            // LED 초기화 (플러그인 로드 전에 먼저 생성) - 로드가 끝날 때까지 로딩 상태
+            pluginStatusLED = std::make_unique<LED>(juce::Point<int>(0, 0), LEDState::LOADING);
+            
+            // Face 초기화
+            face = std::make_unique<Face>(hostSettings);
+            
+            // Panel 초기화 (LED 초기화 후에 생성)
+            controlPanel = std::make_unique<Panel>(juce::Point<int>(0, 0), knobValues, knobRects, pluginStatusLED, face->getColor(), knobShowValues, face->getTextColor(), face->isDarkMode());
+            
+            // Bottom 초기화
+            bottom = std::make_unique<Bottom>(face->getColor(), face->getTextColor());
+            
+            // ColorPicker 초기화 (오른쪽 아래 위치)
+            colorPicker = std::make_unique<ColorPicker>();
+            colorPicker->setPosition(juce::Point<int>(143, 252)); // 좌로 1px, 아래로 1px 이동
+            
+            // AudioRecorder 초기화 - 지난 실행에서 비정상 종료로 남은 녹음이 있으면 백그라운드에서 복구
+            audioRecorder = std::make_unique<AudioRecorder>();
+            audioRecorder->onRecordingSaved = [](const juce::File& file) {
+                file.revealToUser();
+                CLR_LOG_INFO("Successfully opened desktop folder");
+            };
+            audioRecorder->recoverOrphanedRecordingsAsync();
+        }
         
-        loadClearVST3();
-        setAudioChannels(2, 2);
+        {
+            // 플러그인이 없는 동안에는 getNextAudioBlock이 무음을 출력
+            StartupProfiler::ScopedPhase phase(startupProfiler, "audio");
+            setAudioChannels(2, 2);
+            
+            // 입력 채널 활성화 직후 바로 unassigned로 설정 (마이크 입력 방지)
+            auto currentSetup = deviceManager.getAudioDeviceSetup();
+            currentSetup.inputDeviceName = ""; // 입력 장치 비활성화
+            deviceManager.setAudioDeviceSetup(currentSetup, true);
+            CLR_LOG_WARNING("Input device immediately disabled after audio channels setup");
+        }
         
-        // 입력 채널 활성화 직후 바로 unassigned로 설정 (마이크 입력 방지)
-        auto currentSetup = deviceManager.getAudioDeviceSetup();
-        currentSetup.inputDeviceName = ""; // 입력 장치 비활성화
-        deviceManager.setAudioDeviceSetup(currentSetup, true);
-        juce::Logger::writeToLog("Input device immediately disabled after audio channels setup");
+        // 이후 장치 전환은 코얼레싱/페이드 후 메시지 스레드에서 적용되고, 적용 직후 결과를 받음
+        juce::Component::SafePointer<ClearHostApp> safeThis(this);
+        deviceTransitions.onTransitionFinished = [safeThis](const DeviceTransitionScheduler::Result& result) {
+            if (safeThis != nullptr) safeThis->deviceTransitionFinished(result);
+        };
         
-        auto midiInputs = juce::MidiInput::getAvailableDevices();
-        if (!midiInputs.isEmpty()) {
-            midiInput = juce::MidiInput::openDevice(midiInputs[0].identifier, this);
-            if (midiInput) midiInput->start();
-        }
-        setProcessor(clearPlugin.get());
-        // 플러그인 에디터 생성 및 표시
-        if (clearPlugin) {
-            try {
-                pluginEditor.reset(clearPlugin->createEditor());
-                if (pluginEditor) {
-                    pluginEditor->setOpaque(true); // 완전히 불투명하게
-                    addAndMakeVisible(pluginEditor.get());
-                    juce::Logger::writeToLog("Plugin editor created successfully");
-                } else {
-                    juce::Logger::writeToLog("Warning: Failed to create plugin editor");
-                }
-            } catch (const std::exception& e) {
-                juce::Logger::writeToLog("Exception creating plugin editor: " + juce::String(e.what()));
-            } catch (...) {
-                juce::Logger::writeToLog("Unknown exception creating plugin editor");
-            }
-            
-            try {
-                juce::Logger::writeToLog("Registering parameter listener...");
-                clearPlugin->addListener(this);
-                isAnimating = false;
-                startTimer(100); // 파라미터 동기화용
-                
-                // LED 상태를 On으로 설정
-                if (pluginStatusLED) {
-                    pluginStatusLED->setState(true);
-                    juce::Logger::writeToLog("LED set to ON - plugin loaded successfully");
-                }
-            } catch (const std::exception& e) {
-                juce::Logger::writeToLog("Exception registering parameter listener: " + juce::String(e.what()));
-            } catch (...) {
-                juce::Logger::writeToLog("Unknown exception registering parameter listener");
-            }
-        } else {
-            // 플러그인이 로드되지 않았으면 LED를 Off로 설정
-            if (pluginStatusLED) {
-                pluginStatusLED->setState(false);
-                juce::Logger::writeToLog("LED set to OFF - plugin failed to load");
+        {
+            StartupProfiler::ScopedPhase phase(startupProfiler, "midi");
+            auto midiInputs = juce::MidiInput::getAvailableDevices();
+            if (!midiInputs.isEmpty()) {
+                midiInput = juce::MidiInput::openDevice(midiInputs[0].identifier, this);
+                if (midiInput) midiInput->start();
             }
         }
+        
+        // 셸 명령을 실행하는 자동 설정은 백그라운드 스레드에서 진행
+        // (플러그인 생성은 첫 페인트 이후 paint()에서 시작)
+        runAutoSetupInBackground();
+        
+        // 현재 시스템 사운드 출력 소스 저장 (라우팅 서비스 워커 스레드)
+        saveCurrentSystemOutputDevice();
         setSize(160, 265); // 창 크기를 160x265로 설정 (5px 줄임)
         
+        // 오디오 성능 오버레이 (기본은 숨김, Bottom의 "cpu"로 토글)
+        meterOverlay = std::make_unique<AudioMeterOverlay>(audioMeter);
+        meterOverlay->setBounds(6, 6, 148, 58);
+        addChildComponent(meterOverlay.get());
+        
         // 노브 컨트롤들 생성
         for (int i = 0; i < 3; ++i) {
             auto knob = std::make_unique<juce::Slider>(juce::Slider::RotaryHorizontalVerticalDrag, juce::Slider::TextBoxBelow);
@@ -1405,6 +1112,12 @@ public:
         // 드롭다운용 장치 리스트 초기화
         updateInputDeviceList();
         updateOutputDeviceList();
+        restoreSavedInputDevice();
+        {
+            // 사용자 프리셋은 시작 시 모두 메모리로 읽어둠 (불러올 때 파일 I/O 없음)
+            StartupProfiler::ScopedPhase phase(startupProfiler, "presets");
+            presetStore.loadAll();
+        }
         updatePresetList();
         
         // 라벨 설정
@@ -1457,8 +1170,7 @@ public:
         // 로고 SVG 로드
         loadLogoSVGs();
         
-        // 오디오 녹음 기능 초기화 (기본 샘플레이트로 초기화, prepareToPlay에서 실제 샘플레이트로 업데이트)
-        audioRecorder = std::make_unique<AudioRecorder>();
+        startupProfiler.markMilestone("constructed");
     }
     
     // 창 가시성 변경 감지
@@ -1478,7 +1190,7 @@ public:
                 // 창이 최소화되거나 기본창 모드일 때 플러그인 렌더링 비활성화
                 if (pluginEditor) {
                     pluginEditor->setVisible(false);
-                    juce::Logger::writeToLog("Plugin rendering disabled - window minimized or small");
+                    CLR_LOG_WARNING("Plugin rendering disabled - window minimized or small");
                 }
             } else {
                 // 창이 최대화되면 플러그인 렌더링 활성화
@@ -1487,7 +1199,7 @@ public:
                     // 렌더링 복구를 위해 강제로 다시 그리기
                     pluginEditor->repaint();
                     repaint(); // 메인 컴포넌트도 다시 그리기
-                    juce::Logger::writeToLog("Plugin rendering enabled - window restored");
+                    CLR_LOG_INFO("Plugin rendering enabled - window restored");
                 }
             }
         }
@@ -1495,7 +1207,8 @@ public:
     ~ClearHostApp() override {
         try {
             isBeingDeleted = true;
-            stopTimer();
+            animationScheduler.cancelAll();
+            cancelPendingUpdate();
 
             // 슬라이더 리스너 해제
             for (auto* knob : knobs) {
@@ -1505,9 +1218,9 @@ public:
             if (inputDeviceBox) inputDeviceBox->removeListener(this);
             if (outputDeviceBox) outputDeviceBox->removeListener(this);
         } catch (const std::exception& e) {
-            juce::Logger::writeToLog("Exception in destructor: " + juce::String(e.what()));
+            CLR_LOG_ERROR("Exception in destructor: " + juce::String(e.what()));
         } catch (...) {
-            juce::Logger::writeToLog("Unknown exception in destructor");
+            CLR_LOG_ERROR("Unknown exception in destructor");
         }
         // 벡터들 정리
         knobRects.clear();
@@ -1545,46 +1258,81 @@ public:
         pluginStatusLED.reset();
         // clearPlugin 관련 해제는 MainWindow::closeButtonPressed에서 처리
     }
+    // 장치 관리자가 장치를 다시 시작할 때마다 호출되므로 플러그인 교체와 pluginPrepareLock으로 직렬화
     void prepareToPlay(int samplesPerBlockExpected, double sampleRate) override {
+        const juce::ScopedLock pl(pluginPrepareLock);
         if (clearPlugin) clearPlugin->prepareToPlay(sampleRate, samplesPerBlockExpected);
+        pluginChain.prepare(sampleRate, samplesPerBlockExpected);
+        preparedSampleRate = sampleRate;
+        preparedBlockSize = samplesPerBlockExpected;
+        
+        // bypass dry 경로 (장치가 예고보다 큰 블록을 보내는 경우를 대비해 여유 있게)
+        clearBypass.prepare(sampleRate, 2, juce::jmax(samplesPerBlockExpected, HostAudioCallback::MIN_DRY_INPUT_FRAMES),
+                            clearPlugin ? clearPlugin->getLatencySamples() : 0);
         
-        // AudioRecorder를 실제 샘플레이트로 업데이트
+        // 페이더, 계측기, 노브 스무더, 콜백 전용 버퍼(dry 사본, MIDI)와 MIDI CC 컬렉터
+        audioCallback.prepare(sampleRate, samplesPerBlockExpected, getTotalLatencySamples());
+        
+        // AudioRecorder를 실제 샘플레이트로 업데이트 (재생성하지 않고 설정만 갱신)
         if (audioRecorder) {
-            // 기존 AudioRecorder를 해제하고 새로운 샘플레이트로 재생성
-            audioRecorder.reset();
-            audioRecorder = std::make_unique<AudioRecorder>(static_cast<int>(sampleRate));
-            juce::Logger::writeToLog("AudioRecorder updated with actual sample rate: " + juce::String(static_cast<int>(sampleRate)));
+            audioRecorder->prepare(sampleRate, samplesPerBlockExpected);
+            CLR_LOG_INFO("AudioRecorder updated with actual sample rate: " + juce::String(static_cast<int>(sampleRate)));
         }
     }
     void getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill) override {
-        if (clearPlugin) {
-            juce::MidiBuffer midiMessages;
-            clearPlugin->processBlock(*bufferToFill.buffer, midiMessages);
-            
-            // 오디오 녹음 처리 (녹음 중일 때만 최소한의 처리)
-            if (audioRecorder && audioRecorder->isRecordingActive()) {
-                const float* const* outputData = bufferToFill.buffer->getArrayOfReadPointers();
-                audioRecorder->processAudioData(nullptr, 0, outputData, bufferToFill.buffer->getNumChannels(), bufferToFill.numSamples);
-            }
-        } else {
-            for (int i = 0; i < bufferToFill.buffer->getNumChannels(); ++i) {
-                float* channelData = bufferToFill.buffer->getWritePointer(i);
-                for (int j = 0; j < bufferToFill.numSamples; ++j) {
-                    channelData[j] = 0.0f;
-                }
-            }
-        }
+        // 콜백 본체는 HostAudioCallback (실시간 할당 테스트가 같은 코드를 돌림)
+        audioCallback.process(bufferToFill, clearPlugin.get(), audioRecorder.get());
     }
+    
     void releaseResources() override {
+        const juce::ScopedLock pl(pluginPrepareLock);
         if (clearPlugin) clearPlugin->releaseResources();
+        pluginChain.release();
+        audioCallback.release();
+        preparedSampleRate = 0.0;
+        preparedBlockSize = 0;
+        
+        CLR_LOG_EVENT(LogLevel::debug, LogCode::audioThreadAllocations, (double)RealtimeAllocationTracker::getAllocationCount());
     }
     void handleIncomingMidiMessage(juce::MidiInput*, const juce::MidiMessage& message) override {
         // 소멸 중이면 콜백 무시
         if (isBeingDeleted || !clearPlugin) return;
         
-        if (message.isController() && clearPlugin) mapMidiCCToClearParameter(message);
+        if (!message.isController()) return;
+        
+        // 파라미터 변경은 오디오 스레드가 블록 내 정확한 위치에서 적용
+        audioCallback.addMidiMessage(message);
+        
+        // UI 상태(노브 표시, bypass 표시, preset 리셋)는 CC마다 마지막 값만 남기고 메시지 스레드에서 한 번에 갱신
+        // (노브를 돌리면 CC가 초당 수백 개 오므로 메시지마다 callAsync를 쌓지 않음)
+        const int cc = message.getControllerNumber() - HostAudioCallback::FIRST_MIDI_CC;
+        if (cc < 0 || cc >= HostAudioCallback::NUM_MIDI_CC_TARGETS) return;
+        pendingMidiCCValues[(size_t)cc].store(message.getControllerValue());
+        triggerAsyncUpdate();
+    }
+    
+    // 메시지 스레드: MIDI 스레드가 남긴 CC별 마지막 값으로 UI 갱신
+    void handleAsyncUpdate() override {
+        for (int i = 0; i < HostAudioCallback::NUM_MIDI_CC_TARGETS; ++i) {
+            const int ccValue = pendingMidiCCValues[(size_t)i].exchange(NO_PENDING_MIDI_CC);
+            if (ccValue != NO_PENDING_MIDI_CC) {
+                mapMidiCCToClearParameter(HostAudioCallback::FIRST_MIDI_CC + i, ccValue);
+            }
+        }
     }
     void paint(juce::Graphics& g) override {
+        if (!firstPaintDone) {
+            firstPaintDone = true;
+            startupProfiler.markMilestone("firstPaint");
+            startupProfiler.taskFinished();
+            
+            // 창이 한 번 그려진 뒤에 플러그인 생성 시작 (VST3는 메시지 스레드에서 생성되므로 첫 페인트를 막지 않도록)
+            juce::Component::SafePointer<ClearHostApp> safeThis(this);
+            juce::MessageManager::callAsync([safeThis] {
+                if (safeThis != nullptr) safeThis->loadClearVST3();
+            });
+        }
+        
         auto bounds = getLocalBounds();
         int w = bounds.getWidth();
         int h = bounds.getHeight();
@@ -1592,41 +1340,22 @@ public:
         int col3 = w - col1; // 3번 캔버스 (나머지 공간)
         // 플러그인 관련 멤버 접근 전 nullptr/size 체크
         if (knobRects.size() < 3 || knobValues.size() < 3) {
-            juce::Logger::writeToLog("paint: knobRects/knobValues size error");
+            CLR_LOG_ERROR("paint: knobRects/knobValues size error");
             return;
         }
         // 1단: 검정색 배경
         juce::Rectangle<int> leftArea(0, 0, col1, h);
         g.setColour(juce::Colours::black);
         g.fillRect(leftArea);
-        // Face 그리기 (좌상단 0,0에서 160x280)
-        if (face) {
-            face->draw(g);
-        }
-        
-        // 로고 그리기 (Face 바로 위, Panel 아래)
-        drawLogo(g, face->getTextColor());
+        // Face + 세퍼레이터 + 로고 (캐시된 정적 레이어, Panel 아래)
+        drawStaticLayer(g);
         // Panel 그리기 (노브 3개 + LED + Stereo 토글) - 1번 캔버스로 이동
         juce::Point<int> panelCenter(80, 78); // 노브2(voice) 중앙을 x=80px, y=78px에 위치 (5px 아래로 이동)
         if (controlPanel) {
             // Stereo/Mono 버튼 텍스트 업데이트
             juce::String stereoText = "stereo";
-            if (clearPlugin) {
-                auto params = clearPlugin->getParameters();
-                if (params.size() > 13 && params[13] != nullptr) {
-                    try {
-                        float value = params[13]->getValue();
-                        if (value < 0.5f) {
-                            stereoText = "mono";
-                        }
-                    } catch (const std::exception& e) {
-                        // 파라미터 접근 실패 시 기본값 유지
-                        juce::Logger::writeToLog("Warning: Failed to access parameter 13: " + juce::String(e.what()));
-                    } catch (...) {
-                        // 파라미터 접근 실패 시 기본값 유지
-                        juce::Logger::writeToLog("Warning: Failed to access parameter 13");
-                    }
-                }
+            if (clearPlugin && parameterMap.getValue(ParameterMap::Role::stereo, 1.0f) < 0.5f) {
+                stereoText = "mono";
             }
             controlPanel->updateStereoText(stereoText);
             
@@ -1637,6 +1366,11 @@ public:
             
             controlPanel->center = panelCenter;
             controlPanel->draw(g, currentMousePos);
+            
+            // 실제로 그린 그림자 위치 기록 (호버 시 다시 그릴지 판단 기준)
+            for (int i = 0; i < (int)paintedShadowOffsets.size(); ++i) {
+                paintedShadowOffsets[(size_t)i] = getKnobShadowOffset(i, currentMousePos);
+            }
         }
         
         // Bottom 그리기 (화살표 Drawable 전달)
@@ -1659,31 +1393,7 @@ public:
             int dropdownHeight = std::min(MAX_VISIBLE_ITEMS * ITEM_HEIGHT, (int)inputDeviceList.size() * ITEM_HEIGHT);
             inputDropdownRect = juce::Rectangle<int>(10, dropdownY, 140, dropdownHeight);
             
-            inputDeviceRects.clear();
-            int visibleCount = std::min(MAX_VISIBLE_ITEMS, (int)inputDeviceList.size() - inputScrollOffset);
-            
-            for (int i = 0; i < visibleCount; ++i) {
-                int actualIndex = i + inputScrollOffset;
-                juce::Rectangle<int> itemRect(inputDropdownRect.getX(), inputDropdownRect.getY() + i * ITEM_HEIGHT, inputDropdownRect.getWidth(), ITEM_HEIGHT);
-                inputDeviceRects.push_back(itemRect);
-                
-                // 현재 선택된 장치인지 확인
-                bool isSelected = (inputDeviceList[actualIndex] == currentInputDevice);
-                
-                // bypass 상태에 따른 알파값 적용
-                g.setColour(face->getTextColor().withAlpha(alpha));
-                g.drawText(inputDeviceList[actualIndex].toLowerCase(), itemRect, juce::Justification::centredLeft);
-                
-                // 현재 선택된 장치에 언더라인 그리기
-                if (isSelected) {
-                    // 현재 설정된 폰트 사용 (텍스트 그리기와 동일한 폰트)
-                    int textWidth = g.getCurrentFont().getStringWidth(inputDeviceList[actualIndex].toLowerCase());
-                    int underlineY = itemRect.getY() + 15; // 텍스트 아래 3px (1px 아래로 이동)
-                    int underlineX = itemRect.getX(); // 오른쪽으로 1px 이동 (-1px -> 0px)
-                    g.setColour(face->getTextColor().withAlpha(alpha));
-                    g.drawLine(underlineX, underlineY, underlineX + textWidth, underlineY, 1.0f);
-                }
-            }
+            drawDropdownList(g, inputDeviceList, currentInputDevice, inputDropdownRect, inputScrollOffset, MAX_VISIBLE_ITEMS, ITEM_HEIGHT, inputDeviceRects, juce::Justification::centredLeft, 0, alpha, face->getTextColor());
         }
         
         // 출력 드롭다운이 열려있으면 장치 리스트 표시 (out 버튼 바로 아래)
@@ -1699,31 +1409,7 @@ public:
             int dropdownHeight = std::min(MAX_VISIBLE_ITEMS * ITEM_HEIGHT, (int)outputDeviceList.size() * ITEM_HEIGHT);
             outputDropdownRect = juce::Rectangle<int>(10, dropdownY, 140, dropdownHeight);
             
-            outputDeviceRects.clear();
-            int visibleCount = std::min(MAX_VISIBLE_ITEMS, (int)outputDeviceList.size() - outputScrollOffset);
-            
-            for (int i = 0; i < visibleCount; ++i) {
-                int actualIndex = i + outputScrollOffset;
-                juce::Rectangle<int> itemRect(outputDropdownRect.getX(), outputDropdownRect.getY() + i * ITEM_HEIGHT, outputDropdownRect.getWidth(), ITEM_HEIGHT);
-                outputDeviceRects.push_back(itemRect);
-                
-                // 현재 선택된 장치인지 확인
-                bool isSelected = (outputDeviceList[actualIndex] == currentOutputDevice);
-                
-                // bypass 상태에 따른 알파값 적용
-                g.setColour(face->getTextColor().withAlpha(alpha));
-                g.drawText(outputDeviceList[actualIndex].toLowerCase(), itemRect, juce::Justification::centredRight);
-                
-                // 현재 선택된 장치에 언더라인 그리기
-                if (isSelected) {
-                    // 현재 설정된 폰트 사용 (텍스트 그리기와 동일한 폰트)
-                    int textWidth = g.getCurrentFont().getStringWidth(outputDeviceList[actualIndex].toLowerCase());
-                    int underlineY = itemRect.getY() + 15; // 텍스트 아래 3px (1px 아래로 이동)
-                    int underlineX = itemRect.getX() + itemRect.getWidth() - textWidth; // 왼쪽으로 1px 이동 (+1px -> 0px)
-                    g.setColour(face->getTextColor().withAlpha(alpha));
-                    g.drawLine(underlineX, underlineY, underlineX + textWidth, underlineY, 1.0f);
-                }
-            }
+            drawDropdownList(g, outputDeviceList, currentOutputDevice, outputDropdownRect, outputScrollOffset, MAX_VISIBLE_ITEMS, ITEM_HEIGHT, outputDeviceRects, juce::Justification::centredRight, 0, alpha, face->getTextColor());
         }
         
         // preset 드롭다운이 열려있으면 프리셋 리스트 표시 (preset 버튼 바로 아래, 중앙 정렬)
@@ -1791,22 +1477,8 @@ public:
             }
         }
         
-        if (knobIndex >= 0 && knobIndex < 3) {
-            // Clear 플러그인의 파라미터를 인덱스로 직접 매핑
-            auto params = clearPlugin->getParameters();
-            int targetParamIndex = -1;
-            
-            switch (knobIndex) {
-                case 0: targetParamIndex = 1; break;  // Ambience Gain
-                case 1: targetParamIndex = 14; break; // Voice Gain
-                case 2: targetParamIndex = 12; break; // Voice Reverb Gain
-            }
-            
-            if (targetParamIndex >= 0 && targetParamIndex < params.size() && params[targetParamIndex]) {
-                float value = (float)slider->getValue();
-                params[targetParamIndex]->setValueNotifyingHost(value);
-                juce::Logger::writeToLog("Knob " + juce::String(knobIndex) + " -> Parameter " + juce::String(targetParamIndex) + " (" + params[targetParamIndex]->getName(100) + ") = " + juce::String(value));
-            }
+        if (knobIndex >= 0 && knobIndex < ParameterMap::NUM_KNOBS) {
+            setKnobParameter(knobIndex, (float)slider->getValue());
         }
     }
     
@@ -1815,12 +1487,7 @@ public:
         if (isBeingDeleted || !clearPlugin) return;
         
         // 노브 값 업데이트 (파라미터 인덱스에 따른 매핑)
-        int knobIndex = -1;
-        switch (parameterIndex) {
-            case 1: knobIndex = 0; break;  // Ambience Gain
-            case 14: knobIndex = 1; break; // Voice Gain
-            case 12: knobIndex = 2; break; // Voice Reverb Gain
-        }
+        int knobIndex = parameterMap.knobIndexForParameterIndex(parameterIndex);
         
         if (knobIndex >= 0 && knobIndex < knobValues.size()) {
             // 플러그인 파라미터 값(0~1)을 노브 값(0~2)으로 변환
@@ -1830,27 +1497,36 @@ public:
             // 노브 값 표시 상태 업데이트
             updateKnobDisplayState(knobIndex, knobValue);
         
-        repaint();
+            repaintKnob(knobIndex);
         }
     }
     
-    void audioProcessorChanged(juce::AudioProcessor*, const juce::AudioProcessorListener::ChangeDetails&) override {
+    void audioProcessorChanged(juce::AudioProcessor*, const juce::AudioProcessorListener::ChangeDetails& details) override {
         // 소멸 중이면 콜백 무시
         if (isBeingDeleted || !clearPlugin) return;
         
-        // 플러그인 변경 시 처리 (필요시)
-    }
+        // 지연이 바뀌면 bypass dry 경로도 맞춤 (어느 스레드에서 불려도 atomic 저장만)
+        if (details.latencyChanged) {
+            clearBypass.setLatencySamples(clearPlugin->getLatencySamples());
+            
+            // 체인 구성은 메시지 스레드에서만 읽으므로 dry 녹음 지연은 메시지 스레드에서 다시 계산
+            juce::Component::SafePointer<ClearHostApp> safeThis(this);
+            juce::MessageManager::callAsync([safeThis] {
+                if (safeThis != nullptr) safeThis->audioCallback.setDryLatencySamples(safeThis->getTotalLatencySamples());
+            });
+        }
+    }
     
     void comboBoxChanged(juce::ComboBox* comboBox) override {
         if (comboBox == inputDeviceBox.get()) {
             int selectedId = inputDeviceBox->getSelectedId();
             if (selectedId > 0) {
                 juce::String deviceName = inputDeviceBox->getText();
-                juce::Logger::writeToLog("Selected input device: " + deviceName);
+                CLR_LOG_INFO("Selected input device: " + deviceName);
                 
                 // 비활성화된 BlackHole 옵션 선택 시 처리
                 if (deviceName.contains("Not Installed")) {
-                    juce::Logger::writeToLog("BlackHole not installed - showing info");
+                    CLR_LOG_WARNING("BlackHole not installed - showing info");
                     // 여기에 나중에 설치 안내 다이얼로그를 추가할 수 있습니다
                     // 현재는 기본 입력으로 되돌리기
                     inputDeviceBox->setSelectedId(1, juce::dontSendNotification);
@@ -1859,11 +1535,11 @@ public:
                 
                 // OS Sound (BlackHole) 입력 선택 시 현재 시스템 출력 소스 저장
                 if (deviceName.contains("OS Sound (BlackHole)")) {
-                    juce::Logger::writeToLog("OS Sound input selected - saving current system output device");
+                    CLR_LOG_INFO("OS Sound input selected - saving current system output device");
                     saveCurrentSystemOutputDevice();
         } else {
                     // 다른 입력 소스 선택 시 저장된 시스템 출력 소스로 복구
-                    juce::Logger::writeToLog("Non-OS Sound input selected - restoring original system output device");
+                    CLR_LOG_INFO("Non-OS Sound input selected - restoring original system output device");
                     restoreSystemOutputDevice();
                 }
                 
@@ -1874,7 +1550,7 @@ public:
             int selectedId = outputDeviceBox->getSelectedId();
             if (selectedId > 0) {
                 juce::String deviceName = outputDeviceBox->getText();
-                juce::Logger::writeToLog("Selected output device: " + deviceName);
+                CLR_LOG_INFO("Selected output device: " + deviceName);
                 // 실제 오디오 출력 장치 변경
                 changeAudioOutputDevice(deviceName);
             }
@@ -1901,27 +1577,59 @@ public:
             startAnimation({0.5, 0.2, 0.2});
         } else if (button == stereoMonoButton.get()) {
             // Stereo/Mono 토글
-            if (clearPlugin) {
-                auto params = clearPlugin->getParameters();
-                if (params.size() > 13 && params[13] != nullptr) {
-                    try {
-                        float currentValue = params[13]->getValue();
-                        float newValue = (currentValue > 0.5f) ? 0.0f : 1.0f; // 토글
-                        params[13]->setValueNotifyingHost(newValue);
-                        
-                        // 버튼 텍스트 업데이트
-                        juce::String buttonText = (newValue > 0.5f) ? "Stereo" : "Mono";
-                        stereoMonoButton->setButtonText(buttonText);
-                        
-                        juce::Logger::writeToLog("Toggled Stereo/Mono to: " + buttonText + " (value: " + juce::String(newValue) + ")");
-                    } catch (...) {
-                        juce::Logger::writeToLog("Warning: Failed to toggle Stereo/Mono parameter");
-                    }
-                }
+            if (clearPlugin && parameterMap.has(ParameterMap::Role::stereo)) {
+                float currentValue = parameterMap.getValue(ParameterMap::Role::stereo);
+                float newValue = (currentValue > 0.5f) ? 0.0f : 1.0f; // 토글
+                parameterMap.setValueNotifyingHost(ParameterMap::Role::stereo, newValue);
+                hostSettings.setStereo(newValue > 0.5f);
+                
+                // 버튼 텍스트 업데이트
+                juce::String buttonText = (newValue > 0.5f) ? "Stereo" : "Mono";
+                stereoMonoButton->setButtonText(buttonText);
+                
+                CLR_LOG_DEBUG("Toggled Stereo/Mono to: " + buttonText + " (value: " + juce::String(newValue) + ")");
             }
         }
     }
     
+    void showRecordingMenu() {
+        if (!audioRecorder) return;
+
+        constexpr int saveRetroactiveId = 100;
+        constexpr int prependRetroactiveId = 101;
+        constexpr int captureDryInputId = 102;
+
+        juce::PopupMenu menu;
+        const auto retroSeconds = juce::String(juce::roundToInt(audioRecorder->getRetroactiveSeconds()));
+        menu.addItem(saveRetroactiveId, "Save last " + retroSeconds + " s", audioRecorder->getRetroactiveSeconds() > 0.0);
+        menu.addItem(prependRetroactiveId, "Prepend last " + retroSeconds + " s on Rec", true, audioRecorder->isPrependRetroactiveEnabled());
+
+        const bool recording = audioRecorder->isRecordingActive();
+        menu.addItem(captureDryInputId, "Also record dry input (_dry file)", !recording, audioRecorder->isCaptureDryInputEnabled());
+
+        menu.addSectionHeader("Recording format");
+        for (int i = 0; i < (int)RecordingFormat::numFormats; ++i) {
+            auto format = (RecordingFormat)i;
+            menu.addItem(i + 1, RecordingEncoder::getFormatName(format), !recording, audioRecorder->getFormat() == format);
+        }
+
+        juce::Component::SafePointer<ClearHostApp> safeThis(this);
+        menu.showMenuAsync(juce::PopupMenu::Options(), [safeThis](int result) {
+            if (safeThis == nullptr || result <= 0 || !safeThis->audioRecorder) return;
+            auto& recorder = *safeThis->audioRecorder;
+
+            if (result == saveRetroactiveId) {
+                recorder.saveRetroactiveCapture();
+            } else if (result == prependRetroactiveId) {
+                recorder.setPrependRetroactive(!recorder.isPrependRetroactiveEnabled());
+            } else if (result == captureDryInputId) {
+                recorder.setCaptureDryInput(!recorder.isCaptureDryInputEnabled());
+            } else {
+                recorder.setFormat((RecordingFormat)(result - 1));
+            }
+        });
+    }
+
     void startAnimation(const std::array<double, 3>& targetValues) {
         for (int i = 0; i < 3; ++i) {
             animationStartValues[i] = knobValues[i];
@@ -1931,38 +1639,39 @@ public:
         }
         animationStartTime = juce::Time::getMillisecondCounterHiRes() / 1000.0;
         isAnimating = true;
-        startTimer(animationTimerInterval);
+        animationScheduler.cancel(labelFadeTrack);
+        animationScheduler.schedule(knobTweenTrack, 0.0);
+        
+        // 소리는 오디오 스레드가 같은 시간 동안 램프 (UI 트윈은 표시만)
+        for (int i = 0; i < 3; ++i) {
+            setKnobParameter(i, (float)targetValues[i], animationDuration * 1000.0);
+        }
     }
     
+    // 트윈 중 노브 표시값 갱신 (파라미터는 startAnimation에서 건 램프가 적용)
     void setKnobValue(int knobIndex, double value) {
         if (knobIndex >= 0 && knobIndex < knobValues.size()) {
             knobValues[knobIndex] = value;
             updateKnobDisplayState(knobIndex, value);
-            if (clearPlugin) {
-                auto params = clearPlugin->getParameters();
-                int targetParamIndex = -1;
-                switch (knobIndex) {
-                    case 0: targetParamIndex = 1; break;
-                    case 1: targetParamIndex = 14; break;
-                    case 2: targetParamIndex = 12; break;
-                }
-                if (targetParamIndex >= 0 && targetParamIndex < params.size() && params[targetParamIndex]) {
-                    // 0~2 범위를 0~1로 변환하여 플러그인에 전달
-                    float pluginValue = (float)(value / 2.0);
-                    params[targetParamIndex]->setValueNotifyingHost(pluginValue);
-                }
-            }
         }
     }
     
+    // 노브 파라미터 변경 (0~1) - 오디오가 돌고 있으면 스무더 목표 슬롯으로, 아니면 바로 설정
+    void setKnobParameter(int knobIndex, float normalisedValue, double rampMs = ParameterSmoother::DEFAULT_RAMP_MS) {
+        if (!clearPlugin) return;
+        hostSettings.setKnobValue(knobIndex, normalisedValue);
+        if (parameterSmoother.setTarget(knobIndex, normalisedValue, rampMs)) return;
+        parameterMap.setValueNotifyingHost(ParameterMap::roleForKnob(knobIndex), normalisedValue);
+    }
+    
     void updateKnobDisplayState(int knobIndex, float newValue) {
         if (knobIndex >= 0 && knobIndex < knobValues.size()) {
             // 값이 변경되었으면 표시 상태를 true로 설정
             if (std::abs(newValue - knobLastValues[knobIndex]) > 0.001f) {
                 knobShowValues[knobIndex] = true;
-                // 애니메이션 중이 아니고 드래그 중이 아닐 때만 타이머 설정
+                // 애니메이션 중이 아니고 드래그 중이 아닐 때만 (마지막 변경부터 다시 셈)
                 if (!isAnimating && draggingKnob == -1) {
-                    startTimer(500);
+                    animationScheduler.schedule(labelFadeTrack, LABEL_FADE_DELAY_MS);
                 }
             }
             knobLastValues[knobIndex] = newValue;
@@ -1975,113 +1684,79 @@ public:
         }
     }
     
-    void timerCallback() override {
-        static bool firstRun = true;
-        static int retryCount = 0;
-        const int MAX_RETRY_COUNT = 10;
-        
-        if (firstRun) {
-            // 첫 실행 시 저장된 장치 설정 적용
-            // applySavedDeviceSettings();
-            firstRun = false;
+    // 애니메이션 트랙 등록 (각 트랙은 자기 주기로 따로 돌고, 모두 멈추면 스케줄러가 완전히 쉼)
+    void registerAnimationTracks() {
+        knobTweenTrack = animationScheduler.addTrack("knobTween", [this] { return tickKnobTween(); });
+        recBlinkTrack = animationScheduler.addTrack("recBlink", [this] { return tickRecBlink(); });
+        labelFadeTrack = animationScheduler.addTrack("labelFade", [this] { return tickLabelFade(); });
+        paramSyncTrack = animationScheduler.addTrack("paramSync", [this] { return tickParameterSync(); });
+    }
+    
+    // 프리셋 노브 트윈 (매 프레임)
+    bool tickKnobTween() {
+        double currentTime = juce::Time::getMillisecondCounterHiRes() / 1000.0;
+        double elapsedTime = currentTime - animationStartTime;
+        double progress = juce::jlimit(0.0, 1.0, elapsedTime / animationDuration);
+        double easedProgress = 1.0 - std::pow(1.0 - progress, 3.0);
+        for (int i = 0; i < 3; ++i) {
+            double currentValue = animationStartValues[i] + (animationTargetValues[i] - animationStartValues[i]) * easedProgress;
+            setKnobValue(i, currentValue);
         }
+        repaintKnobs();
         
-        // Rec 버튼 업데이트 (깜빡임 효과)
-        if (controlPanel) {
-            controlPanel->updateRecButton();
+        if (progress < 1.0) return true;
+        
+        isAnimating = false;
+        CLR_LOG_DEBUG("Animation completed");
+        // 애니메이션 완료 후 0.5초 뒤에 레이블로 돌아가기
+        animationScheduler.schedule(labelFadeTrack, LABEL_FADE_DELAY_MS);
+        return false;
+    }
+    
+    // Rec 버튼 깜빡임 (녹음이 꺼지면 멈춤)
+    bool tickRecBlink() {
+        if (!controlPanel || !controlPanel->isRecButtonActive()) return false;
+        controlPanel->updateRecButton();
+        animationScheduler.repaint(Panel::getRecButtonArea());
+        return true;
+    }
+    
+    // 마지막 값 변경 후 노브 값 표시를 레이블로 되돌림 (한 번)
+    bool tickLabelFade() {
+        resetKnobDisplayStates();
+        repaintKnobs();
+        return false;
+    }
+    
+    // 플러그인 로드 직후 파라미터가 준비될 때까지 노브 값 동기화 재시도
+    bool tickParameterSync() {
+        if (clearPlugin && parameterMap.isValid()) {
+            updateKnobsFromPlugin();
+            paramSyncRetryCount = 0;
+            return false;
         }
         
-        if (isAnimating) {
-            double currentTime = juce::Time::getMillisecondCounterHiRes() / 1000.0;
-            double elapsedTime = currentTime - animationStartTime;
-            double progress = juce::jlimit(0.0, 1.0, elapsedTime / animationDuration);
-            double easedProgress = 1.0 - std::pow(1.0 - progress, 3.0);
-            for (int i = 0; i < 3; ++i) {
-                double currentValue = animationStartValues[i] + (animationTargetValues[i] - animationStartValues[i]) * easedProgress;
-                setKnobValue(i, currentValue);
-            }
-            repaint();
-            if (progress >= 1.0) {
-                isAnimating = false;
-                // Rec 버튼이 활성화되어 있으면 타이머 계속 실행, 아니면 정지
-                if (controlPanel && controlPanel->isRecButtonActive()) {
-                    startTimer(100); // 10fps로 깜빡임 업데이트 (20fps에서 10fps로 변경)
-                } else {
-                    stopTimer();
-                    juce::Logger::writeToLog("Animation completed");
-                    // 애니메이션 완료 후 0.5초 뒤에 레이블로 돌아가기
-                    startTimer(500);
-                }
-            }
-        } else {
-            // 애니메이션이 아닌 경우: 노브 표시 상태를 레이블로 되돌리기
-            resetKnobDisplayStates();
-            repaint();
-            
-            // Rec 버튼이 활성화되어 있으면 타이머 계속 실행, 아니면 정지
-            if (controlPanel && controlPanel->isRecButtonActive()) {
-                startTimer(100); // 10fps로 깜빡임 업데이트 (20fps에서 10fps로 변경)
-            } else {
-                stopTimer();
-                
-                // 기존의 파라미터 동기화 로직 (재시도 횟수 제한 추가)
-                if (retryCount < MAX_RETRY_COUNT) {
-                    if (!clearPlugin) {
-                        retryCount++;
-                        startTimer(100);
-                        return;
-                    }
-                    auto params = clearPlugin->getParameters();
-                    if (params.size() > 1 && params[1] && params[1]->getName(100).isNotEmpty()) {
-                        updateKnobsFromPlugin();
-                        retryCount = 0; // 성공 시 재시도 카운터 리셋
-                    } else {
-                        retryCount++;
-                        startTimer(100);
-                    }
-                } else {
-                    // 최대 재시도 횟수 초과 시 로그 출력 후 정지
-                    juce::Logger::writeToLog("Parameter sync failed after " + juce::String(MAX_RETRY_COUNT) + " attempts, stopping timer");
-                    retryCount = 0; // 리셋
-                }
-            }
+        if (++paramSyncRetryCount >= MAX_PARAM_SYNC_RETRIES) {
+            // 최대 재시도 횟수 초과 시 로그 출력 후 정지
+            CLR_LOG_ERROR("Parameter sync failed after " + juce::String(MAX_PARAM_SYNC_RETRIES) + " attempts, stopping");
+            paramSyncRetryCount = 0;
+            return false;
         }
+        return true;
     }
     
     void updateKnobsFromPlugin() {
         if (!clearPlugin) return;
-        auto params = clearPlugin->getParameters();
         
         // knobValues 벡터 크기 체크
-        if (knobValues.size() < 3) {
+        if (knobValues.size() < ParameterMap::NUM_KNOBS) {
             return;
         }
         
-        if (params.size() > 1 && params[1] != nullptr) {
-            try {
-                knobValues[0] = params[1]->getValue() * 2.0f; // 0~1을 0~2로 변환
-            } catch (const std::exception& e) {
-                // 예외 발생 시 기본값 유지
-            } catch (...) {
-                // 예외 발생 시 기본값 유지
-            }
-        }
-        if (params.size() > 14 && params[14] != nullptr) {
-            try {
-                knobValues[1] = params[14]->getValue() * 2.0f; // 0~1을 0~2로 변환
-            } catch (const std::exception& e) {
-                // 예외 발생 시 기본값 유지
-            } catch (...) {
-                // 예외 발생 시 기본값 유지
-            }
-        }
-        if (params.size() > 12 && params[12] != nullptr) {
-            try {
-                knobValues[2] = params[12]->getValue() * 2.0f; // 0~1을 0~2로 변환
-            } catch (const std::exception& e) {
-                // 예외 발생 시 기본값 유지
-            } catch (...) {
-                // 예외 발생 시 기본값 유지
+        for (int i = 0; i < ParameterMap::NUM_KNOBS; ++i) {
+            auto role = ParameterMap::roleForKnob(i);
+            if (parameterMap.has(role)) {
+                knobValues[i] = parameterMap.getValue(role) * 2.0f; // 0~1을 0~2로 변환
             }
         }
         
@@ -2092,242 +1767,144 @@ public:
         // 릴리즈 모드에서만 최종 값 로그 (선택적)
         static int logCounter = 0;
         if (++logCounter % 100 == 0) { // 100번에 한 번씩만 로그
-            juce::Logger::writeToLog("Knob values updated - Final: " + 
-                                   juce::String(knobValues[0]) + ", " + 
-                                   juce::String(knobValues[1]) + ", " + 
-                                   juce::String(knobValues[2]));
+            CLR_LOG_DEBUG("Knob values updated - Final: " + 
+                        juce::String(knobValues[0]) + ", " + 
+                        juce::String(knobValues[1]) + ", " + 
+                        juce::String(knobValues[2]));
         }
         #endif
         
-        repaint();
+        repaintKnobs();
     }
     
+    // 시스템 출력 장치 조회/변경은 모두 라우팅 서비스의 워커 스레드에서 비동기로 처리
     void restoreSystemOutputDevice() {
-        if (originalSystemOutputDevice.isEmpty()) {
-            juce::Logger::writeToLog("No saved system output device to restore");
-            return;
-        }
-        
-        juce::Logger::writeToLog("Restoring system output device to: " + originalSystemOutputDevice);
-        
-        // 시스템 출력을 저장된 장치로 복구하는 명령어들 시도 (AppleScript 제거)
-        juce::StringArray commands = {
-            "/opt/homebrew/bin/SwitchAudioSource -s \"" + originalSystemOutputDevice + "\"",
-            "/usr/local/bin/SwitchAudioSource -s \"" + originalSystemOutputDevice + "\"",
-            "/opt/homebrew/Cellar/switchaudio-osx/1.2.2/bin/SwitchAudioSource -s \"" + originalSystemOutputDevice + "\"",
-            "SwitchAudioSource -s \"" + originalSystemOutputDevice + "\""
-        };
+        systemAudioRouter.restoreSavedOutputDevice();
+    }
+    
+    struct AutoSetupResult {
+        bool installedTools = false;
+    };
+    
+    // 자동 설정을 백그라운드 스레드에서 실행하고 결과만 메시지 스레드로 전달
+    void runAutoSetupInBackground() {
+        juce::Component::SafePointer<ClearHostApp> safeThis(this);
+        const double startMs = juce::Time::getMillisecondCounterHiRes();
+        const bool firstRunCompleted = hostSettings.isFirstRunCompleted();
         
-        bool success = false;
-        for (auto& command : commands) {
-            int result = system(command.toRawUTF8());
-            if (result == 0) {
-                juce::Logger::writeToLog("Successfully restored system output using: " + command);
-                success = true;
-                break;
+        juce::Thread::launch([safeThis, startMs, firstRunCompleted] {
+            // 멤버에 접근하지 않는 static 함수만 호출 (창이 먼저 닫혀도 안전)
+            auto result = performAutoSetup(firstRunCompleted);
+            const double durationMs = juce::Time::getMillisecondCounterHiRes() - startMs;
+            
+            juce::MessageManager::callAsync([safeThis, result, durationMs] {
+                if (safeThis == nullptr) return;
+                safeThis->autoSetupFinished(result, durationMs);
+            });
+        });
+    }
+    
+    void autoSetupFinished(const AutoSetupResult& result, double durationMs) {
+        // 첫 실행에서 BlackHole 등이 설치되었으면 완료 표시 후 장치 목록 다시 읽기
+        if (result.installedTools) {
+            hostSettings.setFirstRunCompleted(true);
+            if (auto* deviceType = deviceManager.getCurrentDeviceTypeObject()) {
+                deviceType->scanForDevices();
             }
+            updateAudioDeviceLists();
+            updateInputDeviceList();
+            updateOutputDeviceList();
         }
         
-        if (!success) {
-            juce::Logger::writeToLog("Failed to restore system output with all methods");
-        }
+        startupProfiler.addPhase("autoSetup(bg)", durationMs);
+        startupProfiler.taskFinished();
     }
     
-    void performAutoSetup() {
-        juce::Logger::writeToLog("=== Starting Auto Setup ===");
+    static AutoSetupResult performAutoSetup(bool firstRunCompleted) {
+        CLR_LOG_INFO("=== Starting Auto Setup ===");
+        AutoSetupResult result;
         
         // 1. JUCE 초기화 확인
-        juce::Logger::writeToLog("JUCE initialized successfully");
+        CLR_LOG_INFO("JUCE initialized successfully");
         
         // 2. 오디오 디바이스 매니저 초기화 확인
-        juce::Logger::writeToLog("Audio Device Manager will be initialized");
+        CLR_LOG_INFO("Audio Device Manager will be initialized");
         
         // 3. macOS 확인
         #if JUCE_MAC
-        juce::Logger::writeToLog("macOS detected - Core Audio will be used");
+        CLR_LOG_INFO("macOS detected - Core Audio will be used");
         #endif
         
         // 4. 플러그인 포맷 확인
-        juce::Logger::writeToLog("Plugin formats will be initialized");
+        CLR_LOG_INFO("Plugin formats will be initialized");
         
         // 5. 첫 실행 시 필요한 도구들 설치
-        checkAndInstallRequiredTools();
+        result.installedTools = checkAndInstallRequiredTools(firstRunCompleted);
         
-        // 6. 현재 시스템 사운드 출력 소스 저장
-        saveCurrentSystemOutputDevice();
-        
-        juce::Logger::writeToLog("=== Auto Setup Complete ===");
+        CLR_LOG_INFO("=== Auto Setup Complete ===");
+        return result;
     }
     
     void setSystemOutputToBlackHole() {
-        juce::Logger::writeToLog("Setting system output to BlackHole...");
-        
-        // 시스템 출력을 BlackHole로 변경하는 명령어들 시도 (AppleScript 제거)
-        juce::StringArray commands = {
-            "/opt/homebrew/bin/SwitchAudioSource -s \"BlackHole 2ch\"",
-            "/usr/local/bin/SwitchAudioSource -s \"BlackHole 2ch\"",
-            "/opt/homebrew/Cellar/switchaudio-osx/1.2.2/bin/SwitchAudioSource -s \"BlackHole 2ch\"",
-            "SwitchAudioSource -s \"BlackHole 2ch\""
-        };
-        
-        bool success = false;
-        for (auto& command : commands) {
-            int result = system(command.toRawUTF8());
-            if (result == 0) {
-                juce::Logger::writeToLog("Successfully set system output to BlackHole using: " + command);
-                success = true;
-                break;
-            }
-        }
-        
-        if (!success) {
-            juce::Logger::writeToLog("Failed to set system output to BlackHole with all methods");
-        }
+        CLR_LOG_INFO("Setting system output to BlackHole...");
+        systemAudioRouter.setDefaultOutputDevice("BlackHole 2ch");
     }
     
     void saveCurrentSystemOutputDevice() {
-        juce::Logger::writeToLog("Saving current system output device...");
-        
-        // SwitchAudioSource를 사용하여 현재 시스템 출력 장치를 가져오기
-        juce::StringArray commands = {
-            "/opt/homebrew/bin/SwitchAudioSource -c",
-            "/usr/local/bin/SwitchAudioSource -c",
-            "/opt/homebrew/Cellar/switchaudio-osx/1.2.2/bin/SwitchAudioSource -c",
-            "SwitchAudioSource -c"
-        };
-        
-        for (auto& command : commands) {
-            FILE* pipe = popen(command.toRawUTF8(), "r");
-            if (pipe) {
-                char buffer[256];
-                juce::String result = "";
-                while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
-                    result += buffer;
-                }
-                pclose(pipe);
-                
-                result = result.trim();
-                if (result.isNotEmpty()) {
-                    originalSystemOutputDevice = result;
-                    juce::Logger::writeToLog("Saved current system output device: " + originalSystemOutputDevice);
-                        return;
-                }
-            }
-        }
-        
-        // 실패 시 기본값 사용
-        originalSystemOutputDevice = "MacBook Pro 스피커";
-        juce::Logger::writeToLog("Failed to get current device, using default: " + originalSystemOutputDevice);
+        systemAudioRouter.saveDefaultOutputDevice(DEFAULT_SYSTEM_OUTPUT_DEVICE);
     }
     
-    void checkAndInstallRequiredTools() {
-        // 첫 실행 파일 경로 설정
-        firstRunFile = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
-                      .getChildFile("ClearHost")
-                      .getChildFile("first_run_completed.txt");
-        
+    // 첫 실행이면 필요한 도구를 설치하고 true 반환 (완료 표시는 메시지 스레드에서 설정 저장소에)
+    static bool checkAndInstallRequiredTools(bool firstRunCompleted) {
         // 첫 실행이 완료되었는지 확인
-        if (firstRunFile.existsAsFile()) {
-            juce::Logger::writeToLog("First run already completed, skipping tool installation");
-                            return;
-                        }
+        if (firstRunCompleted) {
+            CLR_LOG_INFO("First run already completed, skipping tool installation");
+            return false;
+        }
         
-        juce::Logger::writeToLog("=== First Run - Installing Required Tools ===");
+        CLR_LOG_INFO("=== First Run - Installing Required Tools ===");
         
         // 1. BlackHole 설치 확인 및 설치
         checkAndInstallBlackHole();
         
-        // 2. switchaudio-osx 설치 확인 및 설치
-        checkAndInstallSwitchAudioOSX();
-        
-        // 3. 시스템 설정 접근 권한 확인 및 안내
+        // 2. 시스템 설정 접근 권한 확인 및 안내
+        // (시스템 출력 전환은 CoreAudio를 직접 사용하므로 switchaudio-osx는 더 이상 설치하지 않음)
         checkSystemPreferencesAccess();
         
-        // 4. 첫 실행 완료 표시
-        firstRunFile.getParentDirectory().createDirectory();
-        firstRunFile.create();
-        juce::Logger::writeToLog("First run setup completed");
+        CLR_LOG_INFO("First run setup completed");
+        return true;
     }
     
-    void checkAndInstallBlackHole() {
-        juce::Logger::writeToLog("Checking BlackHole installation...");
+    static void checkAndInstallBlackHole() {
+        CLR_LOG_INFO("Checking BlackHole installation...");
         
         // BlackHole이 설치되어 있는지 확인
         juce::File blackHoleComponent("/Library/Audio/Plug-Ins/Components/BlackHole2ch.component");
         juce::File blackHoleVST("/Library/Audio/Plug-Ins/VST/BlackHole.vst");
         
         if (blackHoleComponent.exists() || blackHoleVST.exists()) {
-            juce::Logger::writeToLog("BlackHole is already installed");
+            CLR_LOG_INFO("BlackHole is already installed");
             return;
         }
         
-        juce::Logger::writeToLog("BlackHole not found - installing...");
+        CLR_LOG_WARNING("BlackHole not found - installing...");
         
         // Homebrew를 통해 BlackHole 설치
         juce::String command = "brew install blackhole-2ch";
         int result = system(command.toRawUTF8());
         
         if (result == 0) {
-            juce::Logger::writeToLog("BlackHole installed successfully");
+            CLR_LOG_INFO("BlackHole installed successfully");
         } else {
-            juce::Logger::writeToLog("Failed to install BlackHole via Homebrew");
+            CLR_LOG_ERROR("Failed to install BlackHole via Homebrew");
             
             // 대안: 수동 설치 안내
-            juce::Logger::writeToLog("Please install BlackHole manually from: https://existential.audio/blackhole/");
+            CLR_LOG_WARNING("Please install BlackHole manually from: https://existential.audio/blackhole/");
         }
     }
     
-    void checkAndInstallSwitchAudioOSX() {
-        juce::Logger::writeToLog("Checking SwitchAudioSource installation...");
-        
-        // SwitchAudioSource가 설치되어 있는지 확인 (전체 경로 포함)
-        juce::StringArray possiblePaths = {
-            "/opt/homebrew/bin/SwitchAudioSource",
-            "/usr/local/bin/SwitchAudioSource",
-            "/opt/homebrew/Cellar/switchaudio-osx/1.2.2/bin/SwitchAudioSource",
-            "SwitchAudioSource"
-        };
-        
-        bool found = false;
-        for (auto& path : possiblePaths) {
-            juce::String command = "which " + path;
-            FILE* pipe = popen(command.toRawUTF8(), "r");
-            if (pipe) {
-                char buffer[256];
-                juce::String result = "";
-                while (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
-                    result += buffer;
-                }
-                pclose(pipe);
-                
-                if (result.trim().isNotEmpty()) {
-                    juce::Logger::writeToLog("SwitchAudioSource found at: " + result.trim());
-                    found = true;
-                    break;
-                }
-            }
-        }
-        
-        if (found) {
-            juce::Logger::writeToLog("SwitchAudioSource is already installed");
-                        return;
-                    }
-                    
-        juce::Logger::writeToLog("SwitchAudioSource not found - installing...");
-        
-        // Homebrew를 통해 switchaudio-osx 설치
-        juce::String command = "brew install switchaudio-osx";
-        int result = system(command.toRawUTF8());
-        
-        if (result == 0) {
-            juce::Logger::writeToLog("SwitchAudioSource installed successfully");
-        } else {
-            juce::Logger::writeToLog("Failed to install SwitchAudioSource via Homebrew");
-        }
-    }
-    
-    void checkSystemPreferencesAccess() {
-        juce::Logger::writeToLog("Checking System Preferences access...");
+    static void checkSystemPreferencesAccess() {
+        CLR_LOG_INFO("Checking System Preferences access...");
         
         // 시스템 설정 접근 권한 확인
         juce::String command = "osascript -e 'tell application \"System Events\" to get name of current location of (get volume settings)'";
@@ -2341,58 +1918,44 @@ public:
             pclose(pipe);
             
             if (result.trim().isNotEmpty()) {
-                juce::Logger::writeToLog("System Preferences access is working");
+                CLR_LOG_INFO("System Preferences access is working");
             } else {
-                juce::Logger::writeToLog("System Preferences access may be restricted");
-                juce::Logger::writeToLog("Please grant accessibility permissions in System Preferences > Security & Privacy > Privacy > Accessibility");
+                CLR_LOG_WARNING("System Preferences access may be restricted");
+                CLR_LOG_WARNING("Please grant accessibility permissions in System Preferences > Security & Privacy > Privacy > Accessibility");
             }
         }
     }
     
-    void mapMidiCCToClearParameter(const juce::MidiMessage& message) {
-        int cc = message.getControllerNumber();
-        int ccValue = message.getControllerValue();
+    // 메시지 스레드 전용: MIDI CC에 맞춰 UI 상태만 갱신
+    // (플러그인 파라미터는 오디오 스레드의 HostAudioCallback에서 샘플 단위로 적용됨)
+    void mapMidiCCToClearParameter(int cc, int ccValue) {
+        if (isBeingDeleted || !clearPlugin) return;
+        
         float value = ccValue / 127.0f;
-        int paramIdx = -1;
+        int knobIndex = -1;
         
         // USB MIDI CC 모니터링 및 변수 업데이트
         switch (cc) {
             case 21: // vox
                 Knob1 = ccValue;
-                paramIdx = 1; // vox 파라미터 인덱스
-                juce::Logger::writeToLog("MIDI CC 21 (Knob1 - vox): " + juce::String(Knob1));
-                
-                // preset이 활성화된 상태에서 노브를 변경하면 preset 상태 리셋
-                if (presetActive) {
-                    resetPresetToDefault();
-                }
+                knobIndex = 0;
                 break;
             case 22: // amb
                 Knob2 = ccValue;
-                paramIdx = 14; // amb 파라미터 인덱스
-                juce::Logger::writeToLog("MIDI CC 22 (Knob2 - amb): " + juce::String(Knob2));
-                
-                // preset이 활성화된 상태에서 노브를 변경하면 preset 상태 리셋
-                if (presetActive) {
-                    resetPresetToDefault();
-                }
+                knobIndex = 1;
                 break;
             case 23: // v. rev
                 Knob3 = ccValue;
-                paramIdx = 12; // v. rev 파라미터 인덱스
-                juce::Logger::writeToLog("MIDI CC 23 (Knob3 - v. rev): " + juce::String(Knob3));
-                
-                // preset이 활성화된 상태에서 노브를 변경하면 preset 상태 리셋
-                if (presetActive) {
-                    resetPresetToDefault();
-                }
+                knobIndex = 2;
                 break;
-            case 24: // Bypass
+            case 24: { // Bypass
                 Bypass = (ccValue >= 64); // 64 이상이면 true, 미만이면 false
-                juce::Logger::writeToLog("MIDI CC 24 (Bypass): " + juce::String(Bypass ? "ON" : "OFF"));
                 
                 // Bypass 상태 업데이트 (True일 때 bypass off, False일 때 bypass on)
                 bool bypassState = !Bypass;
+                if (bypassState != bypassActive) {
+                    CLR_LOG_EVENT(LogLevel::info, LogCode::midiBypass, Bypass ? 1.0 : 0.0);
+                }
                 setBypassActive(bypassState);
                 if (controlPanel) {
                     controlPanel->setBypassState(bypassState);
@@ -2400,65 +1963,23 @@ public:
                 if (bottom) {
                     bottom->setBypassState(bypassState);
                 }
-                
-                // JUCE 플러그인 바이패스 기능 구현 (화면 버튼과 동일한 로직)
-                if (clearPlugin) {
-                    // 먼저 플러그인의 바이패스 파라미터를 찾아서 사용
-                    auto params = clearPlugin->getParameters();
-                    bool bypassParamFound = false;
-                    
-                    for (int i = 0; i < params.size(); ++i) {
-                        if (params[i] && params[i]->getName(100).toLowerCase().contains("bypass")) {
-                            // 바이패스 파라미터를 찾았으면 설정
-                            float newValue = bypassState ? 1.0f : 0.0f;
-                            params[i]->setValueNotifyingHost(newValue);
-                            juce::Logger::writeToLog("Plugin bypass parameter " + juce::String(i) + " set to: " + juce::String(newValue));
-                            bypassParamFound = true;
-                            break;
-                        }
-                    }
-                    
-                    // 플러그인에 바이패스 파라미터가 없는 경우, AudioProcessor의 내장 바이패스 기능 사용
-                    if (!bypassParamFound) {
-                        // AudioProcessor의 바이패스 기능 사용
-                        if (clearPlugin->getBypassParameter()) {
-                            clearPlugin->getBypassParameter()->setValueNotifyingHost(bypassState ? 1.0f : 0.0f);
-                            juce::Logger::writeToLog("AudioProcessor bypass set to: " + juce::String(bypassState ? "ON" : "OFF"));
-                        } else {
-                            // 바이패스 파라미터가 없는 경우, 플러그인을 직접 바이패스
-                            // 이는 플러그인이 JUCE의 표준 바이패스 기능을 지원하지 않는 경우
-                            juce::Logger::writeToLog("Plugin does not support bypass functionality");
-                        }
-                    }
-                }
-                
                 repaint();
-                return; // Bypass는 파라미터 업데이트 없이 리턴
+                return;
+            }
+            default:
+                return;
         }
         
-        // 플러그인 파라미터 업데이트 (CC 21, 22, 23만)
-        if (clearPlugin && paramIdx >= 0) {
-            auto params = clearPlugin->getParameters();
-            if (paramIdx < params.size() && params[paramIdx]) {
-                params[paramIdx]->setValueNotifyingHost(value);
-                
-                // UI 노브 값도 업데이트
-                if (paramIdx == 1) { // vox
-                    if (knobValues.size() > 0) {
-                        knobValues[0] = value * 2.0f; // 0~2 범위로 변환
-                    }
-                } else if (paramIdx == 14) { // amb
-                    if (knobValues.size() > 1) {
-                        knobValues[1] = value * 2.0f; // 0~2 범위로 변환
-                    }
-                } else if (paramIdx == 12) { // v. rev
-                    if (knobValues.size() > 2) {
-                        knobValues[2] = value * 2.0f; // 0~2 범위로 변환
-                    }
-                }
-                repaint();
-            }
+        // preset이 활성화된 상태에서 노브를 변경하면 preset 상태 리셋
+        if (presetActive) {
+            resetPresetToDefault();
         }
+        
+        // UI 노브 값 업데이트 (0~2 범위로 변환)
+        if (knobIndex >= 0 && knobIndex < (int)knobValues.size()) {
+            knobValues[knobIndex] = value * 2.0f;
+        }
+        repaint();
     }
 
     void mouseDown(const juce::MouseEvent& event) override {
@@ -2476,18 +1997,7 @@ public:
                     }
                     
                     // 파라미터 반영
-                    if (clearPlugin) {
-                        auto params = clearPlugin->getParameters();
-                        int targetParamIndex = -1;
-                        switch (i) {
-                            case 0: targetParamIndex = 1; break;
-                            case 1: targetParamIndex = 14; break;
-                            case 2: targetParamIndex = 12; break;
-                        }
-                        if (targetParamIndex >= 0 && targetParamIndex < params.size() && params[targetParamIndex]) {
-                            params[targetParamIndex]->setValueNotifyingHost(0.5f); // 0~1 범위에서 중간값
-                        }
-                    }
+                    setKnobParameter(i, 0.5f); // 0~1 범위에서 중간값
                     repaint();
                     return;
                 }
@@ -2496,9 +2006,9 @@ public:
         
         // Panel의 LED 클릭 처리 (테스트용) - 제거됨
         // if (controlPanel && controlPanel->hitTestLED(pos)) {
-        //     juce::Logger::writeToLog("LED clicked - Testing Rec button functionality");
+        //     CLR_LOG_DEBUG("LED clicked - Testing Rec button functionality");
         //     controlPanel->toggleRecButton();
-        //     juce::Logger::writeToLog("Rec button toggled via LED click - State: " + juce::String(controlPanel->isRecButtonActive() ? "ON" : "OFF"));
+        //     CLR_LOG_DEBUG("Rec button toggled via LED click - State: " + juce::String(controlPanel->isRecButtonActive() ? "ON" : "OFF"));
         //     if (controlPanel->isRecButtonActive()) {
         //         if (audioRecorder) {
         //             audioRecorder->startRecording();
@@ -2513,15 +2023,21 @@ public:
         //     return;
         // }
         
+        // Panel의 Rec 버튼 우클릭: 지난 N초 저장 / 녹음 포맷 선택
+        if (controlPanel && controlPanel->hitTestRecButton(pos) && event.mods.isPopupMenu()) {
+            showRecordingMenu();
+            return;
+        }
+
         // Panel의 Rec 버튼 클릭 처리
         if (controlPanel && controlPanel->hitTestRecButton(pos)) {
             controlPanel->toggleRecButton();
-            juce::Logger::writeToLog("Rec button clicked - State: " + juce::String(controlPanel->isRecButtonActive() ? "ON" : "OFF"));
+            CLR_LOG_DEBUG("Rec button clicked - State: " + juce::String(controlPanel->isRecButtonActive() ? "ON" : "OFF"));
             if (controlPanel->isRecButtonActive()) {
                 if (audioRecorder) {
                     audioRecorder->startRecording();
                 }
-                startTimer(100); // 10fps로 변경 (60fps에서 10fps로)
+                animationScheduler.schedule(recBlinkTrack, REC_BLINK_PERIOD_MS);
             } else {
                 if (audioRecorder && audioRecorder->isRecordingActive()) {
                     audioRecorder->stopRecording();
@@ -2533,13 +2049,11 @@ public:
         
         // Panel의 Stereo/Mono 버튼 클릭 처리
         if (controlPanel && controlPanel->hitTestStereoButton(pos)) {
-            if (clearPlugin) {
-                auto params = clearPlugin->getParameters();
-                if (params.size() > 13 && params[13]) {
-                    float currentValue = params[13]->getValue();
-                    float newValue = (currentValue > 0.5f) ? 0.0f : 1.0f;
-                    params[13]->setValueNotifyingHost(newValue);
-                }
+            if (clearPlugin && parameterMap.has(ParameterMap::Role::stereo)) {
+                float currentValue = parameterMap.getValue(ParameterMap::Role::stereo);
+                float newValue = (currentValue > 0.5f) ? 0.0f : 1.0f;
+                parameterMap.setValueNotifyingHost(ParameterMap::Role::stereo, newValue);
+                hostSettings.setStereo(newValue > 0.5f);
             }
             repaint();
             return;
@@ -2588,61 +2102,27 @@ public:
         // Bottom 버튼들 클릭 처리 (in/out 버튼은 호버로 처리하므로 제거)
         if (bottom) {
             if (bottom->hitTestPresetButton(pos)) {
-                juce::Logger::writeToLog("Preset button clicked");
-                // TODO: 프리셋 관련 기능 구현
+                CLR_LOG_DEBUG("Preset button clicked");
+                showPresetMenu();
+                return;
+            }
+            if (bottom->hitTestMeterToggle(pos)) {
+                // 오디오 콜백 부하/지터/xrun 오버레이 토글
+                const bool visible = !bottom->isMeterVisible();
+                bottom->setMeterVisible(visible);
+                if (meterOverlay) meterOverlay->setVisible(visible);
                 repaint();
                 return;
             }
             if (bottom->hitTestBypassButton(pos)) {
-                juce::Logger::writeToLog("Bypass button clicked");
+                CLR_LOG_DEBUG("Bypass button clicked");
                 // bypass 토글 기능
-                static bool bypassState = false;
-                bypassState = !bypassState;
-                bottom->setBypassState(bypassState);
-                setBypassActive(bypassState);
-                
-                // Panel의 bypass 상태도 업데이트
-                if (controlPanel) {
-                    controlPanel->setBypassState(bypassState);
-                }
-                
-                // JUCE 플러그인 바이패스 기능 구현
-                if (clearPlugin) {
-                    // 먼저 플러그인의 바이패스 파라미터를 찾아서 사용
-                    auto params = clearPlugin->getParameters();
-                    bool bypassParamFound = false;
-                    
-                    for (int i = 0; i < params.size(); ++i) {
-                        if (params[i] && params[i]->getName(100).toLowerCase().contains("bypass")) {
-                            // 바이패스 파라미터를 찾았으면 토글
-                            float currentValue = params[i]->getValue();
-                            float newValue = (currentValue > 0.5f) ? 0.0f : 1.0f;
-                            params[i]->setValueNotifyingHost(newValue);
-                            juce::Logger::writeToLog("Plugin bypass parameter " + juce::String(i) + " set to: " + juce::String(newValue));
-                            bypassParamFound = true;
-                            break;
-                        }
-                    }
-                    
-                    // 플러그인에 바이패스 파라미터가 없는 경우, AudioProcessor의 내장 바이패스 기능 사용
-                    if (!bypassParamFound) {
-                        // AudioProcessor의 바이패스 기능 사용
-                        if (clearPlugin->getBypassParameter()) {
-                            clearPlugin->getBypassParameter()->setValueNotifyingHost(bypassState ? 1.0f : 0.0f);
-                            juce::Logger::writeToLog("AudioProcessor bypass set to: " + juce::String(bypassState ? "ON" : "OFF"));
-                        } else {
-                            // 바이패스 파라미터가 없는 경우, 플러그인을 직접 바이패스
-                            // 이는 플러그인이 JUCE의 표준 바이패스 기능을 지원하지 않는 경우
-                            juce::Logger::writeToLog("Plugin does not support bypass functionality");
-                        }
-                    }
-                }
-                
+                applyBypassState(!bypassActive);
                 repaint();
                 return;
             }
             if (bottom->hitTestPresetDropdownButton(pos)) {
-                juce::Logger::writeToLog("Preset dropdown button clicked");
+                CLR_LOG_DEBUG("Preset dropdown button clicked");
                 // TODO: 프리셋 드롭다운 메뉴 구현
                 repaint();
                 return;
@@ -2706,64 +2186,7 @@ public:
                 if (presetRects[i].contains(pos)) {
                     int actualIndex = i + presetScrollOffset;
                     if (actualIndex < presetList.size()) {
-                        juce::String selectedPreset = presetList[actualIndex];
-                        currentPreset = selectedPreset;
-                        setPresetActive(true, selectedPreset);
-                        if (selectedPreset == "s* up**") {
-                            startAnimation({0.5, 0.0, 0.0});
-                            // stereo 설정
-                            if (clearPlugin) {
-                                auto params = clearPlugin->getParameters();
-                                if (params.size() > 13 && params[13]) {
-                                    params[13]->setValueNotifyingHost(1.0f); // stereo
-                                }
-                            }
-                        } else if (selectedPreset == "too loud") {
-                            startAnimation({0.5, 0.2, 0.2});
-                            // stereo 설정
-                            if (clearPlugin) {
-                                auto params = clearPlugin->getParameters();
-                                if (params.size() > 13 && params[13]) {
-                                    params[13]->setValueNotifyingHost(1.0f); // stereo
-                                }
-                            }
-                        } else if (selectedPreset == "sommers") {
-                            startAnimation({0.5, 1.0, 0.0}); // amb 0.5, vox 1.0, v.rev 0
-                            // mono 설정
-                            if (clearPlugin) {
-                                auto params = clearPlugin->getParameters();
-                                if (params.size() > 13 && params[13]) {
-                                    params[13]->setValueNotifyingHost(0.0f); // mono
-                                }
-                            }
-                        } else if (selectedPreset == "clear voice") {
-                            startAnimation({0.0, 0.5, 0.5});
-                            // stereo 설정
-                            if (clearPlugin) {
-                                auto params = clearPlugin->getParameters();
-                                if (params.size() > 13 && params[13]) {
-                                    params[13]->setValueNotifyingHost(1.0f); // stereo
-                                }
-                            }
-                        } else if (selectedPreset == "dry voice") {
-                            startAnimation({0.0, 0.5, 0.0});
-                            // stereo 설정
-                            if (clearPlugin) {
-                                auto params = clearPlugin->getParameters();
-                                if (params.size() > 13 && params[13]) {
-                                    params[13]->setValueNotifyingHost(1.0f); // stereo
-                                }
-                            }
-                        } else if (selectedPreset == "cono") {
-                            startAnimation({0.5, 0.1, 0.1});
-                            // stereo 설정
-                            if (clearPlugin) {
-                                auto params = clearPlugin->getParameters();
-                                if (params.size() > 13 && params[13]) {
-                                    params[13]->setValueNotifyingHost(1.0f); // stereo
-                                }
-                            }
-                        }
+                        recallPreset(presetList[actualIndex]);
                         presetDropdownOpen = false;
                         repaint();
                         return;
@@ -2785,7 +2208,7 @@ public:
     void mouseDrag(const juce::MouseEvent& event) override {
         // 마우스 위치 업데이트 (그림자 효과를 위해)
         auto pos = event.getPosition();
-        currentMousePos = pos;
+        updateHoverShadows(pos);
         
         if (draggingKnob >= 0) {
             int dy = lastDragY - event.getPosition().y;
@@ -2796,7 +2219,7 @@ public:
             // 애니메이션 중에 노브를 조절하면 해당 노브의 애니메이션을 강제 중지
             if (isAnimating) {
                 animationTargetValues[draggingKnob] = knobValues[draggingKnob];
-                juce::Logger::writeToLog("Knob " + juce::String(draggingKnob) + " animation stopped by user interaction");
+                CLR_LOG_DEBUG("Knob " + juce::String(draggingKnob) + " animation stopped by user interaction");
             }
             
             // preset이 활성화된 상태에서 노브를 수동으로 조절하면 preset 상태 리셋
@@ -2804,29 +2227,16 @@ public:
                 resetPresetToDefault();
             }
             
-            // 파라미터 반영
-            if (clearPlugin) {
-                auto params = clearPlugin->getParameters();
-                int targetParamIndex = -1;
-                switch (draggingKnob) {
-                    case 0: targetParamIndex = 1; break;
-                    case 1: targetParamIndex = 14; break;
-                    case 2: targetParamIndex = 12; break;
-                }
-                if (targetParamIndex >= 0 && targetParamIndex < params.size() && params[targetParamIndex]) {
-                    // 0~2 범위를 0~1로 변환하여 플러그인에 전달
-                    float pluginValue = knobValues[draggingKnob] / 2.0f;
-                    params[targetParamIndex]->setValueNotifyingHost(pluginValue);
-                }
-            }
-            repaint();
+            // 파라미터 반영 (0~2 범위를 0~1로 변환)
+            setKnobParameter(draggingKnob, knobValues[draggingKnob] / 2.0f);
+            repaintKnob(draggingKnob);
         }
     }
 
     void mouseUp(const juce::MouseEvent&) override {
         if (draggingKnob >= 0) {
-            // 드래그가 끝났을 때 0.5초 후에 레이블로 돌아가도록 타이머 설정
-            startTimer(500);
+            // 드래그가 끝났을 때 0.5초 후에 레이블로 돌아가도록
+            animationScheduler.schedule(labelFadeTrack, LABEL_FADE_DELAY_MS);
         }
         draggingKnob = -1;
     }
@@ -2840,19 +2250,13 @@ public:
         auto localPos = getLocalPoint(nullptr, globalPos);
         
         // 창 내부에 있을 때는 정확한 위치, 창 밖에 있을 때는 상대적 위치 사용
-        if (getLocalBounds().contains(pos)) {
-            currentMousePos = pos;
-        } else {
-            currentMousePos = juce::Point<int>(localPos.x, localPos.y);
-        }
-        
-        // 그림자 효과를 위해 repaint 호출
-        repaint();
+        // 그림자가 실제로 움직인 노브 영역만 다시 그림
+        updateHoverShadows(getLocalBounds().contains(pos) ? pos : juce::Point<int>(localPos.x, localPos.y));
         
         // in 버튼에 호버
         if (bottom && bottom->hitTestInButton(pos)) {
             if (!inputDropdownOpen) {
-                juce::Logger::writeToLog("Mouse hover on in button - opening input dropdown");
+                CLR_LOG_DEBUG("Mouse hover on in button - opening input dropdown");
                 inputDropdownOpen = true;
                 outputDropdownOpen = false; // 다른 드롭다운 닫기
                 inputScrollOffset = 0; // 드롭다운이 열릴 때 스크롤 오프셋 리셋
@@ -2867,7 +2271,7 @@ public:
         // out 버튼에 호버
         if (bottom && bottom->hitTestOutButton(pos)) {
             if (!outputDropdownOpen) {
-                juce::Logger::writeToLog("Mouse hover on out button - opening output dropdown");
+                CLR_LOG_DEBUG("Mouse hover on out button - opening output dropdown");
                 outputDropdownOpen = true;
                 inputDropdownOpen = false; // 다른 드롭다운 닫기
                 presetDropdownOpen = false; // 다른 드롭다운 닫기
@@ -2883,7 +2287,7 @@ public:
         // preset 버튼에 호버
         if (bottom && bottom->hitTestPresetButton(pos)) {
             if (!presetDropdownOpen) {
-                juce::Logger::writeToLog("Mouse hover on preset button - opening preset dropdown");
+                CLR_LOG_DEBUG("Mouse hover on preset button - opening preset dropdown");
                 presetDropdownOpen = true;
                 inputDropdownOpen = false; // 다른 드롭다운 닫기
                 outputDropdownOpen = false; // 다른 드롭다운 닫기
@@ -2900,7 +2304,7 @@ public:
         if (inputDropdownOpen) {
             // in 버튼이나 드롭다운 영역에 있지 않으면 드롭다운 닫기
             if (!bottom->hitTestInButton(pos) && !inputDropdownRect.contains(pos)) {
-                juce::Logger::writeToLog("Mouse left input area - closing input dropdown");
+                CLR_LOG_DEBUG("Mouse left input area - closing input dropdown");
                 inputDropdownOpen = false;
                 repaint();
             }
@@ -2909,7 +2313,7 @@ public:
         if (outputDropdownOpen) {
             // out 버튼이나 드롭다운 영역에 있지 않으면 드롭다운 닫기
             if (!bottom->hitTestOutButton(pos) && !outputDropdownRect.contains(pos)) {
-                juce::Logger::writeToLog("Mouse left output area - closing output dropdown");
+                CLR_LOG_DEBUG("Mouse left output area - closing output dropdown");
                 outputDropdownOpen = false;
                 repaint();
             }
@@ -2918,7 +2322,7 @@ public:
         if (presetDropdownOpen) {
             // preset 버튼이나 드롭다운 영역에 있지 않으면 드롭다운 닫기
             if (!bottom->hitTestPresetButton(pos) && !presetDropdownRect.contains(pos)) {
-                juce::Logger::writeToLog("Mouse left preset area - closing preset dropdown");
+                CLR_LOG_DEBUG("Mouse left preset area - closing preset dropdown");
                 presetDropdownOpen = false;
                 repaint();
             }
@@ -2947,27 +2351,15 @@ public:
                 }
                 
                 // 플러그인 파라미터 업데이트
-                if (clearPlugin && pluginLoaded) {
-                    // 노브 인덱스에 따른 파라미터 매핑
-                    int parameterIndex = -1;
-                    switch (knobIndex) {
-                        case 0: parameterIndex = 1; break;  // Ambience Gain
-                        case 1: parameterIndex = 14; break; // Voice Gain
-                        case 2: parameterIndex = 12; break; // Voice Reverb Gain
-                    }
-                    
-                    if (parameterIndex >= 0) {
-                        // 노브 값(0~2)을 플러그인 파라미터 값(0~1)으로 정규화
-                        float normalizedValue = juce::jlimit(0.0f, 1.0f, newValue / 2.0f);
-                        clearPlugin->setParameter(parameterIndex, normalizedValue);
-                        juce::Logger::writeToLog("Knob " + juce::String(knobIndex) + " -> Parameter " + juce::String(parameterIndex) + " = " + juce::String(normalizedValue) + " (from " + juce::String(newValue) + ")");
-                    }
+                if (pluginLoaded) {
+                    // 노브 값(0~2)을 플러그인 파라미터 값(0~1)으로 정규화
+                    setKnobParameter(knobIndex, newValue / 2.0f);
                 }
                 
                 // 노브 값 표시 상태 업데이트
                 updateKnobDisplayState(knobIndex, newValue);
                 
-                repaint();
+                repaintKnob(knobIndex);
                 return; // 노브 스크롤이 처리되었으면 다른 스크롤은 무시
             }
         }
@@ -3036,50 +2428,50 @@ public:
                 }
                 
             } catch (...) {
-                juce::Logger::writeToLog("Error getting output device names");
+                CLR_LOG_ERROR("Error getting output device names");
             }
         }
         
-        // 시스템 출력 장치명 감지 (macOS)
-#if JUCE_MAC
-        juce::String sysOutputName;
-        {
-            FILE* pipe = popen("SwitchAudioSource -c", "r");
-            if (pipe) {
-                char buffer[256] = {0};
-                if (fgets(buffer, sizeof(buffer), pipe)) {
-                    sysOutputName = juce::String::fromUTF8(buffer).trim();
-                    juce::Logger::writeToLog("System output device detected: " + sysOutputName);
-                }
-                pclose(pipe);
-            }
+        precomputeListText(outputDeviceList);
+        
+        // 우선 첫 번째 항목을 선택해 두고, 시스템 출력 장치명은 라우팅 서비스에서 비동기로 받아 반영
+        if (!outputDeviceList.empty()) {
+            currentOutputDevice = outputDeviceList[0];
+        }
+        refreshOutputDeviceBox();
+        
+        juce::Component::SafePointer<ClearHostApp> safeThis(this);
+        systemAudioRouter.getDefaultOutputDevice([safeThis](juce::String sysOutputName) {
+            if (safeThis != nullptr) safeThis->selectSystemOutputDevice(sysOutputName);
+        });
+    }
+    
+    void selectSystemOutputDevice(const juce::String& sysOutputName) {
+        CLR_LOG_INFO("System output device detected: " + sysOutputName);
+        
+        // 지난 실행에서 고른 출력 장치가 아직 있으면 시스템 출력 대신 그 장치로
+        const auto savedOutput = hostSettings.getOutputDevice();
+        if (savedOutput.isNotEmpty() && savedOutput != sysOutputName
+            && std::find(outputDeviceList.begin(), outputDeviceList.end(), savedOutput) != outputDeviceList.end()) {
+            CLR_LOG_INFO("Restoring saved output device: " + savedOutput);
+            changeAudioOutputDevice(savedOutput);
+            refreshOutputDeviceBox();
+            return;
         }
         
         // 리스트에서 일치하는 항목이 있으면 선택
-        bool found = false;
-        juce::Logger::writeToLog("Available output devices:");
         for (const auto& name : outputDeviceList) {
-            juce::Logger::writeToLog("  - " + name);
-            if (name == sysOutputName) {
+            if (sysOutputName.isNotEmpty() && name == sysOutputName) {
                 currentOutputDevice = name;
-                found = true;
-                juce::Logger::writeToLog("MATCH FOUND! Setting currentOutputDevice to: " + name);
-                break;
-            }
-        }
-        
-        if (!found) {
-            if (!outputDeviceList.empty()) {
-                currentOutputDevice = outputDeviceList[0];
-                juce::Logger::writeToLog("No match found, using first device: " + currentOutputDevice);
+                CLR_LOG_INFO("MATCH FOUND! Setting currentOutputDevice to: " + name);
+                refreshOutputDeviceBox();
+                return;
             }
         }
-#else
-        // macOS가 아니면 기존대로 첫 번째 항목 선택
-        if (!outputDeviceList.empty()) {
-            currentOutputDevice = outputDeviceList[0];
-        }
-#endif
+        CLR_LOG_WARNING("No match found, keeping: " + currentOutputDevice);
+    }
+    
+    void refreshOutputDeviceBox() {
         // ComboBox에도 반영
         if (outputDeviceBox) {
             outputDeviceBox->clear();
@@ -3116,7 +2508,7 @@ public:
                     }
                 }
             } catch (...) {
-                juce::Logger::writeToLog("Error getting input device names");
+                CLR_LOG_ERROR("Error getting input device names");
             }
         }
         
@@ -3125,18 +2517,29 @@ public:
             inputDeviceList.push_back("System Sound / BlackHole - Not Installed");
         }
         
+        precomputeListText(inputDeviceList);
+        
         // 앱 실행 시 강제로 unassigned로 설정
         currentInputDevice = "unassigned";
     }
     
+    // 지난 실행의 입력 장치 복원 - 마이크 입력 방지를 위해 시스템 사운드(BlackHole)일 때만 다시 연결
+    void restoreSavedInputDevice() {
+        const auto savedInput = hostSettings.getInputDevice();
+        if (savedInput != "System Sound / BlackHole") return;
+        if (std::find(inputDeviceList.begin(), inputDeviceList.end(), savedInput) == inputDeviceList.end()) return;
+        
+        CLR_LOG_INFO("Restoring saved input device: " + savedInput);
+        changeAudioInputDevice(savedInput);
+    }
+    
     void updatePresetList() {
         presetList.clear();
-        presetList.push_back("s* up**");
-        presetList.push_back("too loud");
-        presetList.push_back("sommers");
-        presetList.push_back("clear voice");
-        presetList.push_back("dry voice");
-        presetList.push_back("cono");
+        for (const auto& preset : presetStore.getPresets()) {
+            presetList.push_back(preset.name);
+        }
+        
+        precomputeListText(presetList);
         
         // 기본 프리셋을 첫 번째로 설정
         if (!presetList.empty()) {
@@ -3144,11 +2547,26 @@ public:
         }
     }
     
+    // 드롭다운 항목(소문자로 표시)의 글리프 배치를 목록이 바뀔 때 미리 계산
+    static void precomputeListText(const std::vector<juce::String>& items) {
+        juce::StringArray labels;
+        for (const auto& item : items) labels.add(item.toLowerCase());
+        uiText().precompute(labels, DEFAULT_FONT_SIZE);
+    }
+    
 
 
 private:
     juce::AudioPluginFormatManager pluginManager;
     std::unique_ptr<juce::AudioPluginInstance> clearPlugin;
+    
+    // Clear bypass (플러그인 파라미터가 아닌 호스트 크로스페이드)
+    BypassCrossfader clearBypass;
+    
+    // Clear 앞뒤 이펙트 체인 (구성 교체는 commitChainLayout에서만)
+    PluginChain pluginChain;
+    int chainLoadGeneration = 0;    // 프리셋 체인을 만드는 도중 다른 프리셋을 부르면 이전 결과는 버림
+    std::unique_ptr<juce::FileChooser> effectChooser;
     std::unique_ptr<juce::MidiInput> midiInput;
     std::unique_ptr<juce::AudioProcessorEditor> pluginEditor;
 
@@ -3166,17 +2584,34 @@ private:
     
     // 애니메이션 관련 변수들
     double animationDuration; // 애니메이션 지속 시간 (초)
-    int animationTimerInterval; // 타이머 간격 (ms)
     bool isAnimating = false;
     double animationStartTime = 0.0;
     std::array<double, 3> animationStartValues = {0.0, 0.0, 0.0}; // 시작 값들
     std::array<double, 3> animationTargetValues = {0.0, 0.0, 0.0}; // 목표 값들
     
-    // 시스템 사운드 출력 소스 저장
-    juce::String originalSystemOutputDevice;
-    
-    // 첫 실행 여부 확인용 파일 경로
-    juce::File firstRunFile;
+    // VBlank 기반 애니메이션 트랙 (노브 트윈: 매 프레임, 깜빡임: 10fps, 레이블 복귀: 0.5초 후 한 번, 파라미터 동기화: 100ms 재시도)
+    AnimationScheduler animationScheduler { *this };
+    int knobTweenTrack = -1;
+    int recBlinkTrack = -1;
+    int labelFadeTrack = -1;
+    int paramSyncTrack = -1;
+    int paramSyncRetryCount = 0;
+    static constexpr double REC_BLINK_PERIOD_MS = 100.0;
+    static constexpr double LABEL_FADE_DELAY_MS = 500.0;
+    static constexpr double PARAM_SYNC_PERIOD_MS = 100.0;
+    static constexpr int MAX_PARAM_SYNC_RETRIES = 10;
+    
+    // 오디오 콜백 계측 (부하/지터/오버런/xrun) 및 표시용 오버레이
+    AudioCallbackMeter audioMeter;
+    std::unique_ptr<AudioMeterOverlay> meterOverlay;
+    
+    // 장치 전환 페이드 / 전환 코얼레싱 (전환기가 페이더를 참조하므로 페이더를 먼저 선언)
+    TransitionFader transitionFader;
+    DeviceTransitionScheduler deviceTransitions { deviceManager, transitionFader };
+    
+    // 시스템 사운드 출력 조회/변경 (CoreAudio, 워커 스레드) - 원래 출력 장치도 서비스가 기억
+    SystemAudioRoutingService systemAudioRouter;
+    static constexpr const char* DEFAULT_SYSTEM_OUTPUT_DEVICE = "MacBook Pro 스피커";
     
     std::vector<juce::Rectangle<int>> knobRects;
     std::vector<float> knobValues;
@@ -3217,6 +2652,8 @@ private:
     juce::String currentOutputDevice;
     juce::String currentPreset;
     
+    PresetStore presetStore;
+    
     // Preset 상태 관리
     bool presetActive = false; // preset이 활성화되었는지 여부
     juce::String activePresetName = ""; // 현재 활성화된 preset 이름
@@ -3224,11 +2661,32 @@ private:
     // LED 상태 표시
     std::unique_ptr<LED> pluginStatusLED;
     bool pluginLoaded = false;
+    bool pluginLoading = false;
     bool bypassActive = false;
     
+    // 비동기 플러그인 로드 (캐시된 설명 → VST3 → AU 순서로 폴백)
+    juce::Array<ClearPluginLocator::Candidate> pluginLoadCandidates;
+    ClearPluginLocator::Candidate currentPluginCandidate;
+    PluginDescriptionCache pluginDescriptionCache;
+    double pluginLoadStartMs = 0.0;
+    
+    // prepareToPlay에서 받은 현재 오디오 설정 (나중에 로드된 플러그인 준비용, 0이면 미준비)
+    // prepareToPlay/releaseResources는 장치 재시작 경로에서 불리므로 pluginPrepareLock으로 보호
+    juce::CriticalSection pluginPrepareLock;
+    double preparedSampleRate = 0.0;
+    int preparedBlockSize = 0;
+    
+    // 시작 단계별 시간 계측 (첫 페인트 목표 300 ms)
+    StartupProfiler startupProfiler;
+    bool firstPaintDone = false;
+    static constexpr double FIRST_PAINT_BUDGET_MS = 300.0;
+    
     // Panel (노브 3개 + LED + Stereo 토글을 하나로 묶음)
     std::unique_ptr<Panel> controlPanel;
     
+    // 앱 설정 저장소 (ClearHostApplication 소유, 이 컴포넌트보다 오래 삶)
+    HostSettings& hostSettings;
+    
     // Face (1번 캔버스 배경)
     std::unique_ptr<Face> face;
     
@@ -3248,9 +2706,28 @@ private:
     std::unique_ptr<juce::Drawable> logoDrawableW;
     bool logoSVGsLoaded = false;
     
+    // 정적 레이어 캐시 (Face + 세퍼레이터 + 로고) - Face 색상이나 화면 배율이 바뀌면 다시 렌더링
+    juce::Image staticLayer;
+    juce::Colour staticLayerColour;
+    float staticLayerScale = 0.0f;
+    
+    // 마지막 페인트에서 그린 노브별 그림자 오프셋 / 이보다 적게 움직이면 호버로 다시 그리지 않음 (px)
+    std::array<juce::Point<float>, 3> paintedShadowOffsets {};
+    static constexpr float SHADOW_REPAINT_THRESHOLD = 0.5f;
+    static constexpr float LOGO_FONT_SIZE = 28.0f; // 30pt - 2pt
+    
     // 오디오 녹음 기능
     std::unique_ptr<AudioRecorder> audioRecorder;
     
+    // 역할별 파라미터 핸들 캐시 (loadClearVST3 직후 구성)
+    ParameterMap parameterMap;
+    
+    // 노브 목표값 → 오디오 스레드 램프 (메시지 스레드에서 파라미터에 직접 쓰지 않음)
+    ParameterSmoother parameterSmoother;
+    
+    // 오디오 콜백 본체 - 위의 체인/bypass/스무더/페이더/계측기를 참조하므로 그 뒤에 선언
+    HostAudioCallback audioCallback { pluginChain, clearBypass, parameterMap, parameterSmoother, transitionFader, audioMeter };
+    
     // 소멸 중 플래그 (콜백 안전성 보장)
     bool isBeingDeleted = false;
     bool isWindowMinimized = false; // 창 최소화 상태 추적
@@ -3261,6 +2738,12 @@ private:
     int Knob3 = 0;  // CC 23: 포텐셜미터 0~127값
     bool Bypass = false;  // CC 24: True/False 값
     
+    // MIDI 스레드 → 메시지 스레드: CC 21~24의 아직 UI에 반영하지 않은 마지막 값
+    static constexpr int NO_PENDING_MIDI_CC = -1;
+    std::array<std::atomic<int>, HostAudioCallback::NUM_MIDI_CC_TARGETS> pendingMidiCCValues {
+        { { NO_PENDING_MIDI_CC }, { NO_PENDING_MIDI_CC }, { NO_PENDING_MIDI_CC }, { NO_PENDING_MIDI_CC } }
+    };
+    
     // MainWindow에서 접근할 수 있도록 friend 클래스 선언
     friend class MainWindow;
     
@@ -3274,7 +2757,7 @@ private:
         // 첫 번째 시도: 현재 작업 디렉토리의 Resources
         if (arrowBFile.existsAsFile()) {
             arrowDrawableB = juce::Drawable::createFromSVGFile(arrowBFile);
-            juce::Logger::writeToLog("Arrow SVG loaded successfully from: " + arrowBFile.getFullPathName());
+            CLR_LOG_INFO("Arrow SVG loaded successfully from: " + arrowBFile.getFullPathName());
         } else {
             // 두 번째 시도: 실행 파일 위치의 Resources
             juce::File execFile = juce::File::getSpecialLocation(juce::File::currentExecutableFile);
@@ -3283,15 +2766,15 @@ private:
             
             if (execArrowBFile.existsAsFile()) {
                 arrowDrawableB = juce::Drawable::createFromSVGFile(execArrowBFile);
-                juce::Logger::writeToLog("Arrow SVG loaded successfully from: " + execArrowBFile.getFullPathName());
+                CLR_LOG_INFO("Arrow SVG loaded successfully from: " + execArrowBFile.getFullPathName());
             } else {
-                juce::Logger::writeToLog("Arrow SVG file not found in both locations: " + arrowBFile.getFullPathName() + " and " + execArrowBFile.getFullPathName());
+                CLR_LOG_WARNING("Arrow SVG file not found in both locations: " + arrowBFile.getFullPathName() + " and " + execArrowBFile.getFullPathName());
             }
         }
         
         if (arrowWFile.existsAsFile()) {
             arrowDrawableW = juce::Drawable::createFromSVGFile(arrowWFile);
-            juce::Logger::writeToLog("Arrow SVG loaded successfully from: " + arrowWFile.getFullPathName());
+            CLR_LOG_INFO("Arrow SVG loaded successfully from: " + arrowWFile.getFullPathName());
         } else {
             // 두 번째 시도: 실행 파일 위치의 Resources
             juce::File execFile = juce::File::getSpecialLocation(juce::File::currentExecutableFile);
@@ -3300,9 +2783,9 @@ private:
             
             if (execArrowWFile.existsAsFile()) {
                 arrowDrawableW = juce::Drawable::createFromSVGFile(execArrowWFile);
-                juce::Logger::writeToLog("Arrow SVG loaded successfully from: " + execArrowWFile.getFullPathName());
+                CLR_LOG_INFO("Arrow SVG loaded successfully from: " + execArrowWFile.getFullPathName());
             } else {
-                juce::Logger::writeToLog("Arrow SVG file not found in both locations: " + arrowWFile.getFullPathName() + " and " + execArrowWFile.getFullPathName());
+                CLR_LOG_WARNING("Arrow SVG file not found in both locations: " + arrowWFile.getFullPathName() + " and " + execArrowWFile.getFullPathName());
             }
         }
     }
@@ -3320,7 +2803,7 @@ private:
         if (logoBFile.existsAsFile()) {
             logoDrawableB = juce::Drawable::createFromSVGFile(logoBFile);
             if (logoDrawableB) {
-                juce::Logger::writeToLog("SVG logo loaded successfully from: " + logoBFile.getFullPathName());
+                CLR_LOG_INFO("SVG logo loaded successfully from: " + logoBFile.getFullPathName());
             }
         } else {
             // 두 번째 시도: 실행 파일 위치의 Resources
@@ -3331,17 +2814,17 @@ private:
             if (execLogoBFile.existsAsFile()) {
                 logoDrawableB = juce::Drawable::createFromSVGFile(execLogoBFile);
                 if (logoDrawableB) {
-                    juce::Logger::writeToLog("SVG logo loaded successfully from: " + execLogoBFile.getFullPathName());
+                    CLR_LOG_INFO("SVG logo loaded successfully from: " + execLogoBFile.getFullPathName());
                 }
             } else {
-                juce::Logger::writeToLog("Logo SVG file not found in both locations: " + logoBFile.getFullPathName() + " and " + execLogoBFile.getFullPathName());
+                CLR_LOG_WARNING("Logo SVG file not found in both locations: " + logoBFile.getFullPathName() + " and " + execLogoBFile.getFullPathName());
             }
         }
         
         if (logoWFile.existsAsFile()) {
             logoDrawableW = juce::Drawable::createFromSVGFile(logoWFile);
             if (logoDrawableW) {
-                juce::Logger::writeToLog("SVG logo loaded successfully from: " + logoWFile.getFullPathName());
+                CLR_LOG_INFO("SVG logo loaded successfully from: " + logoWFile.getFullPathName());
             }
         } else {
             // 두 번째 시도: 실행 파일 위치의 Resources
@@ -3352,139 +2835,165 @@ private:
             if (execLogoWFile.existsAsFile()) {
                 logoDrawableW = juce::Drawable::createFromSVGFile(execLogoWFile);
                 if (logoDrawableW) {
-                    juce::Logger::writeToLog("SVG logo loaded successfully from: " + execLogoWFile.getFullPathName());
+                    CLR_LOG_INFO("SVG logo loaded successfully from: " + execLogoWFile.getFullPathName());
                 }
             } else {
-                juce::Logger::writeToLog("Logo SVG file not found in both locations: " + logoWFile.getFullPathName() + " and " + execLogoWFile.getFullPathName());
+                CLR_LOG_WARNING("Logo SVG file not found in both locations: " + logoWFile.getFullPathName() + " and " + execLogoWFile.getFullPathName());
             }
         }
         
         logoSVGsLoaded = true;
     }
     
+    // 오디오 장치가 이미 열려 있으면 그 설정으로 플러그인 생성
+    void getPluginCreationSettings(double& sampleRate, int& blockSize) {
+        const juce::ScopedLock pl(pluginPrepareLock);
+        sampleRate = preparedSampleRate > 0.0 ? preparedSampleRate : 44100.0;
+        blockSize = preparedSampleRate > 0.0 ? preparedBlockSize : 512;
+    }
+    
+    // 캐시된 설명 → VST3 → AU 순서로 후보를 만들고 createPluginInstanceAsync로 생성
+    // 비동기 API지만 VST3(및 메시지 스레드를 요구하는 AU)는 메시지 스레드에서 동기로 생성되어 그동안 UI가 멈춤
+    // - 첫 페인트 뒤로 미뤄(paint의 callAsync) 빈 창이 늦게 뜨지 않게 할 뿐, 생성 시간 자체를 숨기지는 않음
     void loadClearVST3() {
-        try {
-            // VST3를 우선적으로 시도 (권한 문제 해결 후)
-            juce::Logger::writeToLog("Trying to load Clear as VST3 (with permission fix)...");
+        if (pluginLoading || clearPlugin) return;
+        
+        pluginLoadCandidates = ClearPluginLocator::findCandidates(pluginDescriptionCache);
+        
+        pluginLoadStartMs = juce::Time::getMillisecondCounterHiRes();
+        setPluginLoading(true);
+        loadNextPluginCandidate();
+    }
+    
+    void loadNextPluginCandidate() {
+        while (!pluginLoadCandidates.isEmpty()) {
+            currentPluginCandidate = pluginLoadCandidates.removeAndReturn(0);
+            const auto& desc = currentPluginCandidate.description;
+            auto* format = ClearPluginLocator::findFormat(pluginManager, desc.pluginFormatName);
+            if (format == nullptr) {
+                CLR_LOG_WARNING(desc.pluginFormatName + " format not found");
+                continue;
+            }
             
-            juce::File vst3Dir("/Library/Audio/Plug-Ins/VST3");
-            juce::File clearVST3 = vst3Dir.getChildFile("Clear.vst3");
-            if (clearVST3.exists()) {
-                juce::Logger::writeToLog("Found Clear VST3: " + clearVST3.getFullPathName());
-                juce::AudioPluginFormat* vst3Format = nullptr;
-                for (int i = 0; i < pluginManager.getNumFormats(); ++i) {
-                    auto* format = pluginManager.getFormat(i);
-                    if (format && format->getName().contains("VST3")) {
-                        vst3Format = format;
-                        juce::Logger::writeToLog("Found VST3 format at index " + juce::String(i));
-                        break;
-                    }
-                }
-                if (vst3Format) {
-                    juce::PluginDescription desc;
-                    desc.fileOrIdentifier = clearVST3.getFullPathName();
-                    desc.pluginFormatName = "VST3";
-                    desc.name = "Clear";
-                    desc.descriptiveName = "Clear";
-                    desc.manufacturerName = "Clear";
-                    desc.category = "Effect";
-                    desc.isInstrument = false;
-                    
-                    juce::String errorMessage;
-                    clearPlugin = vst3Format->createInstanceFromDescription(desc, 44100.0, 512, errorMessage);
-                    if (clearPlugin) {
-                        juce::Logger::writeToLog("Clear VST3 loaded successfully!");
-                        setPluginLoaded(true);
-                        
-                        // 앱 실행 시 stereo/mono 파라미터를 stereo로 설정
-                        try {
-                            auto params = clearPlugin->getParameters();
-                            if (params.size() > 13 && params[13] != nullptr) {
-                                params[13]->setValueNotifyingHost(1.0f); // stereo로 설정
-                                juce::Logger::writeToLog("Set stereo/mono parameter to stereo (VST3)");
-                            }
-                        } catch (...) {
-                            juce::Logger::writeToLog("Warning: Failed to set stereo/mono parameter (VST3)");
-                        }
-                    } else {
-                        juce::Logger::writeToLog("Failed to load Clear VST3: " + errorMessage);
-                        setPluginLoaded(false);
-                        
-                        // VST3 실패시 AU로 폴백
-                        juce::Logger::writeToLog("Falling back to AudioUnit...");
-                        juce::File auDir("/Library/Audio/Plug-Ins/Components");
-                        juce::File clearAU = auDir.getChildFile("Clear.component");
-                        if (clearAU.exists()) {
-                            juce::Logger::writeToLog("Found Clear AU: " + clearAU.getFullPathName());
-                            juce::AudioPluginFormat* auFormat = nullptr;
-                            for (int i = 0; i < pluginManager.getNumFormats(); ++i) {
-                                auto* format = pluginManager.getFormat(i);
-                                if (format && format->getName().contains("AudioUnit")) {
-                                    auFormat = format;
-                                    juce::Logger::writeToLog("Found AudioUnit format at index " + juce::String(i));
-                                    break;
-                                }
-                            }
-                            if (auFormat) {
-                                juce::PluginDescription auDesc;
-                                auDesc.fileOrIdentifier = clearAU.getFullPathName();
-                                auDesc.pluginFormatName = "AudioUnit";
-                                auDesc.name = "Clear";
-                                auDesc.descriptiveName = "Clear";
-                                auDesc.manufacturerName = "Clear";
-                                auDesc.category = "Effect";
-                                auDesc.isInstrument = false;
-                                
-                                juce::String auError;
-                                clearPlugin = auFormat->createInstanceFromDescription(auDesc, 44100.0, 512, auError);
-                                if (clearPlugin) {
-                                    juce::Logger::writeToLog("Clear AU loaded successfully as fallback");
-                                    setPluginLoaded(true);
-                                    
-                                    // 앱 실행 시 stereo/mono 파라미터를 stereo로 설정
-                                    try {
-                                        auto params = clearPlugin->getParameters();
-                                        if (params.size() > 13 && params[13] != nullptr) {
-                                            params[13]->setValueNotifyingHost(1.0f); // stereo로 설정
-                                            juce::Logger::writeToLog("Set stereo/mono parameter to stereo (AU)");
-                                        }
-                                    } catch (...) {
-                                        juce::Logger::writeToLog("Warning: Failed to set stereo/mono parameter (AU)");
-                                    }
-                                } else {
-                                    juce::Logger::writeToLog("Failed to load Clear AU: " + auError);
-                                    setPluginLoaded(false);
-                                }
-                            } else {
-                                juce::Logger::writeToLog("AudioUnit format not found");
-                                setPluginLoaded(false);
-                            }
-                        } else {
-                            juce::Logger::writeToLog("Clear AU not found");
-                            setPluginLoaded(false);
-                        }
-                    }
-                } else {
-                    juce::Logger::writeToLog("VST3 format not found");
-                    setPluginLoaded(false);
-                }
+            CLR_LOG_INFO("Loading Clear as " + desc.pluginFormatName + "...");
+            
+            double sampleRate = 0.0;
+            int blockSize = 0;
+            getPluginCreationSettings(sampleRate, blockSize);
+            const juce::String formatName = desc.pluginFormatName;
+            
+            juce::Component::SafePointer<ClearHostApp> safeThis(this);
+            format->createPluginInstanceAsync(desc, sampleRate, blockSize,
+                [safeThis, formatName](std::unique_ptr<juce::AudioPluginInstance> instance, const juce::String& error) {
+                    // 창이 먼저 닫혔으면 인스턴스는 여기서 그대로 해제됨
+                    if (safeThis == nullptr) return;
+                    safeThis->pluginInstanceCreated(std::move(instance), error, formatName);
+                });
+            return;
+        }
+        
+        // 모든 후보 실패
+        CLR_LOG_ERROR("Clear plugin could not be loaded");
+        setPluginLoading(false);
+        setPluginLoaded(false);
+        startupProfiler.addPhase("plugin", juce::Time::getMillisecondCounterHiRes() - pluginLoadStartMs);
+        startupProfiler.taskFinished();
+    }
+    
+    // createPluginInstanceAsync 완료 콜백 (메시지 스레드)
+    void pluginInstanceCreated(std::unique_ptr<juce::AudioPluginInstance> instance, const juce::String& error, const juce::String& formatName) {
+        if (isBeingDeleted) return;
+        
+        // 성공하면 설명을 캐시에 저장, 캐시된 설명으로 실패하면 그 항목을 무효화
+        ClearPluginLocator::recordCreationResult(pluginDescriptionCache, currentPluginCandidate, instance.get(), error);
+        
+        if (instance == nullptr) {
+            if (!pluginLoadCandidates.isEmpty()) {
+                CLR_LOG_INFO("Falling back to next plugin format...");
+            }
+            loadNextPluginCandidate();
+            return;
+        }
+        
+        CLR_LOG_INFO("Clear " + formatName + " loaded successfully!");
+        startupProfiler.addPhase("plugin", juce::Time::getMillisecondCounterHiRes() - pluginLoadStartMs);
+        
+        // 파라미터 핸들 캐시 구성 (이후 모든 접근은 parameterMap을 통해 O(1))
+        // 오디오 스레드는 clearPlugin이 교체된 후에만 parameterMap을 읽으므로 교체 전에 구성
+        parameterMap.build(*instance);
+        
+        {
+            // 장치 재시작의 prepareToPlay와 겹치지 않도록 준비 → 교체를 한 구간으로 묶음
+            const juce::ScopedLock pl(pluginPrepareLock);
+            
+            // 오디오 장치가 이미 돌고 있으면 교체 전에 준비 (콜백 락 밖에서 무거운 작업 수행)
+            if (preparedSampleRate > 0.0) {
+                instance->prepareToPlay(preparedSampleRate, preparedBlockSize);
+                
+                // clearPlugin이 비어 있는 동안 콜백은 bypass 경로를 쓰지 않으므로 여기서 다시 준비해도 안전
+                clearBypass.prepare(preparedSampleRate, 2, juce::jmax(preparedBlockSize, HostAudioCallback::MIN_DRY_INPUT_FRAMES),
+                                    instance->getLatencySamples());
+            }
+            
+            // 오디오 콜백 락 안에서 포인터만 교체 - 콜백은 교체 전후 어느 한쪽만 보게 됨
+            const juce::ScopedLock sl(deviceManager.getAudioCallbackLock());
+            clearPlugin = std::move(instance);
+        }
+        audioCallback.setDryLatencySamples(getTotalLatencySamples());
+        setProcessor(clearPlugin.get());
+        
+        // 지난 실행의 프리셋/노브 값/stereo 복원 (저장된 적 없으면 stereo)
+        restoreSavedPluginState(formatName);
+        
+        setPluginLoading(false);
+        setPluginLoaded(true);
+        
+        {
+            StartupProfiler::ScopedPhase phase(startupProfiler, "editor");
+            createPluginEditor();
+        }
+        
+        try {
+            CLR_LOG_INFO("Registering parameter listener...");
+            clearPlugin->addListener(this);
+            isAnimating = false;
+            paramSyncRetryCount = 0;
+            animationScheduler.schedule(paramSyncTrack, PARAM_SYNC_PERIOD_MS);
+        } catch (const std::exception& e) {
+            CLR_LOG_ERROR("Exception registering parameter listener: " + juce::String(e.what()));
+        } catch (...) {
+            CLR_LOG_ERROR("Unknown exception registering parameter listener");
+        }
+        
+        startupProfiler.taskFinished();
+    }
+    
+    // 플러그인 에디터 생성 및 표시
+    void createPluginEditor() {
+        try {
+            pluginEditor.reset(clearPlugin->createEditor());
+            if (pluginEditor) {
+                pluginEditor->setOpaque(true); // 완전히 불투명하게
+                addAndMakeVisible(pluginEditor.get());
+                resized();
+                CLR_LOG_INFO("Plugin editor created successfully");
             } else {
-                juce::Logger::writeToLog("Clear.vst3 not found");
-                setPluginLoaded(false);
+                CLR_LOG_WARNING("Warning: Failed to create plugin editor");
             }
         } catch (const std::exception& e) {
-            juce::Logger::writeToLog("Exception during plugin loading: " + juce::String(e.what()));
-            setPluginLoaded(false);
+            CLR_LOG_ERROR("Exception creating plugin editor: " + juce::String(e.what()));
         } catch (...) {
-            juce::Logger::writeToLog("Unknown exception during plugin loading");
-            setPluginLoaded(false);
+            CLR_LOG_ERROR("Unknown exception creating plugin editor");
         }
     }
     // LED 상태 업데이트 메서드들
     void updateLEDState() {
         if (!pluginStatusLED) return;
         
-        if (!pluginLoaded) {
+        if (pluginLoading) {
+            // 비동기 로딩 중이면 호박색으로 표시
+            pluginStatusLED->setState(LEDState::LOADING);
+        } else if (!pluginLoaded) {
             // 플러그인이 로딩되지 않았으면 빨간색으로 표시
             pluginStatusLED->setState(LEDState::PLUGIN_OFF);
         } else if (bypassActive) {
@@ -3503,6 +3012,11 @@ private:
         updateLEDState();
     }
     
+    void setPluginLoading(bool loading) {
+        pluginLoading = loading;
+        updateLEDState();
+    }
+    
     void setBypassActive(bool active) {
         bypassActive = active;
         updateLEDState();
@@ -3512,6 +3026,7 @@ private:
     void setPresetActive(bool active, const juce::String& presetName = "") {
         presetActive = active;
         activePresetName = presetName;
+        hostSettings.setActivePreset(active ? presetName : juce::String());
         updatePresetDisplay();
     }
     
@@ -3546,6 +3061,402 @@ private:
         setPresetActive(false);
     }
     
+    // 버튼/프리셋 공통 bypass 적용 (UI 표시 + 호스트 bypass 크로스페이드)
+    void applyBypassState(bool bypassState) {
+        if (bottom) {
+            bottom->setBypassState(bypassState);
+        }
+        setBypassActive(bypassState);
+        
+        // Panel의 bypass 상태도 업데이트
+        if (controlPanel) {
+            controlPanel->setBypassState(bypassState);
+        }
+        
+        // 플러그인 bypass 파라미터 대신 호스트가 지연 맞춘 dry와 크로스페이드 (atomic 플래그만 바꿈)
+        clearBypass.setBypassed(bypassState);
+        CLR_LOG_INFO("Bypass set to: " + juce::String(bypassState ? "ON" : "OFF"));
+    }
+    
+    // 플러그인 로드 직후 지난 실행 상태 복원 - 프리셋 전체 상태(이펙트 체인 포함) → stereo → 노브 값 순서
+    // (bypass는 항상 꺼진 채 시작하고, 장치는 장치 목록을 만들 때 따로 복원)
+    void restoreSavedPluginState(const juce::String& formatName) {
+        if (const auto* preset = presetStore.find(hostSettings.getActivePreset())) {
+            PresetStore::apply(*preset, *clearPlugin, parameterMap);
+            if (preset->hasChain) loadChainLayout(preset->chain);
+            currentPreset = preset->name;
+            setPresetActive(true, preset->name);
+        }
+        
+        const bool stereo = hostSettings.getStereo();
+        if (parameterMap.setValueNotifyingHost(ParameterMap::Role::stereo, stereo ? 1.0f : 0.0f)) {
+            CLR_LOG_INFO("Set stereo/mono parameter to " + juce::String(stereo ? "stereo" : "mono") + " (" + formatName + ")");
+        } else {
+            CLR_LOG_WARNING("Warning: Failed to set stereo/mono parameter (" + formatName + ")");
+        }
+        
+        if (const auto knobs = hostSettings.getKnobValues()) {
+            for (int i = 0; i < ParameterMap::NUM_KNOBS; ++i) {
+                parameterMap.setValueNotifyingHost(ParameterMap::roleForKnob(i), (*knobs)[(size_t)i]);
+            }
+        }
+    }
+    
+    // 종료 직전 현재 파라미터 값을 저장 (MIDI CC나 플러그인 UI로 바뀐 값 포함)
+    void storeSessionSettings() {
+        if (!clearPlugin || !parameterMap.isValid()) return;
+        
+        for (int i = 0; i < ParameterMap::NUM_KNOBS; ++i) {
+            const auto role = ParameterMap::roleForKnob(i);
+            if (parameterMap.has(role)) hostSettings.setKnobValue(i, parameterMap.getValue(role));
+        }
+        if (parameterMap.has(ParameterMap::Role::stereo)) {
+            hostSettings.setStereo(parameterMap.getValue(ParameterMap::Role::stereo) >= 0.5f);
+        }
+    }
+    
+    // 메모리에 있는 스냅샷을 바로 적용 (파일 I/O 없음)
+    // - 전체 상태가 있는 프리셋: setStateInformation 후 노브를 즉시 맞춤
+    // - 기본 프리셋(노브 값만): 기존처럼 노브 트윈으로 적용
+    void recallPreset(const juce::String& name) {
+        const auto* preset = presetStore.find(name);
+        if (preset == nullptr) return;
+        
+        currentPreset = preset->name;
+        setPresetActive(true, preset->name);
+        
+        if (clearPlugin) {
+            // 진행 중인 노브 램프가 불러온 상태를 덮어쓰지 않도록 먼저 멈추고, 오디오 스레드의 확인을 기다림
+            if (!parameterSmoother.stopAllAndWait()) {
+                CLR_LOG_WARNING("Knob ramps did not stop before preset recall (audio callback stalled)");
+            }
+            const double startMs = juce::Time::getMillisecondCounterHiRes();
+            const bool fullState = PresetStore::apply(*preset, *clearPlugin, parameterMap);
+            CLR_LOG_DEBUG("Preset '" + preset->name + "' recalled in "
+                          + juce::String(juce::Time::getMillisecondCounterHiRes() - startMs, 3) + " ms"
+                          + (fullState ? " (full state)" : " (parameters)"));
+            
+            if (fullState) {
+                animationScheduler.cancel(knobTweenTrack);
+                isAnimating = false;
+                updateKnobsFromPlugin();
+            } else {
+                startAnimation({ preset->knobs[0], preset->knobs[1], preset->knobs[2] });
+            }
+        }
+        
+        if (preset->hasChain) {
+            loadChainLayout(preset->chain);
+        }
+        if (!preset->factory && preset->bypass != bypassActive) {
+            applyBypassState(preset->bypass);
+        }
+        if (preset->inputDevice.isNotEmpty() && preset->inputDevice != currentInputDevice) {
+            changeAudioInputDevice(preset->inputDevice);
+        }
+        if (preset->outputDevice.isNotEmpty() && preset->outputDevice != currentOutputDevice) {
+            changeAudioOutputDevice(preset->outputDevice);
+        }
+        repaint();
+    }
+    
+    // preset 버튼 클릭: 현재 상태를 사용자 프리셋으로 저장 / 선택된 사용자 프리셋 삭제
+    void showPresetMenu() {
+        constexpr int saveId = 1;
+        constexpr int deleteId = 2;
+        constexpr int addBeforeId = 3;
+        constexpr int addAfterId = 4;
+        constexpr int bypassBaseId = 100;
+        constexpr int removeBaseId = 200;
+        
+        const auto* active = presetActive ? presetStore.find(activePresetName) : nullptr;
+        const bool canDelete = active != nullptr && !active->factory;
+        
+        juce::PopupMenu menu;
+        menu.addItem(saveId, "Save current as preset...", clearPlugin != nullptr);
+        menu.addItem(deleteId, canDelete ? "Delete \"" + active->name + "\"" : juce::String("Delete preset"), canDelete);
+        
+        // 이펙트 체인 (프리셋에 함께 저장됨)
+        juce::PopupMenu effects;
+        effects.addItem(addBeforeId, "Add effect before Clear...", clearPlugin != nullptr);
+        effects.addItem(addAfterId, "Add effect after Clear...", clearPlugin != nullptr);
+        const auto& slots = pluginChain.getLayout();
+        if (!slots.empty()) effects.addSeparator();
+        for (int i = 0; i < (int)slots.size(); ++i) {
+            const auto& slot = slots[(size_t)i];
+            juce::PopupMenu slotMenu;
+            slotMenu.addItem(bypassBaseId + i, "Bypass", true, slot->isBypassed());
+            slotMenu.addItem(removeBaseId + i, "Remove");
+            const juce::String where = slot->getPosition() == PluginChain::Position::beforeClear ? "pre" : "post";
+            effects.addSubMenu(slot->getName() + " (" + where + ")", slotMenu);
+        }
+        menu.addSubMenu("Effects", effects);
+        
+        juce::Component::SafePointer<ClearHostApp> safeThis(this);
+        menu.showMenuAsync(juce::PopupMenu::Options(), [safeThis](int result) {
+            if (safeThis == nullptr) return;
+            if (result == saveId) {
+                safeThis->promptSavePreset();
+            } else if (result == deleteId) {
+                safeThis->deleteActivePreset();
+            } else if (result == addBeforeId || result == addAfterId) {
+                safeThis->chooseChainEffect(result == addBeforeId ? PluginChain::Position::beforeClear
+                                                                  : PluginChain::Position::afterClear);
+            } else if (result >= removeBaseId) {
+                safeThis->removeChainEffect(result - removeBaseId);
+            } else if (result >= bypassBaseId) {
+                safeThis->toggleChainEffectBypass(result - bypassBaseId);
+            }
+        });
+    }
+    
+    void promptSavePreset() {
+        auto* window = new juce::AlertWindow("Save preset", "Preset name:", juce::MessageBoxIconType::NoIcon, this);
+        window->addTextEditor("name", presetActive ? activePresetName : juce::String());
+        window->addButton("Save", 1, juce::KeyPress(juce::KeyPress::returnKey));
+        window->addButton("Cancel", 0, juce::KeyPress(juce::KeyPress::escapeKey));
+        
+        juce::Component::SafePointer<ClearHostApp> safeThis(this);
+        window->enterModalState(true, juce::ModalCallbackFunction::create([safeThis, window](int result) {
+            const auto name = window->getTextEditorContents("name").trim();
+            if (safeThis == nullptr || result != 1 || name.isEmpty()) return;
+            safeThis->saveUserPreset(name);
+        }), true);
+    }
+    
+    void saveUserPreset(const juce::String& name) {
+        if (!clearPlugin) return;
+        
+        if (presetStore.isFactoryName(name)) {
+            CLR_LOG_WARNING("Preset name is reserved for a factory preset: " + name);
+            return;
+        }
+        
+        auto preset = PresetStore::capture(name, *clearPlugin, parameterMap);
+        preset.hasChain = true;
+        preset.chain = pluginChain.capture();
+        preset.bypass = bypassActive;
+        preset.inputDevice = currentInputDevice;
+        preset.outputDevice = currentOutputDevice;
+        if (!presetStore.save(preset)) return;
+        
+        updatePresetList();
+        currentPreset = preset.name;
+        setPresetActive(true, preset.name);
+    }
+    
+    void deleteActivePreset() {
+        if (!presetStore.remove(activePresetName)) return;
+        
+        updatePresetList();
+        resetPresetToDefault();
+    }
+    
+    // 이펙트 체인 구성 교체 - pluginPrepareLock 안에서 새 슬롯을 준비하고 오디오 콜백 락 안에서는 포인터만 바꿈
+    void commitChainLayout(PluginChain::Layout slots) {
+        std::shared_ptr<const PluginChain::Layout> retired;
+        {
+            const juce::ScopedLock pl(pluginPrepareLock);
+            auto layout = pluginChain.buildLayout(std::move(slots));
+            const juce::ScopedLock sl(deviceManager.getAudioCallbackLock());
+            retired = pluginChain.swapLayout(std::move(layout));
+        }
+        // 새 구성에서 빠진 플러그인은 락 밖(메시지 스레드)에서 해제
+        retired.reset();
+        audioCallback.setDryLatencySamples(getTotalLatencySamples());
+        
+        CLR_LOG_INFO("Effect chain: " + juce::String((int)pluginChain.getLayout().size()) + " slots, latency "
+                     + juce::String(getTotalLatencySamples()) + " samples");
+    }
+    
+    // Clear와 체인 이펙트의 지연 합 (직렬이므로 그대로 더함)
+    int getTotalLatencySamples() const {
+        return pluginChain.getLatencySamples() + (clearPlugin ? clearPlugin->getLatencySamples() : 0);
+    }
+    
+    void chooseChainEffect(PluginChain::Position position) {
+        effectChooser = std::make_unique<juce::FileChooser>("Add effect", juce::File("/Library/Audio/Plug-Ins"), "*.vst3;*.component");
+        
+        juce::Component::SafePointer<ClearHostApp> safeThis(this);
+        const int flags = juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles
+                        | juce::FileBrowserComponent::canSelectDirectories;
+        effectChooser->launchAsync(flags, [safeThis, position](const juce::FileChooser& chooser) {
+            const auto bundle = chooser.getResult();
+            if (safeThis == nullptr || bundle == juce::File()) return;
+            
+            auto desc = ClearPluginLocator::makeDescription(bundle, bundle.hasFileExtension("component") ? "AudioUnit" : "VST3");
+            desc.name = desc.descriptiveName = bundle.getFileNameWithoutExtension();
+            desc.manufacturerName = {};
+            safeThis->addChainEffect(desc, position);
+        });
+    }
+    
+    // 이펙트를 비동기로 생성해 해당 위치의 끝에 추가
+    void addChainEffect(const juce::PluginDescription& desc, PluginChain::Position position) {
+        auto* format = ClearPluginLocator::findFormat(pluginManager, desc.pluginFormatName);
+        if (format == nullptr) {
+            CLR_LOG_WARNING(desc.pluginFormatName + " format not found");
+            return;
+        }
+        
+        double sampleRate = 0.0;
+        int blockSize = 0;
+        getPluginCreationSettings(sampleRate, blockSize);
+        
+        juce::Component::SafePointer<ClearHostApp> safeThis(this);
+        format->createPluginInstanceAsync(desc, sampleRate, blockSize,
+            [safeThis, position, name = desc.name](std::unique_ptr<juce::AudioPluginInstance> instance, const juce::String& error) {
+                if (safeThis == nullptr || safeThis->isBeingDeleted) return;
+                if (instance == nullptr) {
+                    CLR_LOG_ERROR("Failed to load effect " + name + ": " + error);
+                    return;
+                }
+                
+                auto slots = safeThis->pluginChain.getLayout();
+                slots.push_back(std::make_shared<PluginChain::Slot>(std::move(instance), position, false));
+                safeThis->commitChainLayout(std::move(slots));
+                safeThis->resetPresetToDefault();
+            });
+    }
+    
+    void removeChainEffect(int index) {
+        auto slots = pluginChain.getLayout();
+        if (!juce::isPositiveAndBelow(index, (int)slots.size())) return;
+        
+        slots.erase(slots.begin() + index);
+        commitChainLayout(std::move(slots));
+        resetPresetToDefault();
+    }
+    
+    // bypass는 atomic 플래그만 바꿈 (구성 교체 없음, 오디오 스레드가 크로스페이드)
+    void toggleChainEffectBypass(int index) {
+        const auto& slots = pluginChain.getLayout();
+        if (!juce::isPositiveAndBelow(index, (int)slots.size())) return;
+        
+        auto& slot = *slots[(size_t)index];
+        slot.setBypassed(!slot.isBypassed());
+        CLR_LOG_INFO("Effect " + slot.getName() + " bypass: " + (slot.isBypassed() ? "ON" : "OFF"));
+    }
+    
+    // 프리셋의 체인 구성으로 교체 - 이펙트를 모두 비동기로 만든 뒤 한 번에 교체 (실패한 슬롯은 건너뜀)
+    void loadChainLayout(const std::vector<PluginChain::SlotSnapshot>& snapshots) {
+        const int generation = ++chainLoadGeneration;
+        if (snapshots.empty()) {
+            commitChainLayout({});
+            return;
+        }
+        
+        struct PendingChain {
+            PluginChain::Layout slots;
+            int remaining = 0;
+        };
+        auto pending = std::make_shared<PendingChain>();
+        pending->slots.resize(snapshots.size());
+        pending->remaining = (int)snapshots.size();
+        
+        double sampleRate = 0.0;
+        int blockSize = 0;
+        getPluginCreationSettings(sampleRate, blockSize);
+        
+        juce::Component::SafePointer<ClearHostApp> safeThis(this);
+        auto slotFinished = [safeThis, generation, pending] {
+            if (--pending->remaining > 0 || safeThis == nullptr || generation != safeThis->chainLoadGeneration) return;
+            
+            PluginChain::Layout slots;
+            for (auto& slot : pending->slots) {
+                if (slot != nullptr) slots.push_back(std::move(slot));
+            }
+            safeThis->commitChainLayout(std::move(slots));
+        };
+        
+        for (size_t i = 0; i < snapshots.size(); ++i) {
+            const auto& snapshot = snapshots[i];
+            auto* format = ClearPluginLocator::findFormat(pluginManager, snapshot.description.pluginFormatName);
+            if (format == nullptr) {
+                CLR_LOG_WARNING("Effect " + snapshot.description.name + ": " + snapshot.description.pluginFormatName + " format not found");
+                slotFinished();
+                continue;
+            }
+            
+            format->createPluginInstanceAsync(snapshot.description, sampleRate, blockSize,
+                [pending, i, snapshot, slotFinished](std::unique_ptr<juce::AudioPluginInstance> instance, const juce::String& error) {
+                    if (instance != nullptr) {
+                        if (snapshot.state.getSize() > 0) {
+                            instance->setStateInformation(snapshot.state.getData(), (int)snapshot.state.getSize());
+                        }
+                        pending->slots[i] = std::make_shared<PluginChain::Slot>(std::move(instance), snapshot.position, snapshot.bypassed);
+                    } else {
+                        CLR_LOG_ERROR("Failed to load effect " + snapshot.description.name + ": " + error);
+                    }
+                    slotFinished();
+                });
+        }
+    }
+    
+    // Face, 세퍼레이터, 로고는 색상이 바뀔 때만 변하므로 이미지로 캐시
+    // 화면 배율(Retina 등)에 맞춘 물리 픽셀 크기로 렌더링해 1:1로 복사
+    void drawStaticLayer(juce::Graphics& g) {
+        if (!face) return;
+        
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        if (!staticLayer.isValid() || staticLayerColour != face->getColor() || staticLayerScale != scale) {
+            staticLayer = juce::Image(juce::Image::ARGB, juce::roundToInt(160 * scale), juce::roundToInt(265 * scale), true);
+            juce::Graphics layer(staticLayer);
+            layer.addTransform(juce::AffineTransform::scale(scale));
+            face->draw(layer);
+            drawLogo(layer, face->getTextColor());
+            
+            staticLayerColour = face->getColor();
+            staticLayerScale = scale;
+        }
+        
+        g.setOpacity(1.0f);
+        g.drawImage(staticLayer, juce::Rectangle<float>(0.0f, 0.0f, 160.0f, 265.0f));
+    }
+    
+    // 노브 하나를 다시 그릴 영역 (그림자가 벗어나는 여백 + 아래 레이블 20px)
+    juce::Rectangle<int> getKnobDirtyArea(int knobIndex) const {
+        const auto& rect = knobRects[knobIndex];
+        return rect.expanded(KnobWithLabel::SHADOW_MARGIN).withBottom(rect.getBottom() + 20);
+    }
+    
+    juce::Point<float> getKnobShadowOffset(int knobIndex, juce::Point<int> mousePos) const {
+        return KnobWithLabel::getShadowOffset(knobRects[knobIndex].getCentre().toFloat(), mousePos).value_or(juce::Point<float>());
+    }
+    
+    void repaintKnob(int knobIndex) {
+        // 첫 페인트 전에는 노브 위치가 정해지지 않았으므로 전체를 그림
+        if (knobIndex < 0 || knobIndex >= (int)knobRects.size() || knobRects[knobIndex].isEmpty()) {
+            repaint();
+            return;
+        }
+        // 애니메이션 틱 안에서는 프레임 끝에 합쳐서 전달됨
+        animationScheduler.repaint(getKnobDirtyArea(knobIndex));
+    }
+    
+    void repaintKnobs() {
+        for (int i = 0; i < (int)knobRects.size(); ++i) {
+            repaintKnob(i);
+        }
+    }
+    
+    // 마우스 이동 시 그림자가 마지막으로 그린 위치에서 눈에 띄게 움직인 노브만 다시 그림
+    // repaint 영역은 다음 화면 갱신 때 합쳐서 한 번에 그려지므로 마우스 이벤트가 많아도 프레임당 한 번
+    void updateHoverShadows(juce::Point<int> newMousePos) {
+        if (newMousePos == currentMousePos) return;
+        currentMousePos = newMousePos;
+        
+        for (int i = 0; i < (int)knobRects.size() && i < (int)paintedShadowOffsets.size(); ++i) {
+            if (knobRects[i].isEmpty()) {
+                repaint();
+                return;
+            }
+            if (getKnobShadowOffset(i, newMousePos).getDistanceFrom(paintedShadowOffsets[(size_t)i]) >= SHADOW_REPAINT_THRESHOLD) {
+                repaint(getKnobDirtyArea(i));
+            }
+        }
+    }
+    
     void drawLogo(juce::Graphics& g, juce::Colour textColor = juce::Colours::black) {
         // 라이트/다크모드에 따라 SVG 파일 선택
         bool isDarkMode = textColor == juce::Colours::white;
@@ -3562,9 +3473,9 @@ private:
         int boxHeight = 15; // 기본값, SVG 비율에 따라 조정됨
         
         // 텍스트 크기 계산 (30pt - 2pt = 28pt)
-        g.setFont(juce::Font("Euclid Circular B", 28.0f, juce::Font::plain));
-        int textHeight = (int)g.getCurrentFont().getHeight();
-        int textWidth = g.getCurrentFont().getStringWidth("sup clr");
+        const auto& logoText = uiText().get("sup clr", LOGO_FONT_SIZE);
+        int textHeight = (int)logoText.height;
+        int textWidth = logoText.width;
         
         // 박스와 텍스트 간격: 8px (9px에서 1px 줄임)
         int spacing = 8;
@@ -3586,7 +3497,7 @@ private:
                 logoDrawable->drawWithin(g, juce::Rectangle<float>(boxX, boxY, boxWidth, boxHeight), juce::RectanglePlacement::centred, 1.0f);
             } catch (...) {
                 // SVG 그리기 실패 시 기본 박스로 대체
-                juce::Logger::writeToLog("Warning: Failed to draw logo SVG, using fallback");
+                CLR_LOG_WARNING("Warning: Failed to draw logo SVG, using fallback");
                 g.setColour(textColor.withAlpha(0.1f));
                 g.fillRect(boxX, boxY, boxWidth, boxHeight);
             }
@@ -3598,10 +3509,9 @@ private:
         
         // 'sup clr' 텍스트 그리기 (28pt, textColor 10% 투명도, 텍스트만 위로 2px 추가 이동)
         g.setColour(textColor.withAlpha(0.1f));
-        g.setFont(juce::Font("Euclid Circular B", 28.0f, juce::Font::plain));
         int textX = boxX + boxWidth + spacing; // 박스 오른쪽 + 8px 여백
         int textY = boxY + boxHeight/2 - textHeight/2 - 2; // 박스 세로 중앙에 텍스트 세로 중앙 정렬 - 2px 위로
-        g.drawText("sup clr", textX, textY, textWidth, textHeight, juce::Justification::centredLeft);
+        uiText().drawText(g, "sup clr", { textX, textY, textWidth, textHeight }, juce::Justification::centredLeft, LOGO_FONT_SIZE);
     }
     
     void updateAudioDeviceLists() {
@@ -3616,23 +3526,23 @@ private:
         if (deviceType) {
             try {
                 auto inputNames = deviceType->getDeviceNames(true); // true = input devices
-                juce::Logger::writeToLog("Found " + juce::String(inputNames.size()) + " input devices");
+                CLR_LOG_INFO("Found " + juce::String(inputNames.size()) + " input devices");
                 
                 for (int i = 0; i < inputNames.size(); ++i) {
                     juce::String deviceName = inputNames[i];
-                    juce::Logger::writeToLog("Input device " + juce::String(i) + ": " + deviceName);
+                    CLR_LOG_DEBUG("Input device " + juce::String(i) + ": " + deviceName);
                     
                     // BlackHole을 "System Sound / BlackHole"로 표시
                     if (deviceName.contains("BlackHole") || deviceName.contains("blackhole")) {
                         inputDeviceBox->addItem("System Sound / BlackHole", i + 1);
-                        juce::Logger::writeToLog("Added System Sound / BlackHole option");
+                        CLR_LOG_INFO("Added System Sound / BlackHole option");
                         blackHoleFound = true;
                     } else {
                         inputDeviceBox->addItem(deviceName, i + 1);
                     }
                 }
         } catch (...) {
-                juce::Logger::writeToLog("Error getting input device names");
+                CLR_LOG_ERROR("Error getting input device names");
             }
         }
         
@@ -3641,7 +3551,7 @@ private:
             int disabledItemId = 999; // 고유한 ID
             inputDeviceBox->addItem("System Sound / BlackHole - Not Installed", disabledItemId);
             inputDeviceBox->setItemEnabled(disabledItemId, false);
-            juce::Logger::writeToLog("BlackHole not found - added disabled option");
+            CLR_LOG_WARNING("BlackHole not found - added disabled option");
         }
         
         // 출력 장치 목록 업데이트
@@ -3650,11 +3560,11 @@ private:
         if (deviceType) {
             try {
                 auto outputNames = deviceType->getDeviceNames(false); // false = output devices
-                juce::Logger::writeToLog("Found " + juce::String(outputNames.size()) + " output devices");
+                CLR_LOG_INFO("Found " + juce::String(outputNames.size()) + " output devices");
                 
                 for (int i = 0; i < outputNames.size(); ++i) {
                     juce::String deviceName = outputNames[i];
-                    juce::Logger::writeToLog("Output device " + juce::String(i) + ": " + deviceName);
+                    CLR_LOG_DEBUG("Output device " + juce::String(i) + ": " + deviceName);
                     
                     // BlackHole 2ch는 숨김 처리
                     if (!deviceName.contains("BlackHole 2ch")) {
@@ -3674,14 +3584,14 @@ private:
                 }
                 
                 if (!externalHeadphonesFound) {
-                    juce::Logger::writeToLog("External headphones not found in device list - adding manually");
+                    CLR_LOG_WARNING("External headphones not found in device list - adding manually");
                     int manualId = 1000; // 고유한 ID
                     outputDeviceBox->addItem("외장 헤드폰 (Manual)", manualId);
-                    juce::Logger::writeToLog("Added external headphones manually");
+                    CLR_LOG_INFO("Added external headphones manually");
                 }
                 
             } catch (...) {
-                juce::Logger::writeToLog("Error getting output device names");
+                CLR_LOG_ERROR("Error getting output device names");
             }
         }
         
@@ -3692,17 +3602,17 @@ private:
                 if (inputDeviceBox->getItemText(i) == currentInputDevice) {
                     inputDeviceBox->setSelectedId(i, juce::dontSendNotification);
                     inputDeviceFound = true;
-                    juce::Logger::writeToLog("Selected saved input device in ComboBox: " + currentInputDevice);
+                    CLR_LOG_INFO("Selected saved input device in ComboBox: " + currentInputDevice);
                     break;
                 }
             }
             if (!inputDeviceFound) {
                 // "unassigned"가 ComboBox에 없으면 선택하지 않음 (첫 번째 항목 자동 선택 방지)
                 if (currentInputDevice == "unassigned") {
-                    juce::Logger::writeToLog("Input device is unassigned - not selecting any ComboBox item");
+                    CLR_LOG_INFO("Input device is unassigned - not selecting any ComboBox item");
                 } else {
                     inputDeviceBox->setSelectedId(1, juce::dontSendNotification);
-                    juce::Logger::writeToLog("Saved input device not found in ComboBox, using first item");
+                    CLR_LOG_WARNING("Saved input device not found in ComboBox, using first item");
                 }
             }
         }
@@ -3713,201 +3623,141 @@ private:
                 if (outputDeviceBox->getItemText(i) == currentOutputDevice) {
                     outputDeviceBox->setSelectedId(i, juce::dontSendNotification);
                     outputDeviceFound = true;
-                    juce::Logger::writeToLog("Selected saved output device in ComboBox: " + currentOutputDevice);
+                    CLR_LOG_INFO("Selected saved output device in ComboBox: " + currentOutputDevice);
                     break;
                 }
             }
             if (!outputDeviceFound) {
         outputDeviceBox->setSelectedId(1, juce::dontSendNotification);
-                juce::Logger::writeToLog("Saved output device not found in ComboBox, using first item");
+                CLR_LOG_WARNING("Saved output device not found in ComboBox, using first item");
             }
         }
     }
     
+    // 장치 전환은 DeviceTransitionScheduler가 요청을 모아 페이드 후 한 번에 적용 (여기서는 이름만 확정해서 요청)
     void changeAudioInputDevice(const juce::String& deviceName) {
-        juce::Logger::writeToLog("Changing input device to: " + deviceName);
+        CLR_LOG_INFO("Changing input device to: " + deviceName);
         currentInputDevice = deviceName; // 현재 선택된 장치 업데이트
+        hostSettings.setInputDevice(deviceName);
         
         if (deviceName == "unassigned") {
             // unassigned 선택 시 입력 장치를 비활성화 (묵음 상태)
-            juce::Logger::writeToLog("Setting input device to unassigned (silent)");
+            CLR_LOG_INFO("Setting input device to unassigned (silent)");
             
             // 시스템 출력 장치를 원래대로 복원
             restoreSystemOutputDevice();
-            
-            // 오디오 재시작을 위해 일시 중지
-            deviceManager.closeAudioDevice();
-            
-            // 입력 장치를 비활성화
-            auto currentSetup = deviceManager.getAudioDeviceSetup();
-            currentSetup.inputDeviceName = ""; // 빈 문자열로 설정하여 입력 비활성화
-            
-            auto result = deviceManager.setAudioDeviceSetup(currentSetup, true);
-            if (result.isNotEmpty()) {
-                juce::Logger::writeToLog("Failed to set input device to unassigned: " + result);
-            } else {
-                juce::Logger::writeToLog("Successfully set input device to unassigned (silent)");
-                
-                // 오디오 재시작
-                deviceManager.restartLastAudioDevice();
-            }
+            deviceTransitions.requestInputDevice({});
             return;
-        } else if (deviceName == "System Sound / BlackHole" || deviceName == "System Sound / BlackHole - Not Installed") {
+        }
+        
+        if (deviceName == "System Sound / BlackHole" || deviceName == "System Sound / BlackHole - Not Installed") {
             // 비활성화된 BlackHole 옵션 선택 시 처리
             if (deviceName.contains("Not Installed")) {
-                juce::Logger::writeToLog("BlackHole not installed - showing info");
-                // 여기에 나중에 설치 안내 다이얼로그를 추가할 수 있습니다
-                // 현재는 기본 입력으로 되돌리기
+                CLR_LOG_WARNING("BlackHole not installed - showing info");
                 return;
             }
-            // BlackHole 장치 찾기
-            auto* deviceType = deviceManager.getCurrentDeviceTypeObject();
-            if (deviceType) {
-                try {
-                    auto inputNames = deviceType->getDeviceNames(true);
-                    juce::Logger::writeToLog("Searching for BlackHole device among " + juce::String(inputNames.size()) + " input devices");
-                    
-                    for (int i = 0; i < inputNames.size(); ++i) {
-                        juce::String actualDeviceName = inputNames[i];
-                        juce::Logger::writeToLog("Checking device: " + actualDeviceName);
-                        
-                        if (actualDeviceName.contains("BlackHole") || actualDeviceName.contains("blackhole")) {
-                            // 실제 BlackHole 장치로 설정
-                            auto currentSetup = deviceManager.getAudioDeviceSetup();
-                            currentSetup.inputDeviceName = actualDeviceName;
-                            
-                            // 오디오 재시작을 위해 일시 중지
-                            deviceManager.closeAudioDevice();
-                            
-                            auto result = deviceManager.setAudioDeviceSetup(currentSetup, true);
-                            if (result.isNotEmpty()) {
-                                juce::Logger::writeToLog("Failed to change input device to BlackHole: " + result);
-                            } else {
-                                juce::Logger::writeToLog("Successfully connected to System Sound / BlackHole");
-                                
-                                // 시스템 출력 장치를 BlackHole로 설정
-                                setSystemOutputToBlackHole();
-                                
-                                // 오디오 재시작
-                                deviceManager.restartLastAudioDevice();
-                            }
-                            return;
-                        }
-                    }
-                    juce::Logger::writeToLog("BlackHole device not found in available devices");
-                } catch (...) {
-                    juce::Logger::writeToLog("Error while searching for BlackHole device");
-                }
-            }
-        } else {
-            // 특정 입력 장치로 설정
-            auto currentSetup = deviceManager.getAudioDeviceSetup();
-            currentSetup.inputDeviceName = deviceName;
-            
-            // 오디오 재시작을 위해 일시 중지
-            deviceManager.closeAudioDevice();
             
-            auto result = deviceManager.setAudioDeviceSetup(currentSetup, true);
-            if (result.isNotEmpty()) {
-                juce::Logger::writeToLog("Failed to change input device to: " + deviceName + " (" + result + ")");
-            } else {
-                juce::Logger::writeToLog("Successfully changed input device to: " + deviceName);
-                
-                // BlackHole이 아닌 다른 장치로 변경 시 시스템 출력 복원
-                restoreSystemOutputDevice();
-                
-                // 오디오 재시작
-                deviceManager.restartLastAudioDevice();
+            // 실제 BlackHole 장치 이름 찾기
+            auto actualDeviceName = findDeviceName(true, { "BlackHole", "blackhole" });
+            if (actualDeviceName.isEmpty()) {
+                CLR_LOG_WARNING("BlackHole device not found in available devices");
+                return;
             }
+            deviceTransitions.requestInputDevice(actualDeviceName);
+            return;
         }
+        
+        // 특정 입력 장치로 설정
+        deviceTransitions.requestInputDevice(deviceName);
     }
     
     void changeAudioOutputDevice(const juce::String& deviceName) {
-        juce::Logger::writeToLog("Changing output device to: " + deviceName);
+        CLR_LOG_INFO("Changing output device to: " + deviceName);
         currentOutputDevice = deviceName; // 현재 선택된 장치 업데이트
+        hostSettings.setOutputDevice(deviceName);
         
         if (deviceName == "외장 헤드폰 (Manual)") {
-            // 수동으로 추가된 외장 헤드폰 처리
-            juce::Logger::writeToLog("Attempting to set external headphones manually");
-            
-            // 가능한 외장 헤드폰 이름들 시도
-            juce::StringArray possibleNames = {
+            // 수동으로 추가된 외장 헤드폰 처리 - 가능한 외장 헤드폰 이름들 시도
+            auto actualDeviceName = findDeviceName(false, {
                 "외장 헤드폰",
-                "External Headphones", 
+                "External Headphones",
                 "Headphones",
                 "외장 헤드폰 (Built-in)",
                 "External Headphones (Built-in)"
-            };
-            
-            auto* deviceType = deviceManager.getCurrentDeviceTypeObject();
-            if (deviceType) {
-                try {
-                    auto outputNames = deviceType->getDeviceNames(false);
-                    juce::Logger::writeToLog("Searching for external headphones among " + juce::String(outputNames.size()) + " output devices");
-                    
-                    for (int i = 0; i < outputNames.size(); ++i) {
-                        juce::String actualDeviceName = outputNames[i];
-                        juce::Logger::writeToLog("Checking output device: " + actualDeviceName);
-                        
-                        for (auto& possibleName : possibleNames) {
-                            if (actualDeviceName.contains(possibleName)) {
-                                // 실제 외장 헤드폰 장치로 설정
-                                auto currentSetup = deviceManager.getAudioDeviceSetup();
-                                currentSetup.outputDeviceName = actualDeviceName;
-                                
-                                // 오디오 재시작을 위해 일시 중지
-                                deviceManager.closeAudioDevice();
-                                
-                                auto result = deviceManager.setAudioDeviceSetup(currentSetup, true);
-                                if (result.isNotEmpty()) {
-                                    juce::Logger::writeToLog("Failed to change output device to external headphones: " + result);
-                                } else {
-                                    juce::Logger::writeToLog("Successfully connected to external headphones: " + actualDeviceName);
-                                    
-                                    // 오디오 재시작
-                                    deviceManager.restartLastAudioDevice();
-                                }
-                                return;
-                            }
-                        }
-                    }
-                    juce::Logger::writeToLog("External headphones device not found in available devices");
-    } catch (...) {
-                    juce::Logger::writeToLog("Error while searching for external headphones device");
+            });
+            if (actualDeviceName.isEmpty()) {
+                CLR_LOG_WARNING("External headphones device not found in available devices");
+                return;
+            }
+            deviceTransitions.requestOutputDevice(actualDeviceName);
+            return;
+        }
+        
+        // 특정 출력 장치로 설정
+        deviceTransitions.requestOutputDevice(deviceName);
+    }
+    
+    // 현재 장치 타입에서 후보 문자열을 포함하는 첫 장치 이름 (없으면 빈 문자열)
+    juce::String findDeviceName(bool wantInputs, const juce::StringArray& candidates) {
+        auto* deviceType = deviceManager.getCurrentDeviceTypeObject();
+        if (deviceType == nullptr) return {};
+        
+        try {
+            auto names = deviceType->getDeviceNames(wantInputs);
+            for (auto& name : names) {
+                for (auto& candidate : candidates) {
+                    if (name.contains(candidate)) return name;
                 }
             }
+        } catch (...) {
+            CLR_LOG_ERROR("Error while searching audio devices");
+        }
+        return {};
+    }
+    
+    void writeAudioMeterCsv() {
+        auto csvFile = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+                       .getChildFile("ClearHost")
+                       .getChildFile("audio_meter_" + juce::Time::getCurrentTime().formatted("%Y%m%d%H%M%S") + ".csv");
+        if (audioMeter.writeCsv(csvFile)) {
+            CLR_LOG_INFO("Audio meter stats written to: " + csvFile.getFullPathName());
+        }
+    }
+    
+    // 메시지 스레드: 장치 전환이 끝난 뒤 시스템 출력 라우팅 정리
+    void deviceTransitionFinished(const DeviceTransitionScheduler::Result& result) {
+        if (!result.succeeded() || !result.inputRequested || result.inputDevice.isEmpty()) return;
+        
+        if (result.inputDevice.containsIgnoreCase("BlackHole")) {
+            CLR_LOG_INFO("Successfully connected to System Sound / BlackHole");
+            // 시스템 출력 장치를 BlackHole로 설정
+            setSystemOutputToBlackHole();
         } else {
-            // 특정 출력 장치로 설정
-            auto currentSetup = deviceManager.getAudioDeviceSetup();
-            currentSetup.outputDeviceName = deviceName;
-            
-            // 오디오 재시작을 위해 일시 중지
-            deviceManager.closeAudioDevice();
-            
-            auto result = deviceManager.setAudioDeviceSetup(currentSetup, true);
-            if (result.isNotEmpty()) {
-                juce::Logger::writeToLog("Failed to change output device to: " + deviceName + " (" + result + ")");
-            } else {
-                juce::Logger::writeToLog("Successfully changed output device to: " + deviceName);
-                
-                // 오디오 재시작
-                deviceManager.restartLastAudioDevice();
-            }
+            // BlackHole이 아닌 다른 장치로 변경 시 시스템 출력 복원
+            restoreSystemOutputDevice();
         }
     }
 };
 
 class MainWindow : public juce::DocumentWindow {
 public:
-    MainWindow(juce::String name) : juce::DocumentWindow(name,
+    MainWindow(juce::String name, HostSettings& settingsToUse) : juce::DocumentWindow(name,
         juce::Desktop::getInstance().getDefaultLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId),
-        juce::DocumentWindow::allButtons) {
+        juce::DocumentWindow::allButtons), settings(settingsToUse) {
+        // centreWithSize가 moved()로 저장값을 덮어쓰기 전에 읽어 둠
+        const auto savedWindowState = settings.getWindowState();
+        
         setUsingNativeTitleBar(true);
         setResizable(true, true);
-        setContentOwned(new ClearHostApp(), true);
+        setContentOwned(new ClearHostApp(settings), true);
         // 고정 창 크기: 160 x 265 픽셀
         centreWithSize(160, 265);
         
+        // 지난 실행의 창 위치 복원
+        if (savedWindowState.isNotEmpty()) {
+            restoreWindowStateFromString(savedWindowState);
+        }
+        
         // 항상 위에 표시되도록 설정 (다른 앱들과 함께 사용할 때 편리함)
         setAlwaysOnTop(true);
         
@@ -3923,11 +3773,22 @@ public:
                 }
                 
                 // 시스템 출력 소스 복구
-                app->restoreSystemOutputDevice();
+                app->systemAudioRouter.restoreSavedOutputDeviceAndWait(2000);
                 
-                // 1. 오디오 정리 (가장 먼저!)
+                // 1. 오디오 정리 (가장 먼저! 아직 적용되지 않은 장치 전환은 버림)
+                app->deviceTransitions.stop();
                 app->shutdownAudio();
-                juce::Logger::writeToLog("Audio shutdown completed in closeButtonPressed");
+                CLR_LOG_INFO("Audio shutdown completed in closeButtonPressed");
+                
+                // 이펙트 체인 해제 (Clear보다 먼저, 만들고 있던 프리셋 체인도 버림)
+                app->loadChainLayout({});
+                
+                // 현재 파라미터 값과 창 위치 저장 (파일 기록은 HostSettings 소멸 시)
+                app->storeSessionSettings();
+                settings.setWindowState(getWindowStateAsString());
+                
+                // 오디오 콜백 계측 결과를 CSV로 저장
+                app->writeAudioMeterCsv();
                 
                 // 2. 플러그인 리스너 해제
                 if (app->clearPlugin) {
@@ -3935,14 +3796,14 @@ public:
                         auto params = app->clearPlugin->getParameters();
                         if (params.size() > 0 && params[0] != nullptr) {
                             app->clearPlugin->removeListener(app);
-                            juce::Logger::writeToLog("Plugin listener removed successfully in closeButtonPressed");
+                            CLR_LOG_INFO("Plugin listener removed successfully in closeButtonPressed");
                         } else {
-                            juce::Logger::writeToLog("Plugin appears to be invalid, skipping listener removal");
+                            CLR_LOG_WARNING("Plugin appears to be invalid, skipping listener removal");
                         }
                     } catch (const std::exception& e) {
-                        juce::Logger::writeToLog("Exception removing plugin listener: " + juce::String(e.what()));
+                        CLR_LOG_ERROR("Exception removing plugin listener: " + juce::String(e.what()));
         } catch (...) {
-                        juce::Logger::writeToLog("Unknown exception removing plugin listener");
+                        CLR_LOG_ERROR("Unknown exception removing plugin listener");
                     }
                 }
                 
@@ -3950,34 +3811,44 @@ public:
                 if (app->pluginEditor) {
                     try {
                         app->pluginEditor.reset();
-                        juce::Logger::writeToLog("Plugin editor reset successfully in closeButtonPressed");
+                        CLR_LOG_INFO("Plugin editor reset successfully in closeButtonPressed");
                     } catch (const std::exception& e) {
-                        juce::Logger::writeToLog("Exception resetting plugin editor: " + juce::String(e.what()));
+                        CLR_LOG_ERROR("Exception resetting plugin editor: " + juce::String(e.what()));
                     } catch (...) {
-                        juce::Logger::writeToLog("Unknown exception resetting plugin editor");
+                        CLR_LOG_ERROR("Unknown exception resetting plugin editor");
                     }
                 }
                 
                 // 4. 플러그인 해제 (마지막)
                 if (app->clearPlugin) {
                     try {
+                        app->parameterMap.clear(); // 해제될 파라미터 핸들을 먼저 비움
                         app->clearPlugin.reset();
-                        juce::Logger::writeToLog("Plugin reset successfully in closeButtonPressed");
+                        CLR_LOG_INFO("Plugin reset successfully in closeButtonPressed");
                     } catch (const std::exception& e) {
-                        juce::Logger::writeToLog("Exception resetting plugin: " + juce::String(e.what()));
+                        CLR_LOG_ERROR("Exception resetting plugin: " + juce::String(e.what()));
                     } catch (...) {
-                        juce::Logger::writeToLog("Unknown exception resetting plugin");
+                        CLR_LOG_ERROR("Unknown exception resetting plugin");
         }
                 }
             } catch (const std::exception& e) {
-                juce::Logger::writeToLog("Exception in closeButtonPressed cleanup: " + juce::String(e.what()));
+                CLR_LOG_ERROR("Exception in closeButtonPressed cleanup: " + juce::String(e.what()));
             } catch (...) {
-                juce::Logger::writeToLog("Unknown exception in closeButtonPressed cleanup");
+                CLR_LOG_ERROR("Unknown exception in closeButtonPressed cleanup");
             }
         }
         
         juce::JUCEApplication::getInstance()->systemRequestedQuit();
     }
+    
+    // 창을 옮길 때마다 위치 저장 (디스크 기록은 HostSettings가 모아서)
+    void moved() override {
+        juce::DocumentWindow::moved();
+        settings.setWindowState(getWindowStateAsString());
+    }
+    
+private:
+    HostSettings& settings;
 };
 
 class ClearHostApplication : public juce::JUCEApplication {
@@ -3985,13 +3856,58 @@ public:
     const juce::String getApplicationName() override { return "clr"; }
     const juce::String getApplicationVersion() override { return "1.0"; }
     void initialise(const juce::String&) override {
-        mainWindow.reset(new MainWindow(getApplicationName()));
+        // 가장 먼저 로거 설치 - 이후 모든 로그(JUCE 내부 writeToLog 포함)는 로그 스레드가 파일에 기록
+        logger = std::make_unique<AsyncLogger>();
+        juce::Logger::setCurrentLogger(logger.get());
+        CLR_LOG_INFO("Logging to: " + logger->getCurrentLogFile().getFullPathName());
+        
+        // --render: 창과 오디오 장치 없이 파일만 처리하고 종료
+        auto args = getCommandLineParameterArray();
+        if (OfflineRenderer::isRenderCommandLine(args)) {
+            startOfflineRender(args);
+            return;
+        }
+        
+        // 설정 파일은 여기서 한 번만 읽고 이후에는 메모리에서 사용
+        settings = std::make_unique<HostSettings>();
+        mainWindow.reset(new MainWindow(getApplicationName(), *settings));
     }
     void shutdown() override {
+        offlineRenderer = nullptr;
         mainWindow = nullptr;
+        
+        // 남은 설정 변경을 기록하고 저장 스레드 종료
+        settings = nullptr;
+        
+        // 오디오/작업 스레드가 모두 멈춘 뒤 해제 (남은 레코드는 소멸자에서 기록)
+        juce::Logger::setCurrentLogger(nullptr);
+        logger = nullptr;
     }
 private:
+    void startOfflineRender(const juce::StringArray& args) {
+        OfflineRenderer::Settings renderSettings;
+        juce::String error;
+        if (OfflineRenderer::parseCommandLine(args, renderSettings, error)) {
+            offlineRenderer = std::make_unique<OfflineRenderer>(renderSettings);
+            offlineRenderer->onFinished = [this](int exitCode) {
+                setApplicationReturnValue(exitCode);
+                quit();
+            };
+            if (offlineRenderer->start(error)) return;
+        }
+        
+        CLR_LOG_ERROR("Render failed: " + error);
+        for (const auto& line : juce::StringArray::fromLines(OfflineRenderer::getUsage())) {
+            CLR_LOG_INFO(line);
+        }
+        setApplicationReturnValue(2);
+        quit();
+    }
+    
+    std::unique_ptr<AsyncLogger> logger;
+    std::unique_ptr<HostSettings> settings;
     std::unique_ptr<MainWindow> mainWindow;
+    std::unique_ptr<OfflineRenderer> offlineRenderer;
 };
 
 START_JUCE_APPLICATION(ClearHostApplication)
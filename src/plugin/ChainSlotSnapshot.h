@@ -0,0 +1,13 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Clear 앞뒤 이펙트 체인에서 슬롯의 위치
+enum class ChainPosition { beforeClear, afterClear };
+
+// 프리셋에 저장하는 이펙트 체인 슬롯 상태 (PluginChain::Slot::capture가 만들고 PresetStore가 읽고 씀)
+struct ChainSlotSnapshot {
+    juce::PluginDescription description;
+    ChainPosition position = ChainPosition::afterClear;
+    bool bypassed = false;
+    juce::MemoryBlock state;
+};
@@ -0,0 +1,97 @@
+#include "ClearPluginLocator.h"
+#include "../app/AsyncLogger.h"
+
+namespace ClearPluginLocator {
+
+juce::Array<FallbackBundle> getDefaultFallbacks() {
+    return {
+        { juce::File("/Library/Audio/Plug-Ins/VST3").getChildFile("Clear.vst3"), "VST3" },
+        { juce::File("/Library/Audio/Plug-Ins/Components").getChildFile("Clear.component"), "AudioUnit" },
+    };
+}
+
+juce::Array<Candidate> findCandidates(PluginDescriptionCache& cache) {
+    return findCandidates(cache, getDefaultFallbacks());
+}
+
+juce::Array<Candidate> findCandidates(PluginDescriptionCache& cache, const juce::Array<FallbackBundle>& fallbacks) {
+    juce::Array<Candidate> candidates;
+    cache.load();
+
+    // 지난 실행에서 로드에 성공한 포맷이 있고 번들이 그대로면 그 설명을 가장 먼저 시도
+    juce::File cachedBundle;
+    juce::PluginDescription cachedDesc;
+    if (cache.findPreferred(cachedBundle, cachedDesc)) {
+        CLR_LOG_INFO("Using cached Clear " + cachedDesc.pluginFormatName + " description: " + cachedBundle.getFullPathName());
+        candidates.add(Candidate { cachedDesc, cachedBundle, true });
+    }
+
+    // 캐시가 없거나 캐시된 설명으로 실패했을 때만 쓰이는 수동 설명 (폴백)
+    for (const auto& fallback : fallbacks) {
+        if (fallback.bundle == cachedBundle) continue;
+        if (fallback.bundle.exists()) {
+            candidates.add(Candidate { makeDescription(fallback.bundle, fallback.formatName), fallback.bundle, false });
+        } else {
+            CLR_LOG_WARNING(fallback.bundle.getFileName() + " not found");
+        }
+    }
+
+    return candidates;
+}
+
+juce::PluginDescription makeDescription(const juce::File& bundle, const juce::String& formatName) {
+    juce::PluginDescription desc;
+    desc.fileOrIdentifier = bundle.getFullPathName();
+    desc.pluginFormatName = formatName;
+    desc.name = "Clear";
+    desc.descriptiveName = "Clear";
+    desc.manufacturerName = "Clear";
+    desc.category = "Effect";
+    desc.isInstrument = false;
+    return desc;
+}
+
+juce::AudioPluginFormat* findFormat(juce::AudioPluginFormatManager& formatManager, const juce::String& formatName) {
+    for (auto* format : formatManager.getFormats()) {
+        if (format != nullptr && format->getName() == formatName) {
+            return format;
+        }
+    }
+    return nullptr;
+}
+
+void recordCreationResult(PluginDescriptionCache& cache, const Candidate& candidate,
+                          juce::AudioPluginInstance* instance, const juce::String& errorMessage) {
+    if (instance != nullptr) {
+        // 검증된 설명과 파라미터 구성을 캐시 (다음 실행에서 이 포맷으로 바로 로드)
+        cache.store(candidate.bundle, instance->getPluginDescription(), *instance);
+        return;
+    }
+
+    CLR_LOG_ERROR("Failed to load Clear " + candidate.description.pluginFormatName + ": " + errorMessage);
+    if (candidate.fromCache) {
+        cache.invalidate(candidate.bundle);
+    }
+}
+
+std::unique_ptr<juce::AudioPluginInstance> createInstance(juce::AudioPluginFormatManager& formatManager,
+                                                          PluginDescriptionCache& cache,
+                                                          const juce::Array<Candidate>& candidates,
+                                                          double sampleRate, int blockSize,
+                                                          juce::String& errorMessage) {
+    for (auto& candidate : candidates) {
+        auto* format = findFormat(formatManager, candidate.description.pluginFormatName);
+        if (format == nullptr) {
+            errorMessage = candidate.description.pluginFormatName + " format not found";
+            CLR_LOG_WARNING(errorMessage);
+            continue;
+        }
+
+        auto instance = format->createInstanceFromDescription(candidate.description, sampleRate, blockSize, errorMessage);
+        recordCreationResult(cache, candidate, instance.get(), errorMessage);
+        if (instance != nullptr) return instance;
+    }
+    return nullptr;
+}
+
+}
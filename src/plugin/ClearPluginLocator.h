@@ -0,0 +1,43 @@
+#pragma once
+#include <JuceHeader.h>
+#include "PluginDescriptionCache.h"
+
+// Clear 플러그인 후보 탐색 (라이브 앱의 비동기 로드와 오프라인 렌더가 같은 순서와 캐시 정책을 사용)
+// 순서: 캐시된 설명(지난 실행에서 성공한 포맷) → Clear.vst3 → Clear.component
+// 캐시 정책: 생성에 성공한 후보는 저장, 캐시된 설명으로 실패하면 그 항목을 무효화 (recordCreationResult)
+namespace ClearPluginLocator {
+    struct Candidate {
+        juce::PluginDescription description;
+        juce::File bundle;
+        bool fromCache = false;
+    };
+
+    // 캐시가 없거나 실패했을 때 순서대로 시도할 번들과 포맷
+    struct FallbackBundle {
+        juce::File bundle;
+        juce::String formatName;
+    };
+
+    // /Library/Audio/Plug-Ins의 Clear.vst3 → Clear.component
+    juce::Array<FallbackBundle> getDefaultFallbacks();
+
+    juce::Array<Candidate> findCandidates(PluginDescriptionCache& cache);
+    juce::Array<Candidate> findCandidates(PluginDescriptionCache& cache, const juce::Array<FallbackBundle>& fallbacks);
+
+    juce::PluginDescription makeDescription(const juce::File& bundle, const juce::String& formatName);
+
+    // 포맷 이름 정확히 일치 ("VST3", "AudioUnit")
+    juce::AudioPluginFormat* findFormat(juce::AudioPluginFormatManager& formatManager, const juce::String& formatName);
+
+    // 후보 하나의 생성 결과를 캐시에 반영 (메시지 스레드)
+    // 비동기 생성(createPluginInstanceAsync) 완료 콜백은 이것만 부르고 다음 후보로 넘어가면 됨
+    void recordCreationResult(PluginDescriptionCache& cache, const Candidate& candidate,
+                              juce::AudioPluginInstance* instance, const juce::String& errorMessage);
+
+    // 후보를 순서대로 동기 생성하고 결과를 캐시에 반영 (메시지 스레드에서 호출). 모두 실패하면 nullptr과 마지막 오류
+    std::unique_ptr<juce::AudioPluginInstance> createInstance(juce::AudioPluginFormatManager& formatManager,
+                                                              PluginDescriptionCache& cache,
+                                                              const juce::Array<Candidate>& candidates,
+                                                              double sampleRate, int blockSize,
+                                                              juce::String& errorMessage);
+}
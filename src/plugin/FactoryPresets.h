@@ -0,0 +1,30 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+
+// Clear 기본 프리셋 (UI 프리셋 드롭다운과 오프라인 렌더 --preset이 같은 표를 사용)
+// 값은 플러그인 파라미터 범위(0~1) 기준
+struct FactoryPreset {
+    const char* name;
+    float ambience;
+    float voice;
+    float voiceReverb;
+    bool stereo;
+};
+
+inline constexpr std::array<FactoryPreset, 6> factoryPresets {{
+    { "s* up**",     0.5f, 0.0f, 0.0f, true  },
+    { "too loud",    0.5f, 0.2f, 0.2f, true  },
+    { "sommers",     0.5f, 1.0f, 0.0f, false },
+    { "clear voice", 0.0f, 0.5f, 0.5f, true  },
+    { "dry voice",   0.0f, 0.5f, 0.0f, true  },
+    { "cono",        0.5f, 0.1f, 0.1f, true  },
+}};
+
+// 이름으로 프리셋 찾기 (대소문자 무시). 없으면 nullptr
+inline const FactoryPreset* findFactoryPreset(const juce::String& name) {
+    for (auto& preset : factoryPresets) {
+        if (name.equalsIgnoreCase(preset.name)) return &preset;
+    }
+    return nullptr;
+}
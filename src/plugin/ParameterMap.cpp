@@ -0,0 +1,148 @@
+#include "ParameterMap.h"
+#include "../app/AsyncLogger.h"
+
+namespace {
+    struct RoleSpec {
+        const char* name;           // 로그용 이름
+        const char* ids[2];         // 파라미터 ID 후보 (HostedAudioProcessorParameter)
+        const char* names[2];       // 파라미터 이름 후보 (정확히 일치 → 포함 순으로 검색)
+        int legacyIndex;            // 이전 버전에서 사용하던 고정 인덱스 (마지막 폴백)
+        bool required;
+    };
+
+    const RoleSpec roleSpecs[ParameterMap::NUM_ROLES] = {
+        { "ambience",     { "ambience_gain", "ambienceGain" },        { "Ambience Gain", "Ambience" },         1,  true  },
+        { "voice",        { "voice_gain", "voiceGain" },              { "Voice Gain", "Voice" },               14, true  },
+        { "voice reverb", { "voice_reverb_gain", "voiceReverbGain" }, { "Voice Reverb Gain", "Voice Reverb" }, 12, true  },
+        { "stereo",       { "stereo", "stereo_mono" },                { "Stereo", "Mono" },                    13, false },
+        { "bypass",       { "bypass", "Bypass" },                     { "Bypass", "bypass" },                  -1, false },
+    };
+}
+
+bool ParameterMap::build(juce::AudioProcessor& processor) {
+    clear();
+
+    const auto& params = processor.getParameters();
+
+    for (int r = 0; r < NUM_ROLES; ++r) {
+        auto role = static_cast<Role>(r);
+        auto* param = findParameter(params, role);
+
+        // bypass 파라미터가 목록에 없으면 AudioProcessor 표준 bypass 사용
+        if (param == nullptr && role == Role::bypass) {
+            param = processor.getBypassParameter();
+        }
+
+        handles[(size_t)r] = param;
+        indices[(size_t)r] = param != nullptr ? param->getParameterIndex() : -1;
+    }
+
+    // 로드 시점 검증: 필수 역할 확인 및 매핑 결과 기록
+    valid = true;
+    for (int r = 0; r < NUM_ROLES; ++r) {
+        const auto& spec = roleSpecs[r];
+        if (handles[(size_t)r] != nullptr) {
+            CLR_LOG_DEBUG("ParameterMap: " + juce::String(spec.name) + " -> #" + juce::String(indices[(size_t)r])
+                          + " (" + handles[(size_t)r]->getName(100) + ")");
+        } else {
+            CLR_LOG_WARNING("ParameterMap: " + juce::String(spec.name) + " not found");
+            if (spec.required) valid = false;
+        }
+    }
+
+    if (!valid) {
+        CLR_LOG_WARNING("ParameterMap: required parameters missing - knobs may not control the plugin");
+    }
+    return valid;
+}
+
+void ParameterMap::clear() {
+    handles.fill(nullptr);
+    indices.fill(-1);
+    valid = false;
+}
+
+float ParameterMap::getValue(Role role, float fallback) const {
+    auto* param = get(role);
+    return param != nullptr ? param->getValue() : fallback;
+}
+
+bool ParameterMap::setValueNotifyingHost(Role role, float normalisedValue) {
+    auto* param = get(role);
+    if (param == nullptr) return false;
+    param->setValueNotifyingHost(juce::jlimit(0.0f, 1.0f, normalisedValue));
+    return true;
+}
+
+bool ParameterMap::setValue(Role role, float normalisedValue) noexcept {
+    auto* param = get(role);
+    if (param == nullptr) return false;
+    param->setValue(juce::jlimit(0.0f, 1.0f, normalisedValue));
+    return true;
+}
+
+ParameterMap::Role ParameterMap::roleForKnob(int knobIndex) noexcept {
+    switch (knobIndex) {
+        case 0: return Role::ambience;
+        case 1: return Role::voice;
+        case 2: return Role::voiceReverb;
+        default: return Role::numRoles;
+    }
+}
+
+int ParameterMap::knobIndexForParameterIndex(int parameterIndex) const noexcept {
+    if (parameterIndex < 0) return -1;
+    for (int knob = 0; knob < NUM_KNOBS; ++knob) {
+        if (indices[(size_t)roleForKnob(knob)] == parameterIndex) return knob;
+    }
+    return -1;
+}
+
+const char* ParameterMap::getRoleName(Role role) noexcept {
+    auto r = static_cast<int>(role);
+    return (r >= 0 && r < NUM_ROLES) ? roleSpecs[r].name : "unknown";
+}
+
+juce::AudioProcessorParameter* ParameterMap::findParameter(const juce::Array<juce::AudioProcessorParameter*>& params, Role role) const {
+    const auto& spec = roleSpecs[static_cast<int>(role)];
+
+    // 1. 파라미터 ID로 검색
+    for (auto* param : params) {
+        if (auto* hosted = dynamic_cast<juce::HostedAudioProcessorParameter*>(param)) {
+            for (auto* id : spec.ids) {
+                if (hosted->getParameterID() == id) return param;
+            }
+        }
+    }
+
+    // 2. 이름이 정확히 일치하는 파라미터
+    for (auto* candidate : spec.names) {
+        for (auto* param : params) {
+            if (param != nullptr && param->getName(100).equalsIgnoreCase(candidate)) return param;
+        }
+    }
+
+    // 3. 이름에 포함 (다른 역할의 이름과 겹치지 않는 경우만)
+    for (auto* param : params) {
+        if (param == nullptr) continue;
+        auto name = param->getName(100);
+        if (!name.containsIgnoreCase(spec.names[0])) continue;
+
+        bool claimedByOtherRole = false;
+        for (int other = 0; other < NUM_ROLES; ++other) {
+            if (other != static_cast<int>(role) && name.equalsIgnoreCase(roleSpecs[other].names[0])) {
+                claimedByOtherRole = true;
+                break;
+            }
+        }
+        if (!claimedByOtherRole) return param;
+    }
+
+    // 4. 이전 버전의 고정 인덱스 (이름을 찾지 못한 경우에만)
+    if (spec.legacyIndex >= 0 && spec.legacyIndex < params.size() && params[spec.legacyIndex] != nullptr) {
+        CLR_LOG_INFO("ParameterMap: " + juce::String(spec.name) + " resolved by legacy index "
+                     + juce::String(spec.legacyIndex));
+        return params[spec.legacyIndex];
+    }
+    return nullptr;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+
+// Clear 플러그인 파라미터 핸들 캐시
+// - loadClearVST3() 직후 한 번만 ID/이름으로 역할별 파라미터를 찾아둠
+// - 이후 UI/MIDI/오디오 스레드는 getParameters() 복사나 이름 검색 없이 O(1)로 접근
+// - Clear 업데이트로 파라미터 순서가 바뀌어도 이름 기준으로 다시 찾으므로 안전
+class ParameterMap {
+public:
+    enum class Role {
+        ambience = 0,   // Ambience Gain (노브 0 "amb")
+        voice,          // Voice Gain (노브 1 "vox")
+        voiceReverb,    // Voice Reverb Gain (노브 2 "v. rev")
+        stereo,         // Stereo/Mono 토글
+        bypass,         // MIDI CC 24 대상 (bypass 자체는 호스트 BypassCrossfader가 처리)
+        numRoles
+    };
+
+    static constexpr int NUM_KNOBS = 3;
+    static constexpr int NUM_ROLES = static_cast<int>(Role::numRoles);
+
+    // 역할별 파라미터 해석. 필수 역할(노브 3개)이 모두 있으면 true
+    bool build(juce::AudioProcessor& processor);
+    void clear();
+
+    bool isValid() const noexcept { return valid; }
+
+    juce::AudioProcessorParameter* get(Role role) const noexcept {
+        return handles[static_cast<size_t>(role)];
+    }
+
+    bool has(Role role) const noexcept { return get(role) != nullptr; }
+
+    // 파라미터가 없으면 fallback 반환
+    float getValue(Role role, float fallback = 0.0f) const;
+
+    // 메시지 스레드: 호스트/리스너에 알림
+    bool setValueNotifyingHost(Role role, float normalisedValue);
+
+    // 오디오 스레드: 알림 없이 값만 설정
+    bool setValue(Role role, float normalisedValue) noexcept;
+
+    // 노브 인덱스(0~2) ↔ 역할 / 플러그인 파라미터 인덱스 변환
+    static Role roleForKnob(int knobIndex) noexcept;
+    int knobIndexForParameterIndex(int parameterIndex) const noexcept;
+    int getParameterIndex(Role role) const noexcept { return indices[static_cast<size_t>(role)]; }
+
+    static const char* getRoleName(Role role) noexcept;
+
+private:
+    juce::AudioProcessorParameter* findParameter(const juce::Array<juce::AudioProcessorParameter*>& params, Role role) const;
+
+    std::array<juce::AudioProcessorParameter*, NUM_ROLES> handles {};
+    std::array<int, NUM_ROLES> indices {};
+    bool valid = false;
+};
@@ -0,0 +1,196 @@
+#include "PluginDescriptionCache.h"
+#include "../app/AsyncLogger.h"
+
+namespace {
+    constexpr int CACHE_VERSION = 1;
+}
+
+PluginDescriptionCache::PluginDescriptionCache()
+    : PluginDescriptionCache(getDefaultCacheFile()) {}
+
+PluginDescriptionCache::PluginDescriptionCache(const juce::File& cacheFileToUse)
+    : cacheFile(cacheFileToUse) {}
+
+juce::File PluginDescriptionCache::getDefaultCacheFile() {
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+           .getChildFile("ClearHost")
+           .getChildFile("plugin_cache.xml");
+}
+
+juce::int64 PluginDescriptionCache::getBundleModificationTime(const juce::File& bundle) {
+    // 디렉터리 자체의 수정 시간은 내용이 덮어써질 때 바뀌지 않을 수 있으므로 Info.plist 우선
+    auto infoPlist = bundle.getChildFile("Contents").getChildFile("Info.plist");
+    if (infoPlist.existsAsFile()) {
+        return infoPlist.getLastModificationTime().toMilliseconds();
+    }
+    return bundle.getLastModificationTime().toMilliseconds();
+}
+
+void PluginDescriptionCache::load() {
+    knownPlugins.clear();
+    entries.clear();
+    preferredPath.clear();
+
+    if (!cacheFile.existsAsFile()) return;
+
+    auto xml = juce::parseXML(cacheFile);
+    if (xml == nullptr || !xml->hasTagName("CLEARHOST_PLUGIN_CACHE")
+        || xml->getIntAttribute("version") != CACHE_VERSION) {
+        CLR_LOG_WARNING("Plugin cache ignored (missing or outdated format)");
+        return;
+    }
+
+    if (auto* known = xml->getChildByName("KNOWNPLUGINS")) {
+        knownPlugins.recreateFromXml(*known);
+    }
+
+    if (auto* bundles = xml->getChildByName("BUNDLES")) {
+        for (auto* e : bundles->getChildWithTagNameIterator("BUNDLE")) {
+            BundleEntry entry;
+            entry.path = e->getStringAttribute("path");
+            entry.identifier = e->getStringAttribute("identifier");
+            entry.modificationTime = e->getStringAttribute("modTime").getLargeIntValue();
+
+            for (auto* p : e->getChildWithTagNameIterator("PARAM")) {
+                entry.parameterLayout.add(p->getStringAttribute("key"));
+            }
+
+            if (entry.path.isNotEmpty() && entry.identifier.isNotEmpty()) {
+                entries.add(entry);
+            }
+        }
+    }
+
+    preferredPath = xml->getStringAttribute("preferred");
+}
+
+bool PluginDescriptionCache::findPreferred(juce::File& bundleOut, juce::PluginDescription& descriptionOut) {
+    if (preferredPath.isEmpty()) return false;
+
+    const juce::File bundle(preferredPath);
+    const int index = indexOfBundle(bundle);
+    if (index < 0) return false;
+
+    const auto& entry = entries.getReference(index);
+
+    if (!bundle.exists() || getBundleModificationTime(bundle) != entry.modificationTime) {
+        CLR_LOG_WARNING("Plugin cache invalidated (bundle changed): " + entry.path);
+        removeEntry(index);
+        save();
+        return false;
+    }
+
+    auto description = knownPlugins.getTypeForIdentifierString(entry.identifier);
+    if (description == nullptr) {
+        removeEntry(index);
+        save();
+        return false;
+    }
+
+    bundleOut = bundle;
+    descriptionOut = *description;
+    return true;
+}
+
+void PluginDescriptionCache::store(const juce::File& bundle, const juce::PluginDescription& description, juce::AudioProcessor& processor) {
+    BundleEntry entry;
+    entry.path = bundle.getFullPathName();
+    entry.identifier = description.createIdentifierString();
+    entry.modificationTime = getBundleModificationTime(bundle);
+    entry.parameterLayout = createParameterLayout(processor);
+
+    const int existing = indexOfBundle(bundle);
+    if (existing >= 0) {
+        if (entries.getReference(existing).parameterLayout != entry.parameterLayout) {
+            CLR_LOG_WARNING("Plugin parameter layout changed since last launch: " + entry.path);
+        }
+        removeEntry(existing);
+    }
+
+    auto cachedDescription = description;
+    cachedDescription.lastFileModTime = juce::Time(entry.modificationTime);
+    cachedDescription.lastInfoUpdateTime = juce::Time::getCurrentTime();
+    knownPlugins.addType(cachedDescription);
+
+    entries.add(entry);
+    preferredPath = entry.path;
+    save();
+}
+
+void PluginDescriptionCache::invalidate(const juce::File& bundle) {
+    const int index = indexOfBundle(bundle);
+    if (index < 0) return;
+
+    CLR_LOG_ERROR("Plugin cache entry removed after failed load: " + bundle.getFullPathName());
+    removeEntry(index);
+    save();
+}
+
+juce::StringArray PluginDescriptionCache::getParameterLayout(const juce::File& bundle) const {
+    const int index = indexOfBundle(bundle);
+    return index >= 0 ? entries.getReference(index).parameterLayout : juce::StringArray();
+}
+
+int PluginDescriptionCache::indexOfBundle(const juce::File& bundle) const {
+    const auto path = bundle.getFullPathName();
+    for (int i = 0; i < entries.size(); ++i) {
+        if (entries.getReference(i).path == path) return i;
+    }
+    return -1;
+}
+
+void PluginDescriptionCache::removeEntry(int index) {
+    const auto entry = entries.getReference(index);
+    entries.remove(index);
+
+    if (auto description = knownPlugins.getTypeForIdentifierString(entry.identifier)) {
+        knownPlugins.removeType(*description);
+    }
+    if (preferredPath == entry.path) {
+        preferredPath.clear();
+    }
+}
+
+void PluginDescriptionCache::save() const {
+    juce::XmlElement root("CLEARHOST_PLUGIN_CACHE");
+    root.setAttribute("version", CACHE_VERSION);
+    root.setAttribute("preferred", preferredPath);
+
+    if (auto known = knownPlugins.createXml()) {
+        root.addChildElement(known.release());
+    }
+
+    auto* bundles = root.createNewChildElement("BUNDLES");
+    for (const auto& entry : entries) {
+        auto* e = bundles->createNewChildElement("BUNDLE");
+        e->setAttribute("path", entry.path);
+        e->setAttribute("identifier", entry.identifier);
+        e->setAttribute("modTime", juce::String(entry.modificationTime));
+
+        for (int i = 0; i < entry.parameterLayout.size(); ++i) {
+            auto* p = e->createNewChildElement("PARAM");
+            p->setAttribute("index", i);
+            p->setAttribute("key", entry.parameterLayout[i]);
+        }
+    }
+
+    cacheFile.getParentDirectory().createDirectory();
+    if (!root.writeTo(cacheFile)) {
+        CLR_LOG_ERROR("Failed to write plugin cache: " + cacheFile.getFullPathName());
+    }
+}
+
+juce::StringArray PluginDescriptionCache::createParameterLayout(juce::AudioProcessor& processor) {
+    juce::StringArray layout;
+    for (auto* param : processor.getParameters()) {
+        juce::String key;
+        if (auto* hosted = dynamic_cast<juce::HostedAudioProcessorParameter*>(param)) {
+            key = hosted->getParameterID();
+        }
+        if (key.isEmpty()) {
+            key = param->getName(128);
+        }
+        layout.add(key);
+    }
+    return layout;
+}
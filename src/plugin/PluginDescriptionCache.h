@@ -0,0 +1,51 @@
+#pragma once
+#include <JuceHeader.h>
+
+// 검증된 Clear 플러그인 설명 캐시 (앱 데이터 폴더의 plugin_cache.xml)
+// - 로드에 성공한 PluginDescription을 KnownPluginList에 보관하고 번들 경로/수정 시간/파라미터 구성을 함께 기록
+// - 다음 실행에서는 마지막으로 성공한 포맷의 설명으로 바로 생성 (VST3 → AU 탐색 생략)
+// - 번들 수정 시간이 달라지면(업데이트/재설치) 해당 항목은 무효화
+class PluginDescriptionCache {
+public:
+    PluginDescriptionCache();
+    explicit PluginDescriptionCache(const juce::File& cacheFileToUse);
+
+    // settings.xml과 같은 폴더
+    static juce::File getDefaultCacheFile();
+
+    // 번들 변경 감지용 수정 시간 (번들이면 Contents/Info.plist 기준)
+    static juce::int64 getBundleModificationTime(const juce::File& bundle);
+
+    void load();
+
+    // 마지막으로 로드에 성공한 번들과 설명. 번들이 바뀌었으면 항목을 지우고 false
+    bool findPreferred(juce::File& bundleOut, juce::PluginDescription& descriptionOut);
+
+    // 로드 성공 시 호출: 설명, 수정 시간, 파라미터 구성을 기록하고 저장
+    void store(const juce::File& bundle, const juce::PluginDescription& description, juce::AudioProcessor& processor);
+
+    // 캐시된 설명으로 로드가 실패했을 때 호출
+    void invalidate(const juce::File& bundle);
+
+    // 마지막으로 기록된 파라미터 구성 ("ID 또는 이름" 목록, 인덱스 순)
+    juce::StringArray getParameterLayout(const juce::File& bundle) const;
+
+private:
+    struct BundleEntry {
+        juce::String path;
+        juce::String identifier;    // PluginDescription::createIdentifierString()
+        juce::int64 modificationTime = 0;
+        juce::StringArray parameterLayout;
+    };
+
+    int indexOfBundle(const juce::File& bundle) const;
+    void removeEntry(int index);
+    void save() const;
+
+    static juce::StringArray createParameterLayout(juce::AudioProcessor& processor);
+
+    juce::File cacheFile;
+    juce::KnownPluginList knownPlugins;
+    juce::Array<BundleEntry> entries;
+    juce::String preferredPath;
+};
@@ -0,0 +1,203 @@
+#include "PresetStore.h"
+#include "FactoryPresets.h"
+#include "../app/AsyncLogger.h"
+#include <algorithm>
+
+PresetStore::PresetStore(const juce::File& folderToUse)
+    : folder(folderToUse) {}
+
+juce::File PresetStore::getDefaultFolder() {
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+           .getChildFile("ClearHost")
+           .getChildFile("Presets");
+}
+
+void PresetStore::loadAll() {
+    presets.clear();
+
+    for (const auto& factoryPreset : factoryPresets) {
+        PresetSnapshot preset;
+        preset.name = factoryPreset.name;
+        preset.factory = true;
+        preset.knobs = { factoryPreset.ambience, factoryPreset.voice, factoryPreset.voiceReverb };
+        preset.stereo = factoryPreset.stereo;
+        presets.push_back(std::move(preset));
+    }
+
+    std::vector<PresetSnapshot> userPresets;
+    for (const auto& file : folder.findChildFiles(juce::File::findFiles, false, "*.clrpreset")) {
+        PresetSnapshot preset;
+        auto xml = juce::XmlDocument::parse(file);
+        if (xml == nullptr || !fromXml(*xml, preset) || isFactoryName(preset.name)) {
+            CLR_LOG_WARNING("Ignoring invalid preset file: " + file.getFullPathName());
+            continue;
+        }
+        userPresets.push_back(std::move(preset));
+    }
+
+    std::sort(userPresets.begin(), userPresets.end(), [](const PresetSnapshot& a, const PresetSnapshot& b) {
+        return a.name.compareNatural(b.name) < 0;
+    });
+    for (auto& preset : userPresets) presets.push_back(std::move(preset));
+
+    CLR_LOG_INFO("Loaded " + juce::String((int)factoryPresets.size()) + " factory and "
+                 + juce::String((int)userPresets.size()) + " user presets");
+}
+
+const PresetSnapshot* PresetStore::find(const juce::String& name) const {
+    for (const auto& preset : presets) {
+        if (preset.name.equalsIgnoreCase(name)) return &preset;
+    }
+    return nullptr;
+}
+
+bool PresetStore::isFactoryName(const juce::String& name) const {
+    return findFactoryPreset(name) != nullptr;
+}
+
+bool PresetStore::save(const PresetSnapshot& preset) {
+    if (preset.name.trim().isEmpty() || isFactoryName(preset.name)) return false;
+
+    auto xml = toXml(preset);
+    const auto file = getFileFor(preset.name);
+    if (!folder.createDirectory() || !xml->writeTo(file)) {
+        CLR_LOG_ERROR("Failed to save preset: " + file.getFullPathName());
+        return false;
+    }
+
+    // 메모리 목록 갱신 (같은 이름은 교체, 새 이름은 사용자 프리셋 사이에 이름순으로)
+    auto stored = preset;
+    stored.factory = false;
+    auto existing = std::find_if(presets.begin(), presets.end(), [&](const PresetSnapshot& p) {
+        return !p.factory && p.name.equalsIgnoreCase(preset.name);
+    });
+    if (existing != presets.end()) {
+        *existing = std::move(stored);
+    } else {
+        auto position = std::find_if(presets.begin(), presets.end(), [&](const PresetSnapshot& p) {
+            return !p.factory && p.name.compareNatural(preset.name) > 0;
+        });
+        presets.insert(position, std::move(stored));
+    }
+
+    CLR_LOG_INFO("Preset saved: " + file.getFullPathName());
+    return true;
+}
+
+bool PresetStore::remove(const juce::String& name) {
+    auto existing = std::find_if(presets.begin(), presets.end(), [&](const PresetSnapshot& p) {
+        return !p.factory && p.name.equalsIgnoreCase(name);
+    });
+    if (existing == presets.end()) return false;
+
+    const auto file = getFileFor(existing->name);
+    if (file.existsAsFile() && !file.deleteFile()) {
+        CLR_LOG_ERROR("Failed to delete preset: " + file.getFullPathName());
+        return false;
+    }
+
+    presets.erase(existing);
+    CLR_LOG_INFO("Preset deleted: " + name);
+    return true;
+}
+
+PresetSnapshot PresetStore::capture(const juce::String& name, juce::AudioPluginInstance& plugin, const ParameterMap& parameterMap) {
+    PresetSnapshot preset;
+    preset.name = name.trim();
+    for (int i = 0; i < ParameterMap::NUM_KNOBS; ++i) {
+        preset.knobs[(size_t)i] = parameterMap.getValue(ParameterMap::roleForKnob(i));
+    }
+    preset.stereo = parameterMap.getValue(ParameterMap::Role::stereo, 1.0f) >= 0.5f;
+    preset.pluginFormat = plugin.getPluginDescription().pluginFormatName;
+    plugin.getStateInformation(preset.pluginState);
+    return preset;
+}
+
+bool PresetStore::apply(const PresetSnapshot& preset, juce::AudioPluginInstance& plugin, ParameterMap& parameterMap) {
+    const bool fullState = preset.hasPluginState()
+                        && preset.pluginFormat == plugin.getPluginDescription().pluginFormatName;
+
+    if (fullState) {
+        plugin.setStateInformation(preset.pluginState.getData(), (int)preset.pluginState.getSize());
+    }
+
+    // stereo는 호스트 설정이므로 상태 블롭과 관계없이 항상 맞춤
+    parameterMap.setValueNotifyingHost(ParameterMap::Role::stereo, preset.stereo ? 1.0f : 0.0f);
+    return fullState;
+}
+
+juce::File PresetStore::getFileFor(const juce::String& name) const {
+    return folder.getChildFile(juce::File::createLegalFileName(name.trim()) + ".clrpreset");
+}
+
+std::unique_ptr<juce::XmlElement> PresetStore::toXml(const PresetSnapshot& preset) {
+    auto xml = std::make_unique<juce::XmlElement>("ClearHostPreset");
+    xml->setAttribute("version", FORMAT_VERSION);
+    xml->setAttribute("name", preset.name);
+    xml->setAttribute("ambience", (double)preset.knobs[0]);
+    xml->setAttribute("voice", (double)preset.knobs[1]);
+    xml->setAttribute("voiceReverb", (double)preset.knobs[2]);
+    xml->setAttribute("stereo", preset.stereo);
+    xml->setAttribute("bypass", preset.bypass);
+    xml->setAttribute("inputDevice", preset.inputDevice);
+    xml->setAttribute("outputDevice", preset.outputDevice);
+
+    if (preset.hasPluginState()) {
+        auto* state = xml->createNewChildElement("PluginState");
+        state->setAttribute("format", preset.pluginFormat);
+        state->addTextElement(preset.pluginState.toBase64Encoding());
+    }
+
+    if (preset.hasChain) {
+        auto* chain = xml->createNewChildElement("Chain");
+        for (const auto& slot : preset.chain) {
+            auto* slotXml = chain->createNewChildElement("Slot");
+            slotXml->setAttribute("position", slot.position == ChainPosition::beforeClear ? "before" : "after");
+            slotXml->setAttribute("bypass", slot.bypassed);
+            slotXml->addChildElement(slot.description.createXml().release());
+            if (slot.state.getSize() > 0) {
+                slotXml->createNewChildElement("State")->addTextElement(slot.state.toBase64Encoding());
+            }
+        }
+    }
+    return xml;
+}
+
+bool PresetStore::fromXml(const juce::XmlElement& xml, PresetSnapshot& preset) {
+    if (!xml.hasTagName("ClearHostPreset") || xml.getIntAttribute("version") > FORMAT_VERSION) return false;
+
+    preset.name = xml.getStringAttribute("name").trim();
+    if (preset.name.isEmpty()) return false;
+
+    preset.knobs = { (float)xml.getDoubleAttribute("ambience"),
+                     (float)xml.getDoubleAttribute("voice"),
+                     (float)xml.getDoubleAttribute("voiceReverb") };
+    for (auto& value : preset.knobs) value = juce::jlimit(0.0f, 1.0f, value);
+    preset.stereo = xml.getBoolAttribute("stereo", true);
+    preset.bypass = xml.getBoolAttribute("bypass", false);
+    preset.inputDevice = xml.getStringAttribute("inputDevice");
+    preset.outputDevice = xml.getStringAttribute("outputDevice");
+
+    if (auto* state = xml.getChildByName("PluginState")) {
+        preset.pluginFormat = state->getStringAttribute("format");
+        if (!preset.pluginState.fromBase64Encoding(state->getAllSubText().trim())) return false;
+    }
+
+    if (auto* chain = xml.getChildByName("Chain")) {
+        preset.hasChain = true;
+        for (auto* slotXml : chain->getChildWithTagNameIterator("Slot")) {
+            ChainSlotSnapshot slot;
+            auto* description = slotXml->getChildByName("PLUGIN");
+            if (description == nullptr || !slot.description.loadFromXml(*description)) return false;
+
+            slot.position = slotXml->getStringAttribute("position") == "before" ? ChainPosition::beforeClear
+                                                                                : ChainPosition::afterClear;
+            slot.bypassed = slotXml->getBoolAttribute("bypass", false);
+            if (auto* state = slotXml->getChildByName("State")) {
+                if (!slot.state.fromBase64Encoding(state->getAllSubText().trim())) return false;
+            }
+            preset.chain.push_back(std::move(slot));
+        }
+    }
+    return true;
+}
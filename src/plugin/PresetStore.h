@@ -0,0 +1,66 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <vector>
+#include "ParameterMap.h"
+#include "ChainSlotSnapshot.h"
+
+// 프리셋 한 개의 전체 스냅샷
+// - pluginState: 플러그인 getStateInformation() 전체 (비어 있으면 노브/stereo 값만으로 적용 - 기본 프리셋)
+// - 호스트 설정: stereo, bypass, 입출력 장치 (장치 이름이 비어 있으면 현재 라우팅 유지)
+// - chain: Clear 앞뒤 이펙트 슬롯 구성과 각 플러그인 상태 (hasChain이 false면 불러올 때 현재 체인 유지)
+struct PresetSnapshot {
+    juce::String name;
+    bool factory = false;
+    std::array<float, ParameterMap::NUM_KNOBS> knobs {};  // 0~1 (amb, vox, v. rev)
+    bool stereo = true;
+    bool bypass = false;
+    juce::String inputDevice;
+    juce::String outputDevice;
+    juce::String pluginFormat;      // 상태를 저장한 포맷 (VST3/AudioUnit) - 다른 포맷에는 상태 대신 노브 값 적용
+    juce::MemoryBlock pluginState;
+    bool hasChain = false;
+    std::vector<ChainSlotSnapshot> chain;
+
+    bool hasPluginState() const noexcept { return pluginState.getSize() > 0; }
+};
+
+// 기본 프리셋 + 사용자 프리셋 저장소
+// - 시작 시 디스크의 사용자 프리셋을 모두 메모리로 읽어둠 → 불러오기는 파일 I/O 없이 메모리에서 바로 적용
+// - 사용자 프리셋은 프리셋 하나당 파일 하나 (<appdata>/ClearHost/Presets/<이름>.clrpreset, XML)
+// - 기본 프리셋 이름으로는 저장/삭제할 수 없음
+// - 메시지 스레드 전용
+class PresetStore {
+public:
+    explicit PresetStore(const juce::File& folder = getDefaultFolder());
+
+    static juce::File getDefaultFolder();
+
+    // 기본 프리셋을 채우고 사용자 프리셋 파일을 모두 다시 읽음
+    void loadAll();
+
+    const std::vector<PresetSnapshot>& getPresets() const noexcept { return presets; }
+    const PresetSnapshot* find(const juce::String& name) const;
+    bool isFactoryName(const juce::String& name) const;
+
+    // 사용자 프리셋 저장 (같은 이름이면 덮어씀) / 삭제
+    bool save(const PresetSnapshot& preset);
+    bool remove(const juce::String& name);
+
+    // 현재 플러그인 상태를 스냅샷으로 (호스트 설정은 호출자가 채움)
+    static PresetSnapshot capture(const juce::String& name, juce::AudioPluginInstance& plugin, const ParameterMap& parameterMap);
+
+    // 플러그인에 상태 적용 - 같은 포맷으로 저장한 전체 상태가 있으면 setStateInformation, stereo는 항상
+    // 반환값: 전체 상태로 적용했으면 true (false면 노브 값은 호출자가 램프로 적용)
+    static bool apply(const PresetSnapshot& preset, juce::AudioPluginInstance& plugin, ParameterMap& parameterMap);
+
+private:
+    static constexpr int FORMAT_VERSION = 1;
+
+    juce::File getFileFor(const juce::String& name) const;
+    static std::unique_ptr<juce::XmlElement> toXml(const PresetSnapshot& preset);
+    static bool fromXml(const juce::XmlElement& xml, PresetSnapshot& preset);
+
+    juce::File folder;
+    std::vector<PresetSnapshot> presets;    // 기본 프리셋 먼저, 이어서 사용자 프리셋 (이름순)
+};
@@ -0,0 +1,391 @@
+#include "OfflineRenderer.h"
+#include "../app/AsyncLogger.h"
+#include "../audio/RecordingEncoder.h"
+#include "../plugin/ClearPluginLocator.h"
+#include "../plugin/FactoryPresets.h"
+#include "../plugin/ParameterMap.h"
+#include "../plugin/PluginDescriptionCache.h"
+
+//==============================================================================
+// 워커 스레드 하나 = 플러그인 인스턴스 하나. 작업 목록에서 파일을 하나씩 가져와 처리
+class OfflineRenderer::Worker : public juce::Thread {
+public:
+    Worker(OfflineRenderer& ownerToUse, std::unique_ptr<juce::AudioPluginInstance> instance, int index)
+        : juce::Thread("ClearHost Render " + juce::String(index)), owner(ownerToUse), plugin(std::move(instance)) {
+        formats.registerBasicFormats();
+        parameterMap.build(*plugin);
+    }
+
+    ~Worker() override {
+        stopThread(10000);
+    }
+
+    // 메시지 스레드에서 부름 (워커는 이미 멈춘 상태)
+    void releasePluginResources() {
+        if (prepared) plugin->releaseResources();
+        prepared = false;
+    }
+
+    bool isFinished() const noexcept { return finished.load(std::memory_order_acquire); }
+
+private:
+    void run() override {
+        while (!threadShouldExit()) {
+            auto* job = owner.takeNextJob();
+            if (job == nullptr) break;
+            owner.jobFinished(renderFile(*job));
+        }
+        finished.store(true, std::memory_order_release);
+    }
+
+    // VST3/AU는 prepareToPlay/reset/파라미터 변경/releaseResources를 메시지 스레드에서 부르는 것을 전제로 함
+    // → processBlock만 워커에서 돌리고 나머지는 메시지 스레드에 넘긴 뒤 끝날 때까지 대기
+    // 종료 중이라 메시지 스레드가 응답하지 않으면(소멸자가 이 스레드를 기다리는 중) 포기하고 false
+    bool callOnMessageThread(std::function<void()> function) {
+        struct Call {
+            juce::CriticalSection lock;
+            std::function<void()> function;
+            juce::WaitableEvent done;
+            bool abandoned = false;
+        };
+
+        auto call = std::make_shared<Call>();
+        call->function = std::move(function);
+
+        juce::MessageManager::callAsync([call] {
+            const juce::ScopedLock sl(call->lock);
+            if (call->abandoned) return;
+            call->function();
+            call->done.signal();
+        });
+
+        while (!call->done.wait(MESSAGE_THREAD_POLL_MS)) {
+            if (threadShouldExit()) {
+                const juce::ScopedLock sl(call->lock);
+                // 그 사이 실행을 마쳤으면 결과를 그대로 사용
+                if (call->done.wait(0)) return true;
+                call->abandoned = true;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void applySettings() {
+        const auto& s = owner.settings;
+        if (s.ambience) parameterMap.setValue(ParameterMap::Role::ambience, *s.ambience);
+        if (s.voice) parameterMap.setValue(ParameterMap::Role::voice, *s.voice);
+        if (s.voiceReverb) parameterMap.setValue(ParameterMap::Role::voiceReverb, *s.voiceReverb);
+        if (s.stereo) parameterMap.setValue(ParameterMap::Role::stereo, *s.stereo ? 1.0f : 0.0f);
+    }
+
+    bool renderFile(const Job& job) {
+        const double fileStartMs = juce::Time::getMillisecondCounterHiRes();
+
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(job.input));
+        if (reader == nullptr || reader->sampleRate <= 0.0) {
+            CLR_LOG_ERROR("Render: cannot read " + job.input.getFullPathName());
+            return false;
+        }
+
+        const int blockSize = owner.settings.blockSize;
+        const int numOutputChannels = juce::jmax(1, plugin->getTotalNumOutputChannels());
+        const int numBufferChannels = juce::jmax(numOutputChannels, plugin->getTotalNumInputChannels(), 2);
+
+        // 원본 비트 깊이를 따르고, 그 외(8비트, FLAC 등)는 24비트로 기록
+        auto sampleFormat = WavRecordingEncoder::SampleFormat::int24;
+        if (reader->bitsPerSample == 16) sampleFormat = WavRecordingEncoder::SampleFormat::int16;
+        if (reader->bitsPerSample == 32) sampleFormat = WavRecordingEncoder::SampleFormat::float32;
+
+        // 녹음과 같은 WAV 인코더 (SIMD 변환 커널, 4 GB 초과 시 RF64)
+        WavRecordingEncoder encoder(sampleFormat, false);
+        if (!encoder.open(job.output, reader->sampleRate, numOutputChannels, blockSize)) {
+            CLR_LOG_ERROR("Render: cannot write " + job.output.getFullPathName());
+            return false;
+        }
+
+        // 파일마다 샘플레이트가 다를 수 있으므로 매번 준비 (이전 파일의 잔향도 여기서 초기화)
+        const double sampleRate = reader->sampleRate;
+        int latencySamples = 0;
+        const bool preparedOnMessageThread = callOnMessageThread([this, sampleRate, blockSize, &latencySamples] {
+            plugin->setNonRealtime(true);
+            plugin->prepareToPlay(sampleRate, blockSize);
+            plugin->reset();
+            applySettings();
+            latencySamples = plugin->getLatencySamples();
+            prepared = true;
+        });
+        if (!preparedOnMessageThread) {
+            encoder.finish();
+            job.output.deleteFile();
+            return false;
+        }
+
+        // 플러그인 지연만큼 출력 앞부분을 버리고 입력 끝에 무음을 더 넣어 원본과 길이/위치를 맞춤
+        const juce::int64 totalSamples = reader->lengthInSamples;
+        juce::int64 samplesToSkip = latencySamples;
+        juce::int64 readPosition = 0;
+        juce::int64 written = 0;
+
+        juce::AudioBuffer<float> buffer(numBufferChannels, blockSize);
+        juce::MidiBuffer midi;
+        bool ok = true;
+
+        while (written < totalSamples) {
+            if (threadShouldExit()) {
+                ok = false;
+                break;
+            }
+
+            buffer.clear();
+            const int numToRead = (int)juce::jlimit<juce::int64>(0, blockSize, totalSamples - readPosition);
+            if (numToRead > 0) {
+                // 모노 파일은 양쪽 채널로 복제됨
+                reader->read(&buffer, 0, numToRead, readPosition, true, true);
+                readPosition += numToRead;
+            }
+
+            midi.clear();
+            plugin->processBlock(buffer, midi);
+
+            const int skip = (int)juce::jmin<juce::int64>(samplesToSkip, blockSize);
+            samplesToSkip -= skip;
+
+            const int numToWrite = (int)juce::jmin<juce::int64>(blockSize - skip, totalSamples - written);
+            if (numToWrite > 0) {
+                // 지연 보상으로 건너뛴 위치부터 출력 채널만 가리키는 뷰 (할당 없음)
+                const juce::AudioBuffer<float> output(buffer.getArrayOfWritePointers(), numOutputChannels, skip, numToWrite);
+                if (!encoder.write(output, numToWrite)) {
+                    CLR_LOG_ERROR("Render: write failed for " + job.output.getFullPathName());
+                    ok = false;
+                    break;
+                }
+                written += numToWrite;
+            }
+        }
+
+        // 종료 중이면 해제는 소멸 직전의 releasePluginResources()가 맡음
+        callOnMessageThread([this] { releasePluginResources(); });
+        encoder.finish();
+
+        if (!ok) {
+            job.output.deleteFile();
+            return false;
+        }
+
+        const double elapsedMs = juce::Time::getMillisecondCounterHiRes() - fileStartMs;
+        const double audioMs = 1000.0 * (double)totalSamples / reader->sampleRate;
+        CLR_LOG_INFO("Rendered " + job.input.getFileName() + " -> " + job.output.getFullPathName()
+                     + " (" + juce::String(audioMs / 1000.0, 1) + " s audio in "
+                     + juce::String(elapsedMs / 1000.0, 2) + " s, "
+                     + juce::String(elapsedMs > 0.0 ? audioMs / elapsedMs : 0.0, 1) + "x realtime)");
+        return true;
+    }
+
+    OfflineRenderer& owner;
+    std::unique_ptr<juce::AudioPluginInstance> plugin;
+    juce::AudioFormatManager formats;
+    ParameterMap parameterMap;
+    bool prepared = false;     // prepareToPlay 이후 releaseResources 전 (메시지 스레드에서만 바뀜)
+    std::atomic<bool> finished { false };
+
+    static constexpr int MESSAGE_THREAD_POLL_MS = 50;
+};
+
+//==============================================================================
+bool OfflineRenderer::isRenderCommandLine(const juce::StringArray& args) {
+    return args.contains("--render");
+}
+
+juce::String OfflineRenderer::getUsage() {
+    juce::String presetNames;
+    for (const auto& preset : factoryPresets) {
+        presetNames << (presetNames.isEmpty() ? "" : ", ") << "\"" << preset.name << "\"";
+    }
+
+    return "Usage: clr --render <input> <output> [options]\n"
+           "  <input>/<output>   audio files, or folders for batch rendering\n"
+           "  --preset <name>    factory preset (" + presetNames + ")\n"
+           "  --ambience <0..1>  Ambience Gain\n"
+           "  --voice <0..1>     Voice Gain\n"
+           "  --reverb <0..1>    Voice Reverb Gain\n"
+           "  --jobs <n>         worker threads (default: number of CPUs)";
+}
+
+bool OfflineRenderer::parseCommandLine(const juce::StringArray& args, Settings& settings, juce::String& error) {
+    const int renderIndex = args.indexOf("--render");
+    if (renderIndex < 0 || renderIndex + 2 >= args.size()) {
+        error = "--render needs an input and an output path";
+        return false;
+    }
+
+    const auto cwd = juce::File::getCurrentWorkingDirectory();
+    settings.input = cwd.getChildFile(args[renderIndex + 1].unquoted());
+    settings.output = cwd.getChildFile(args[renderIndex + 2].unquoted());
+
+    auto valueOf = [&args](const juce::String& option) -> juce::String {
+        const int index = args.indexOf(option);
+        return (index >= 0 && index + 1 < args.size()) ? args[index + 1].unquoted() : juce::String();
+    };
+
+    auto parseLevel = [&](const juce::String& option, std::optional<float>& target) {
+        if (!args.contains(option)) return true;
+        const auto text = valueOf(option);
+        if (!text.containsOnly("0123456789.") || !text.containsAnyOf("0123456789")) {
+            error = option + " expects a value between 0 and 1";
+            return false;
+        }
+        target = juce::jlimit(0.0f, 1.0f, text.getFloatValue());
+        return true;
+    };
+
+    if (args.contains("--preset")) {
+        const auto name = valueOf("--preset");
+        auto* preset = findFactoryPreset(name);
+        if (preset == nullptr) {
+            error = "Unknown preset: " + name;
+            return false;
+        }
+        settings.ambience = preset->ambience;
+        settings.voice = preset->voice;
+        settings.voiceReverb = preset->voiceReverb;
+        settings.stereo = preset->stereo;
+    }
+
+    if (!parseLevel("--ambience", settings.ambience)
+        || !parseLevel("--voice", settings.voice)
+        || !parseLevel("--reverb", settings.voiceReverb)) {
+        return false;
+    }
+
+    if (args.contains("--jobs")) {
+        settings.numJobs = valueOf("--jobs").getIntValue();
+        if (settings.numJobs <= 0) {
+            error = "--jobs expects a positive number";
+            return false;
+        }
+    }
+
+    if (!settings.input.exists()) {
+        error = "Input not found: " + settings.input.getFullPathName();
+        return false;
+    }
+    return true;
+}
+
+//==============================================================================
+OfflineRenderer::OfflineRenderer(const Settings& settingsToUse) : settings(settingsToUse) {
+    pluginFormats.addDefaultFormats();
+}
+
+OfflineRenderer::~OfflineRenderer() {
+    stopTimer();
+    for (auto& worker : workers) {
+        worker->signalThreadShouldExit();
+    }
+    // 워커가 멈춘 뒤 메시지 스레드에서 리소스와 인스턴스 해제
+    for (auto& worker : workers) {
+        worker->stopThread(10000);
+        worker->releasePluginResources();
+    }
+    workers.clear();
+}
+
+bool OfflineRenderer::collectJobs(juce::String& error) {
+    jobs.clear();
+
+    if (settings.input.isDirectory()) {
+        if (settings.output.existsAsFile()) {
+            error = "Output must be a folder when input is a folder";
+            return false;
+        }
+        if (settings.output == settings.input) {
+            error = "Output folder must differ from the input folder";
+            return false;
+        }
+        settings.output.createDirectory();
+
+        auto files = settings.input.findChildFiles(juce::File::findFiles, false, "*.wav;*.aif;*.aiff;*.flac");
+        files.sort();
+        for (auto& file : files) {
+            jobs.add(Job { file, settings.output.getChildFile(file.getFileNameWithoutExtension() + ".wav") });
+        }
+    } else {
+        auto output = settings.output.isDirectory() ? settings.output.getChildFile(settings.input.getFileNameWithoutExtension() + ".wav")
+                                                    : settings.output;
+        if (output == settings.input) {
+            error = "Output must differ from the input file";
+            return false;
+        }
+        output.getParentDirectory().createDirectory();
+        jobs.add(Job { settings.input, output });
+    }
+
+    if (jobs.isEmpty()) {
+        error = "No audio files found in " + settings.input.getFullPathName();
+        return false;
+    }
+    return true;
+}
+
+bool OfflineRenderer::start(juce::String& error) {
+    startMs = juce::Time::getMillisecondCounterHiRes();
+
+    if (!collectJobs(error)) return false;
+
+    const int requestedJobs = settings.numJobs > 0 ? settings.numJobs : juce::SystemStats::getNumCpus();
+    const int numWorkers = juce::jlimit(1, jobs.size(), requestedJobs);
+
+    // VST3/AU 인스턴스 생성은 메시지 스레드에서만 가능하므로 워커 시작 전에 모두 만들어 둠
+    PluginDescriptionCache cache;
+    const auto candidates = ClearPluginLocator::findCandidates(cache);
+
+    for (int i = 0; i < numWorkers; ++i) {
+        juce::String loadError;
+        auto instance = ClearPluginLocator::createInstance(pluginFormats, cache, candidates, 44100.0, settings.blockSize, loadError);
+        if (instance == nullptr) {
+            if (workers.empty()) {
+                error = "Clear plugin could not be loaded" + (loadError.isNotEmpty() ? ": " + loadError : juce::String());
+                return false;
+            }
+            // 일부만 생성되면 있는 인스턴스로 진행
+            CLR_LOG_WARNING("Render: only " + juce::String((int)workers.size()) + " plugin instances available");
+            break;
+        }
+        workers.push_back(std::make_unique<Worker>(*this, std::move(instance), i));
+    }
+
+    CLR_LOG_INFO("Rendering " + juce::String(jobs.size()) + " file(s) with "
+                 + juce::String((int)workers.size()) + " worker(s)");
+
+    for (auto& worker : workers) {
+        worker->startThread();
+    }
+    startTimer(COMPLETION_POLL_MS);
+    return true;
+}
+
+const OfflineRenderer::Job* OfflineRenderer::takeNextJob() noexcept {
+    const int index = nextJob.fetch_add(1);
+    return index < jobs.size() ? &jobs.getReference(index) : nullptr;
+}
+
+void OfflineRenderer::jobFinished(bool succeeded) noexcept {
+    (succeeded ? succeededJobs : failedJobs).fetch_add(1);
+}
+
+void OfflineRenderer::timerCallback() {
+    for (auto& worker : workers) {
+        if (!worker->isFinished()) return;
+    }
+    stopTimer();
+
+    const int failed = failedJobs.load();
+    CLR_LOG_INFO("Render finished: " + juce::String(succeededJobs.load()) + " succeeded, "
+                 + juce::String(failed) + " failed in "
+                 + juce::String((juce::Time::getMillisecondCounterHiRes() - startMs) / 1000.0, 2) + " s");
+
+    if (onFinished != nullptr) {
+        onFinished(failed == 0 ? 0 : 1);
+    }
+}
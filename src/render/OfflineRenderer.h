@@ -0,0 +1,69 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <functional>
+#include <optional>
+
+// 오디오 장치 없이 Clear로 파일을 처리하는 헤드리스 렌더러
+//   clr --render in.wav out.wav [--preset name] [--ambience x] [--voice y] [--reverb z] [--jobs n]
+// - in이 폴더면 안의 오디오 파일을 모두 out 폴더에 .wav로 렌더 (하위 폴더 제외)
+// - 워커 스레드마다 자체 플러그인 인스턴스를 두고 실시간보다 빠르게(큰 블록, non-realtime) 처리
+// - processBlock만 워커 스레드에서 돌고, 인스턴스 생성/해제와 prepareToPlay/reset/파라미터 변경/releaseResources는
+//   워커가 메시지 스레드로 넘겨 끝날 때까지 기다림 (메시지 루프가 돌고 있어야 진행됨)
+class OfflineRenderer : private juce::Timer {
+public:
+    struct Settings {
+        juce::File input;
+        juce::File output;
+        // 플러그인 파라미터 값(0~1). 비어 있으면 플러그인 기본값 유지
+        std::optional<float> ambience, voice, voiceReverb;
+        std::optional<bool> stereo;
+        int numJobs = 0;                // 0 = CPU 코어 수
+        int blockSize = DEFAULT_BLOCK_SIZE;
+    };
+
+    static bool isRenderCommandLine(const juce::StringArray& args);
+
+    // --preset을 먼저 적용하고 개별 값(--ambience 등)으로 덮어씀
+    static bool parseCommandLine(const juce::StringArray& args, Settings& settings, juce::String& error);
+
+    static juce::String getUsage();
+
+    explicit OfflineRenderer(const Settings& settingsToUse);
+    ~OfflineRenderer() override;
+
+    // 메시지 스레드: 작업 목록을 만들고 인스턴스를 생성한 뒤 워커 시작. 실패하면 false
+    bool start(juce::String& error);
+
+    // 모든 작업이 끝나면 메시지 스레드에서 호출 (0 = 모두 성공)
+    std::function<void(int exitCode)> onFinished;
+
+    static constexpr int DEFAULT_BLOCK_SIZE = 4096;
+
+private:
+    struct Job {
+        juce::File input;
+        juce::File output;
+    };
+
+    class Worker;
+
+    bool collectJobs(juce::String& error);
+    void timerCallback() override;
+
+    // 워커 스레드: 다음 작업 (없으면 nullptr)
+    const Job* takeNextJob() noexcept;
+    void jobFinished(bool succeeded) noexcept;
+
+    const Settings settings;
+    juce::AudioPluginFormatManager pluginFormats;
+    juce::Array<Job> jobs;
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    std::atomic<int> nextJob { 0 };
+    std::atomic<int> succeededJobs { 0 };
+    std::atomic<int> failedJobs { 0 };
+    double startMs = 0.0;
+
+    static constexpr int COMPLETION_POLL_MS = 50;
+};
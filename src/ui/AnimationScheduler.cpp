@@ -0,0 +1,102 @@
+#include "AnimationScheduler.h"
+#include <algorithm>
+
+AnimationScheduler::AnimationScheduler(juce::Component& componentToRepaint)
+    : component(componentToRepaint) {}
+
+AnimationScheduler::~AnimationScheduler() {
+    cancelPendingUpdate();
+    vblank.reset();
+}
+
+int AnimationScheduler::addTrack(const juce::String& name, Tick onTick) {
+    tracks.push_back({ name, std::move(onTick) });
+    return (int)tracks.size() - 1;
+}
+
+void AnimationScheduler::schedule(int track, double periodMs) {
+    if (!juce::isPositiveAndBelow(track, (int)tracks.size())) return;
+
+    auto& t = tracks[(size_t)track];
+    t.periodMs = juce::jmax(0.0, periodMs);
+    t.nextDueMs = juce::Time::getMillisecondCounterHiRes() + t.periodMs;
+    t.active = true;
+    ++t.generation;
+    updateAttachment();
+}
+
+void AnimationScheduler::cancel(int track) {
+    if (!juce::isPositiveAndBelow(track, (int)tracks.size())) return;
+
+    tracks[(size_t)track].active = false;
+    updateAttachment();
+}
+
+void AnimationScheduler::cancelAll() {
+    for (auto& t : tracks) t.active = false;
+    updateAttachment();
+}
+
+bool AnimationScheduler::isScheduled(int track) const {
+    return juce::isPositiveAndBelow(track, (int)tracks.size()) && tracks[(size_t)track].active;
+}
+
+void AnimationScheduler::repaint(juce::Rectangle<int> area) {
+    if (inTick) {
+        pendingRepaint.add(area);
+    } else {
+        component.repaint(area);
+    }
+}
+
+void AnimationScheduler::updateAttachment() {
+    const bool anyActive = std::any_of(tracks.begin(), tracks.end(), [](const Track& t) { return t.active; });
+
+    if (anyActive) {
+        cancelPendingUpdate();
+        if (vblank == nullptr) {
+            vblank = std::make_unique<juce::VBlankAttachment>(&component, [this] { onVBlank(); });
+        }
+    } else if (vblank != nullptr) {
+        // VBlank 콜백 안에서 자기 attachment를 지우지 않도록 해제는 다음 메시지 루프에서
+        if (inTick) {
+            triggerAsyncUpdate();
+        } else {
+            vblank.reset();
+        }
+    }
+}
+
+void AnimationScheduler::handleAsyncUpdate() {
+    updateAttachment();
+}
+
+void AnimationScheduler::onVBlank() {
+    const double nowMs = juce::Time::getMillisecondCounterHiRes();
+    inTick = true;
+
+    // 틱 도중 다른 트랙을 schedule/cancel 할 수 있으므로 인덱스로 순회
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        if (!tracks[i].active || nowMs < tracks[i].nextDueMs - DUE_TOLERANCE_MS) continue;
+
+        // 밀린 주기는 몰아서 실행하지 않고 지금부터 다시 셈
+        tracks[i].nextDueMs = nowMs + tracks[i].periodMs;
+        const auto generation = tracks[i].generation;
+        const bool keepRunning = tracks[i].onTick();
+
+        // 콜백이 자기 트랙을 다시 schedule 했으면 그 설정을 따름
+        if (!keepRunning && tracks[i].generation == generation) {
+            tracks[i].active = false;
+        }
+    }
+
+    // 이번 프레임에 모인 영역을 합쳐서 한 번에 전달
+    if (!pendingRepaint.isEmpty()) {
+        pendingRepaint.consolidate();
+        for (const auto& area : pendingRepaint) component.repaint(area);
+        pendingRepaint.clear();
+    }
+
+    updateAttachment();
+    inTick = false;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <JuceHeader.h>
+#include <functional>
+#include <vector>
+
+// 화면 갱신(VBlank)에 맞춰 도는 애니메이션 스케줄러
+// - 트랙마다 주기가 따로 있고 (0이면 매 프레임), 콜백이 false를 반환하면 그 트랙은 멈춤
+// - 실행 중인 트랙이 하나도 없으면 VBlankAttachment를 해제해 깨어나지 않음
+// - 틱 안에서 요청한 repaint 영역은 프레임 끝에 합쳐서 한 번에 전달
+// - 모든 호출은 메시지 스레드에서만
+class AnimationScheduler : private juce::AsyncUpdater {
+public:
+    using Tick = std::function<bool()>;
+
+    explicit AnimationScheduler(juce::Component& componentToRepaint);
+    ~AnimationScheduler() override;
+
+    // 트랙 등록 (생성 시 한 번) - 반환된 번호로 schedule/cancel
+    int addTrack(const juce::String& name, Tick onTick);
+
+    // periodMs 뒤에 첫 틱, 이후 periodMs마다 반복 (이미 실행 중이면 처음부터 다시)
+    void schedule(int track, double periodMs);
+    void cancel(int track);
+    void cancelAll();
+    bool isScheduled(int track) const;
+
+    // 틱 안에서는 프레임 끝까지 모아서, 밖에서는 바로 컴포넌트에 전달
+    void repaint(juce::Rectangle<int> area);
+
+private:
+    struct Track {
+        juce::String name;
+        Tick onTick;
+        double periodMs = 0.0;
+        double nextDueMs = 0.0;
+        bool active = false;
+        juce::uint32 generation = 0;   // schedule될 때마다 증가 (틱 안에서 다시 예약했는지 확인)
+    };
+
+    // 예정 시각보다 이만큼 이르게 온 프레임도 실행 (프레임 간격 때문에 한 프레임씩 밀리지 않도록)
+    static constexpr double DUE_TOLERANCE_MS = 4.0;
+
+    void onVBlank();
+    void updateAttachment();
+    void handleAsyncUpdate() override;
+
+    juce::Component& component;
+    std::vector<Track> tracks;
+    std::unique_ptr<juce::VBlankAttachment> vblank;
+    juce::RectangleList<int> pendingRepaint;
+    bool inTick = false;    // VBlank 콜백 실행 중
+};
@@ -0,0 +1,43 @@
+#include "AudioMeterOverlay.h"
+
+AudioMeterOverlay::AudioMeterOverlay(const AudioCallbackMeter& meterToShow)
+    : meter(meterToShow) {
+    setInterceptsMouseClicks(false, false);
+}
+
+void AudioMeterOverlay::visibilityChanged() {
+    if (isVisible()) {
+        snapshot = meter.getSnapshot();
+        startTimerHz(REFRESH_HZ);
+    } else {
+        stopTimer();
+    }
+}
+
+void AudioMeterOverlay::timerCallback() {
+    snapshot = meter.getSnapshot();
+    repaint();
+}
+
+void AudioMeterOverlay::paint(juce::Graphics& g) {
+    g.setColour(juce::Colours::black.withAlpha(0.75f));
+    g.fillRoundedRectangle(getLocalBounds().toFloat(), 4.0f);
+
+    // 오버런/xrun이 있으면 빨간색으로 강조
+    const bool hasDropouts = snapshot.overruns > 0 || snapshot.xruns > 0;
+
+    juce::StringArray lines;
+    lines.add("load " + juce::String(snapshot.loadP50, 0) + "/" + juce::String(snapshot.loadP99, 0)
+              + "/" + juce::String(snapshot.loadMax, 0) + " %");
+    lines.add("jit " + juce::String(snapshot.jitterP50, 2) + "/" + juce::String(snapshot.jitterP99, 2)
+              + "/" + juce::String(snapshot.jitterMax, 2) + " ms");
+    lines.add("over " + juce::String((juce::int64)snapshot.overruns) + "  xrun " + juce::String((juce::int64)snapshot.xruns));
+    lines.add(juce::String(snapshot.blockSize) + " @ " + juce::String(snapshot.sampleRate / 1000.0, 1) + "k");
+
+    g.setFont(juce::Font(juce::Font::getDefaultMonospacedFontName(), 10.0f, juce::Font::plain));
+    const int lineHeight = (getHeight() - 4) / juce::jmax(1, lines.size());
+    for (int i = 0; i < lines.size(); ++i) {
+        g.setColour((i == 2 && hasDropouts) ? juce::Colour(0xFFB23636).brighter(0.3f) : juce::Colours::white.withAlpha(0.9f));
+        g.drawText(lines[i], 4, 2 + i * lineHeight, getWidth() - 8, lineHeight, juce::Justification::centredLeft);
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <JuceHeader.h>
+#include "../audio/AudioCallbackMeter.h"
+
+// AudioCallbackMeter 값을 보여주는 작은 반투명 오버레이 (Bottom의 "cpu" 토글로 표시/숨김)
+// - 보이는 동안에만 자체 타이머로 자기 영역만 다시 그림 (메인 컴포넌트 repaint 없음)
+class AudioMeterOverlay : public juce::Component, private juce::Timer {
+public:
+    explicit AudioMeterOverlay(const AudioCallbackMeter& meterToShow);
+
+    void paint(juce::Graphics& g) override;
+    void visibilityChanged() override;
+
+    static constexpr int REFRESH_HZ = 10;
+
+private:
+    void timerCallback() override;
+
+    const AudioCallbackMeter& meter;
+    AudioCallbackMeter::Snapshot snapshot;
+};
@@ -0,0 +1,63 @@
+#include "GlyphLayoutCache.h"
+
+GlyphLayoutCache::GlyphLayoutCache(const juce::String& typefaceNameToUse)
+    : typefaceName(typefaceNameToUse) {}
+
+juce::Font GlyphLayoutCache::getFont(float fontHeight) const {
+    return juce::Font(typefaceName, fontHeight, juce::Font::plain);
+}
+
+const GlyphLayoutCache::Layout& GlyphLayoutCache::get(const juce::String& text, float fontHeight) {
+    const auto key = std::make_pair(juce::roundToInt(fontHeight * 100.0f), text);
+    auto it = layouts.find(key);
+    if (it != layouts.end()) return it->second;
+
+    const auto font = getFont(fontHeight);
+    Layout layout;
+    layout.glyphs.addLineOfText(font, text, 0.0f, 0.0f);
+    layout.bounds = layout.glyphs.getBoundingBox(0, -1, true);
+    layout.inkBounds = layout.glyphs.getBoundingBox(0, -1, false);
+    layout.width = font.getStringWidth(text);
+    layout.height = font.getHeight();
+
+    return layouts.emplace(key, std::move(layout)).first->second;
+}
+
+void GlyphLayoutCache::drawText(juce::Graphics& g, const juce::String& text, juce::Rectangle<int> area,
+                                juce::Justification justification, float fontHeight) {
+    if (text.isEmpty()) return;
+
+    const auto& layout = get(text, fontHeight);
+
+    // 말줄임이 필요한 긴 이름은 JUCE에 맡김 (드롭다운의 긴 장치 이름 등)
+    if (layout.bounds.getWidth() > (float)area.getWidth() + 1.0f) {
+        g.setFont(getFont(fontHeight));
+        g.drawText(text, area, justification);
+        return;
+    }
+
+    // GlyphArrangement::justifyGlyphs와 같은 규칙 (가운데 정렬은 공백 제외, 나머지는 공백 포함 영역 기준)
+    const bool centredH = justification.testFlags(juce::Justification::horizontallyCentred);
+    const auto& box = centredH ? layout.inkBounds : layout.bounds;
+    float dx = (float)area.getX();
+    float dy = (float)area.getY();
+
+    if (centredH) dx += ((float)area.getWidth() - box.getWidth()) * 0.5f - box.getX();
+    else if (justification.testFlags(juce::Justification::right)) dx += (float)area.getWidth() - box.getRight();
+    else dx -= box.getX();
+
+    if (justification.testFlags(juce::Justification::top)) dy -= box.getY();
+    else if (justification.testFlags(juce::Justification::bottom)) dy += (float)area.getHeight() - box.getBottom();
+    else dy += ((float)area.getHeight() - box.getHeight()) * 0.5f - box.getY();
+
+    layout.glyphs.draw(g, juce::AffineTransform::translation(dx, dy));
+}
+
+void GlyphLayoutCache::precompute(const juce::StringArray& texts, float fontHeight) {
+    for (const auto& text : texts) get(text, fontHeight);
+}
+
+void GlyphLayoutCache::clear() {
+    layouts.clear();
+    ++generation;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <JuceHeader.h>
+#include <map>
+
+// 고정 레이블, 장치 이름, 프리셋 이름의 글리프 배치/폭 캐시 (EuclidLookAndFeel 소유)
+// - 같은 문자열을 매 프레임, 매 마우스 이동마다 다시 재지 않도록 처음 쓸 때 한 번만 레이아웃
+// - 그리기와 hit test가 같은 값을 쓰므로 둘이 어긋나지 않음
+// - 폰트를 다시 로드하거나 목록이 바뀌면 clear → 세대 번호가 바뀌어 파생된 hit 영역 표도 다시 계산
+// - 메시지 스레드 전용
+class GlyphLayoutCache {
+public:
+    struct Layout {
+        juce::GlyphArrangement glyphs;      // 기준선 (0, 0)에 배치한 한 줄
+        juce::Rectangle<float> bounds;      // 공백 포함 영역 (왼쪽/오른쪽 정렬 기준)
+        juce::Rectangle<float> inkBounds;   // 공백 제외 영역 (가운데 정렬 기준)
+        int width = 0;                      // Font::getStringWidth와 같은 값
+        float height = 0.0f;                // Font::getHeight()
+    };
+
+    explicit GlyphLayoutCache(const juce::String& typefaceNameToUse);
+
+    const Layout& get(const juce::String& text, float fontHeight);
+    int getStringWidth(const juce::String& text, float fontHeight) { return get(text, fontHeight).width; }
+    juce::Font getFont(float fontHeight) const;
+
+    // g.drawText(text, area, justification)와 같은 위치에 그림 (영역보다 길면 drawText로 말줄임 처리)
+    void drawText(juce::Graphics& g, const juce::String& text, juce::Rectangle<int> area,
+                  juce::Justification justification, float fontHeight);
+
+    // 목록이 바뀌었을 때 미리 레이아웃 (첫 페인트/첫 hover에서 재지 않도록)
+    void precompute(const juce::StringArray& texts, float fontHeight);
+
+    void clear();
+    juce::uint32 getGeneration() const noexcept { return generation; }
+
+private:
+    juce::String typefaceName;
+    std::map<std::pair<int, juce::String>, Layout> layouts;    // (폰트 높이 x100, 문자열)
+    juce::uint32 generation = 1;
+};
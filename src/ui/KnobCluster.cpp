@@ -0,0 +1,149 @@
+#include "KnobCluster.h"
+#include <map>
+
+//==============================================================================
+const juce::Image& KnobShadowSprite::get(float radius, float scale) {
+    static std::map<std::pair<int, int>, juce::Image> sprites;
+    const auto key = std::make_pair(juce::roundToInt(radius * 100.0f), juce::roundToInt(scale * 100.0f));
+
+    auto& sprite = sprites[key];
+    if (!sprite.isValid()) {
+        const int size = juce::roundToInt((radius + PADDING) * 2.0f * scale);
+        sprite = juce::Image(juce::Image::SingleChannel, size, size, true);
+        juce::Graphics sg(sprite);
+        sg.addTransform(juce::AffineTransform::scale(scale));
+        sg.setColour(juce::Colours::white);
+        sg.fillEllipse(PADDING, PADDING, radius * 2.0f, radius * 2.0f);
+    }
+    return sprite;
+}
+
+void KnobShadowSprite::draw(juce::Graphics& g, juce::Point<float> centre, float radius) {
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto& sprite = get(radius, scale);
+    const float extent = radius + PADDING;
+    g.drawImage(sprite, juce::Rectangle<float>(centre.x - extent, centre.y - extent, extent * 2.0f, extent * 2.0f),
+                juce::RectanglePlacement::stretchToFit, true);
+}
+
+//==============================================================================
+void KnobWithLabel::draw(juce::Graphics& g, juce::Point<int> mousePos) const {
+    // 노브 중심점
+    float cx = area.getCentreX();
+    float cy = area.getCentreY();
+    float radius = 19.0f;
+
+    // 마우스 반대 방향으로 그림자 (창 밖 좌표도 그대로 사용)
+    if (auto shadowOffset = getShadowOffset({ cx, cy }, mousePos)) {
+        // 그림자 스케일: 고정값 1.05, 알파: 0.2(20%), 다크모드에서는 1.5배
+        float shadowScale = 1.05f;
+        float shadowAlpha = 0.2f;
+        if (darkMode) shadowAlpha = std::min(1.0f, shadowAlpha * 1.5f);
+
+        g.setColour(juce::Colours::black.withAlpha(shadowAlpha));
+        if (shadowMode == ShadowMode::sprite) {
+            KnobShadowSprite::draw(g, { cx + shadowOffset->x, cy + shadowOffset->y }, radius * shadowScale);
+        } else {
+            float shadowRadius = radius * shadowScale;
+            g.fillEllipse(cx - shadowRadius + shadowOffset->x, cy - shadowRadius + shadowOffset->y, shadowRadius * 2, shadowRadius * 2);
+        }
+    }
+
+    // 노브 원
+    g.setColour(knobColour);
+    g.fillEllipse(cx - radius, cy - radius, radius * 2, radius * 2);
+
+    // 인디케이터 - Face 색상 사용
+    // 270도 범위로 확장: minAngle을 15도 더 반시계, maxAngle을 15도 더 시계방향
+    float minAngle = juce::MathConstants<float>::pi * 5.0f/6.0f - juce::MathConstants<float>::pi * 15.0f/180.0f; // 15도 반시계 추가
+    float maxAngle = juce::MathConstants<float>::pi * 13.0f/6.0f + juce::MathConstants<float>::pi * 15.0f/180.0f; // 15도 시계방향 추가
+    // 0~2 범위를 0~1로 변환하여 각도 계산 (270도 회전 범위)
+    float normalizedValue = value / 2.0f;
+    float angle = minAngle + normalizedValue * (maxAngle - minAngle);
+    float startX = cx + std::cos(angle) * (radius + 0.0f); // 시작점을 노브 중심쪽으로 1px 이동
+    float startY = cy + std::sin(angle) * (radius + 0.0f);
+    float endX = cx + std::cos(angle) * (radius - FONT_SIZE - 1.0f); // 끝점을 노브 중심쪽으로 1px 이동
+    float endY = cy + std::sin(angle) * (radius - FONT_SIZE - 1.0f);
+    g.setColour(indicatorColour); // Face 색상으로 변경
+    g.drawLine(startX, startY, endX, endY, 4.0f);
+
+    // 노브 주변 점 2개 그리기 (SHOW_DOTS에 따라 조건부 표시)
+    if (SHOW_DOTS) {
+        float dotDistance = 24.0f; // 점과 노브 중심간의 거리 (+1px)
+        float dotRadius = 1.5f; // 점 크기 (지름 3px, -1px)
+
+        // 1번점: 225도 - 90도 = 135도
+        float dot1Angle = juce::MathConstants<float>::pi + juce::MathConstants<float>::pi * 45.0f / 180.0f - juce::MathConstants<float>::pi * 90.0f / 180.0f; // 135도
+        float dot1X = cx + std::cos(dot1Angle) * dotDistance;
+        float dot1Y = cy + std::sin(dot1Angle) * dotDistance;
+
+        // 2번점: 135도 - 90도 = 45도
+        float dot2Angle = juce::MathConstants<float>::pi - juce::MathConstants<float>::pi * 45.0f / 180.0f - juce::MathConstants<float>::pi * 90.0f / 180.0f; // 45도
+        float dot2X = cx + std::cos(dot2Angle) * dotDistance;
+        float dot2Y = cy + std::sin(dot2Angle) * dotDistance;
+
+        // 점 그리기 (노브와 동일한 컬러, 알파값 적용)
+        g.setColour(knobColour);
+        g.fillEllipse(dot1X - dotRadius, dot1Y - dotRadius, dotRadius * 2, dotRadius * 2);
+        g.fillEllipse(dot2X - dotRadius, dot2Y - dotRadius, dotRadius * 2, dotRadius * 2);
+    }
+
+    // 레이블 또는 값 표시
+    int labelW = area.getWidth();
+    int labelH = 20;
+    int labelX = area.getX();
+    int labelY = static_cast<int>(cy + radius - 1); // 노브 원 아래 -1px (2px 아래)
+    g.setColour(labelColour);
+
+    juce::String displayText;
+    if (showValue) {
+        // 소숫점 두자리까지 표시
+        displayText = juce::String(value, 2);
+    } else {
+        displayText = labelText;
+    }
+
+    text.drawText(g, displayText, { labelX, labelY, labelW, labelH }, juce::Justification::centred, FONT_SIZE);
+}
+
+std::optional<juce::Point<float>> KnobWithLabel::getShadowOffset(juce::Point<float> centre, juce::Point<int> mousePos) {
+    float dx = mousePos.x - centre.x;
+    float dy = mousePos.y - centre.y;
+    float distance = std::sqrt(dx * dx + dy * dy);
+    if (distance <= 0.0f) return std::nullopt;
+
+    float maxDistance = 100.0f; // 최대 거리 100px
+    float normalizedDistance = std::min(distance / maxDistance, 1.0f);
+
+    // 그림자 offset: 1px ~ 7px, 마우스 반대 방향
+    float shadowOffset = 1.0f + normalizedDistance * MAX_SHADOW_TRAVEL;
+    return juce::Point<float>(-dx / distance * shadowOffset, -dy / distance * shadowOffset);
+}
+
+//==============================================================================
+void KnobCluster::draw(juce::Graphics& g, juce::Point<int> mousePos) const {
+    struct KnobPos { int dx, dy; const char* label; };
+    KnobPos knobPos[3] = {
+        {-46, -37, "amb"},
+        {  0,  -2, "vox"},
+        { 46, -37, "v. rev"}
+    };
+    for (int i = 0; i < 3; ++i) {
+        int cx = center.x + knobPos[i].dx;
+        int cy = center.y + knobPos[i].dy;
+        knobRects[i] = juce::Rectangle<int>(cx - 20, cy - 20, 40, 40);
+        KnobWithLabel knob(
+            text,
+            knobRects[i],
+            values[i],
+            knobPos[i].label,
+            textColor.withAlpha(alpha),
+            textColor.withAlpha(alpha),
+            faceColor,
+            showValues[i],
+            darkMode,
+            shadowMode
+        );
+        knob.draw(g, mousePos);
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <JuceHeader.h>
+#include <optional>
+#include <vector>
+#include "GlyphLayoutCache.h"
+
+// 노브 그림자 스프라이트 - 안티앨리어싱된 원을 화면 배율별로 한 번만 렌더링해 두고
+// 매 프레임에는 현재 색(알파)을 마스크로 채워 오프셋 위치에 한 번 복사
+class KnobShadowSprite {
+public:
+    static const juce::Image& get(float radius, float scale);
+
+    // g의 현재 색으로 (centre 중심, radius 반지름) 원을 그린 것과 같은 결과
+    static void draw(juce::Graphics& g, juce::Point<float> centre, float radius);
+
+private:
+    // 안티앨리어싱 가장자리가 잘리지 않도록 둘레에 남기는 여백 (논리 px)
+    static constexpr float PADDING = 1.0f;
+};
+
+class KnobWithLabel {
+public:
+    // 그림자 그리기 방식 - 앱은 항상 sprite, ellipse는 이전 방식(매 프레임 fillEllipse) 비교용
+    enum class ShadowMode { sprite, ellipse };
+
+    KnobWithLabel(GlyphLayoutCache& text, juce::Rectangle<int> area, float value, const juce::String& labelText, juce::Colour knobColour, juce::Colour labelColour, juce::Colour indicatorColour, bool showValue = false, bool darkMode = false, ShadowMode shadowMode = ShadowMode::sprite)
+        : text(text), area(area), value(value), labelText(labelText), knobColour(knobColour), labelColour(labelColour), indicatorColour(indicatorColour), showValue(showValue), darkMode(darkMode), shadowMode(shadowMode) {}
+
+    void draw(juce::Graphics& g, juce::Point<int> mousePos = juce::Point<int>(-1, -1)) const;
+
+    void setShowValue(bool shouldShow) {
+        showValue = shouldShow;
+    }
+
+    // 노브 중심 기준 그림자 위치 (마우스가 정확히 중심에 있으면 그림자 없음)
+    // 호버 시 다시 그릴지 판단할 때도 같은 계산을 사용
+    static std::optional<juce::Point<float>> getShadowOffset(juce::Point<float> centre, juce::Point<int> mousePos);
+
+    // 거리에 따라 늘어나는 그림자 오프셋의 최대값
+    static constexpr float MAX_SHADOW_TRAVEL = 6.0f;
+    // 그림자가 노브 영역(40x40) 밖으로 나갈 수 있는 최대 픽셀 (7px 오프셋 + 1.05배 스케일 + 안티앨리어싱)
+    static constexpr int SHADOW_MARGIN = 9;
+    // 레이블 글자 크기 (앱의 기본 글자 크기와 같음)
+    static constexpr float FONT_SIZE = 16.0f;
+    // 노브 주변 점 표시 여부
+    static constexpr bool SHOW_DOTS = false;
+
+    GlyphLayoutCache& text;
+    juce::Rectangle<int> area;
+    float value;
+    juce::String labelText;
+    juce::Colour knobColour;
+    juce::Colour labelColour;
+    juce::Colour indicatorColour;
+    bool showValue;
+    bool darkMode;
+    ShadowMode shadowMode;
+};
+
+class KnobCluster {
+public:
+    KnobCluster(GlyphLayoutCache& text, juce::Point<int> center, std::vector<float>& values, std::vector<juce::Rectangle<int>>& rects, juce::Colour faceColor, std::vector<bool>& showValues, float alpha = 1.0f, juce::Colour textColor = juce::Colours::black, bool darkMode = false, KnobWithLabel::ShadowMode shadowMode = KnobWithLabel::ShadowMode::sprite)
+        : text(text), values(values), knobRects(rects), center(center), faceColor(faceColor), showValues(showValues), alpha(alpha), textColor(textColor), darkMode(darkMode), shadowMode(shadowMode) {}
+
+    void draw(juce::Graphics& g, juce::Point<int> mousePos = juce::Point<int>(-1, -1)) const;
+
+    GlyphLayoutCache& text;
+    // 값을 외부에서 바꿀 수 있도록 참조로 보관
+    std::vector<float>& values;
+    std::vector<juce::Rectangle<int>>& knobRects;
+    juce::Point<int> center;
+    juce::Colour faceColor;
+    std::vector<bool>& showValues;
+    float alpha;
+    juce::Colour textColor;
+    bool darkMode;
+    KnobWithLabel::ShadowMode shadowMode;
+};
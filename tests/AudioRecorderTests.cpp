@@ -0,0 +1,111 @@
+#include <JuceHeader.h>
+#include <atomic>
+#include "../src/audio/AudioRecorder.h"
+
+namespace {
+    // 일부러 느린 파일 싱크 - 쓰기마다 디스크가 막힌 것처럼 잠들고, 가끔 훨씬 오래 멈춤
+    class SlowRecordingSink : public RecordingEncoder {
+    public:
+        explicit SlowRecordingSink(std::atomic<juce::int64>& framesToReport) : reportedFrames(framesToReport) {}
+
+        bool open(const juce::File&, double, int, int) override { return true; }
+
+        bool write(const juce::AudioBuffer<float>&, int numFrames) override {
+            juce::Thread::sleep(++numWrites % STALL_EVERY == 0 ? STALL_MS : WRITE_MS);
+            framesWritten += numFrames;
+            reportedFrames.store(framesWritten);
+            return true;
+        }
+
+        bool commit() override {
+            juce::Thread::sleep(WRITE_MS);
+            return true;
+        }
+
+        bool finish() override { return true; }
+        juce::int64 getFramesWritten() const override { return framesWritten; }
+
+        static constexpr int WRITE_MS = 40;
+        static constexpr int STALL_MS = 400;
+        static constexpr int STALL_EVERY = 5;
+
+    private:
+        std::atomic<juce::int64>& reportedFrames;
+        juce::int64 framesWritten = 0;
+        int numWrites = 0;
+    };
+}
+
+// 48 kHz / 32 샘플 콜백을 실시간 간격으로 돌리면서 느린 싱크에 녹음
+// - 콜백(processAudioData)이 싱크를 기다리지 않고(최악 시간 < WORST_CALLBACK_MS), 링 버퍼가 넘치지 않으며, 모든 샘플이 싱크에 도달해야 함
+// - 한 블록 길이(0.67 ms)는 CI 스케줄링 지연만으로도 넘을 수 있으므로 기록만 하고, 한계는 싱크 쓰기(40 ms)보다 충분히 짧게 잡음
+// - 임시 파일과 프로세스 간 락은 사용자 앱 데이터 폴더가 아닌 테스트 임시 폴더에 만듦
+class AudioRecorderStressTest : public juce::UnitTest {
+public:
+    AudioRecorderStressTest() : juce::UnitTest("AudioRecorder slow sink stress", "ClearHost") {}
+
+    void runTest() override {
+        beginTest("48 kHz / 32 samples against a slow sink");
+
+        const juce::TemporaryFile folder;
+        folder.getFile().createDirectory();
+
+        std::atomic<juce::int64> sinkFrames { 0 };
+        AudioRecorder recorder(SAMPLE_RATE, 0.0);
+        recorder.setDirectories(folder.getFile().getChildFile("temp"), folder.getFile().getChildFile("out"));
+        recorder.prepare(SAMPLE_RATE, BLOCK_SIZE);
+        recorder.setEncoderFactory([&sinkFrames](RecordingFormat) {
+            return std::make_unique<SlowRecordingSink>(sinkFrames);
+        });
+
+        juce::AudioBuffer<float> block(2, BLOCK_SIZE);
+        for (int ch = 0; ch < block.getNumChannels(); ++ch) {
+            for (int i = 0; i < BLOCK_SIZE; ++i) block.setSample(ch, i, std::sin((float)i * 0.1f) * 0.5f);
+        }
+
+        recorder.startRecording();
+        expect(recorder.isRecordingActive());
+
+        const auto ticksPerSecond = (double)juce::Time::getHighResolutionTicksPerSecond();
+        const double blockSeconds = BLOCK_SIZE / (double)SAMPLE_RATE;
+        const int numCallbacks = (int)(TEST_SECONDS / blockSeconds);
+
+        double worstMs = 0.0, totalMs = 0.0;
+        int overBudget = 0;
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+
+        for (int n = 0; n < numCallbacks; ++n) {
+            // 실제 장치처럼 블록 길이마다 한 번씩 호출
+            const auto dueTicks = startTicks + (juce::int64)(n * blockSeconds * ticksPerSecond);
+            while (juce::Time::getHighResolutionTicks() < dueTicks) juce::Thread::yield();
+
+            const auto before = juce::Time::getHighResolutionTicks();
+            recorder.processAudioData(nullptr, 0, block.getArrayOfReadPointers(), block.getNumChannels(), BLOCK_SIZE);
+            const double ms = (juce::Time::getHighResolutionTicks() - before) * 1000.0 / ticksPerSecond;
+
+            worstMs = juce::jmax(worstMs, ms);
+            totalMs += ms;
+            if (ms > blockSeconds * 1000.0) ++overBudget;
+        }
+
+        recorder.stopRecording();
+
+        logMessage("callbacks: " + juce::String(numCallbacks)
+                   + ", mean " + juce::String(totalMs * 1000.0 / numCallbacks, 2) + " us"
+                   + ", worst " + juce::String(worstMs * 1000.0, 2) + " us"
+                   + ", longer than one block (" + juce::String(blockSeconds * 1.0e6, 1) + " us): " + juce::String(overBudget));
+
+        expectLessThan(worstMs, WORST_CALLBACK_MS, "worst callback time (ms)");
+        expectEquals((int)recorder.getOverflowCount(), 0, "ring buffer overflows");
+        expectEquals(sinkFrames.load(), (juce::int64)numCallbacks * BLOCK_SIZE, "frames reaching the sink");
+
+        folder.getFile().deleteRecursively();
+    }
+
+    static constexpr int SAMPLE_RATE = 48000;
+    static constexpr int BLOCK_SIZE = 32;
+    static constexpr double TEST_SECONDS = 3.0;
+    static constexpr double WORST_CALLBACK_MS = 10.0;
+};
+
+static AudioRecorderStressTest audioRecorderStressTest;
@@ -0,0 +1,137 @@
+#include <JuceHeader.h>
+#include "../src/audio/DeviceTransitionScheduler.h"
+
+namespace {
+    // 열고 닫기만 하는 가짜 출력 장치 (콜백은 돌리지 않으므로 페이드는 타임아웃 경로로 진행)
+    class DummyDevice : public juce::AudioIODevice {
+    public:
+        DummyDevice(const juce::String& deviceName, const juce::String& typeName) : juce::AudioIODevice(deviceName, typeName) {}
+
+        juce::StringArray getOutputChannelNames() override { return { "Left", "Right" }; }
+        juce::StringArray getInputChannelNames() override { return {}; }
+        juce::Array<double> getAvailableSampleRates() override { return { 48000.0 }; }
+        juce::Array<int> getAvailableBufferSizes() override { return { 256 }; }
+        int getDefaultBufferSize() override { return 256; }
+
+        juce::String open(const juce::BigInteger&, const juce::BigInteger& outputChannels, double, int) override {
+            activeOutputs = outputChannels;
+            opened = true;
+            return {};
+        }
+
+        void close() override { stop(); opened = false; }
+        bool isOpen() override { return opened; }
+
+        void start(juce::AudioIODeviceCallback* newCallback) override {
+            if (newCallback != nullptr && callback == nullptr) {
+                callback = newCallback;
+                callback->audioDeviceAboutToStart(this);
+            }
+        }
+
+        void stop() override {
+            if (auto* previous = std::exchange(callback, nullptr)) previous->audioDeviceStopped();
+        }
+
+        bool isPlaying() override { return callback != nullptr; }
+        juce::String getLastError() override { return {}; }
+        int getCurrentBufferSizeSamples() override { return 256; }
+        double getCurrentSampleRate() override { return 48000.0; }
+        int getCurrentBitDepth() override { return 32; }
+        juce::BigInteger getActiveOutputChannels() const override { return activeOutputs; }
+        juce::BigInteger getActiveInputChannels() const override { return {}; }
+        int getOutputLatencyInSamples() override { return 0; }
+        int getInputLatencyInSamples() override { return 0; }
+
+    private:
+        juce::AudioIODeviceCallback* callback = nullptr;
+        juce::BigInteger activeOutputs;
+        bool opened = false;
+    };
+
+    // 장치 생성 기록을 남기는 가짜 장치 종류 - 실제로 열린 장치 순서를 확인하는 데 사용
+    class DummyDeviceType : public juce::AudioIODeviceType {
+    public:
+        explicit DummyDeviceType(int numDevices) : juce::AudioIODeviceType("Dummy") {
+            for (int i = 0; i < numDevices; ++i) names.add("Out " + juce::String(i));
+        }
+
+        void scanForDevices() override {}
+        juce::StringArray getDeviceNames(bool wantInputNames) const override { return wantInputNames ? juce::StringArray() : names; }
+        int getDefaultDeviceIndex(bool forInput) const override { return forInput ? -1 : 0; }
+        int getIndexOfDevice(juce::AudioIODevice* device, bool asInput) const override {
+            return device != nullptr && !asInput ? names.indexOf(device->getName()) : -1;
+        }
+        bool hasSeparateInputsAndOutputs() const override { return true; }
+
+        juce::AudioIODevice* createDevice(const juce::String& outputDeviceName, const juce::String&) override {
+            if (!names.contains(outputDeviceName)) return nullptr;
+            createdDevices.add(outputDeviceName);
+            return new DummyDevice(outputDeviceName, getTypeName());
+        }
+
+        juce::StringArray names;
+        juce::StringArray createdDevices;
+    };
+}
+
+// 드롭다운을 빠르게 훑는 상황: 50번 연속 출력 장치 요청 → 마지막 장치 하나만 실제로 열려야 함
+class DeviceTransitionBurstTest : public juce::UnitTest {
+public:
+    DeviceTransitionBurstTest() : juce::UnitTest("Device transition burst", "ClearHost") {}
+
+    void runTest() override {
+        beginTest("50 output switches coalesce into the last one");
+
+        juce::AudioDeviceManager deviceManager;
+        auto* deviceType = new DummyDeviceType(NUM_SWITCHES + 1);
+        deviceManager.addAudioDeviceType(std::unique_ptr<juce::AudioIODeviceType>(deviceType));
+        deviceManager.setCurrentAudioDeviceType("Dummy", false);
+
+        juce::AudioDeviceManager::AudioDeviceSetup setup;
+        setup.outputDeviceName = "Out 0";
+        setup.useDefaultOutputChannels = true;
+        expect(deviceManager.setAudioDeviceSetup(setup, true).isEmpty());
+        deviceType->createdDevices.clear();
+
+        TransitionFader fader;
+        fader.prepare(48000.0);
+        fader.fadeIn();
+
+        DeviceTransitionScheduler transitions(deviceManager, fader);
+        juce::Array<DeviceTransitionScheduler::Result> results;
+        transitions.onTransitionFinished = [&results](const DeviceTransitionScheduler::Result& result) { results.add(result); };
+
+        // 메시지 스레드에서 연달아 요청 (사이에 메시지 루프를 돌리지 않음)
+        for (int i = 1; i <= NUM_SWITCHES; ++i) {
+            transitions.requestOutputDevice("Out " + juce::String(i));
+        }
+
+        // 코얼레싱 구간 + 페이드 타임아웃이 지나고도 남을 만큼 메시지 루프를 돌림
+        const auto deadline = juce::Time::getMillisecondCounter() + 2000;
+        while (results.isEmpty() && juce::Time::getMillisecondCounter() < deadline) {
+            juce::MessageManager::getInstance()->runDispatchLoopUntil(10);
+        }
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(DeviceTransitionScheduler::COALESCE_WINDOW_MS * 3);
+
+        const auto lastDevice = "Out " + juce::String(NUM_SWITCHES);
+
+        expectEquals(results.size(), 1, "transitions applied");
+        if (!results.isEmpty()) {
+            expect(results.getFirst().succeeded());
+            expectEquals(results.getFirst().outputDevice, lastDevice);
+            expectEquals(results.getFirst().coalescedRequests, NUM_SWITCHES);
+        }
+
+        expectEquals(deviceType->createdDevices.joinIntoString(","), lastDevice, "devices opened during the burst");
+        expect(deviceManager.getCurrentAudioDevice() != nullptr
+               && deviceManager.getCurrentAudioDevice()->getName() == lastDevice);
+
+        transitions.stop();
+        deviceManager.closeAudioDevice();
+    }
+
+    static constexpr int NUM_SWITCHES = 50;
+};
+
+static DeviceTransitionBurstTest deviceTransitionBurstTest;
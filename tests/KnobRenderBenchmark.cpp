@@ -0,0 +1,62 @@
+#include <JuceHeader.h>
+#include "../src/ui/KnobCluster.h"
+
+// 노브 3개 + 호버 그림자를 10k 프레임 그려 이전 방식(매 프레임 fillEllipse)과 스프라이트 방식을 비교
+// - 1x / 2x(레티나) 화면 배율, 매 프레임 마우스 위치를 바꿔 그림자 오프셋이 움직이게 함
+class KnobRenderBenchmark : public juce::UnitTest {
+public:
+    KnobRenderBenchmark() : juce::UnitTest("KnobCluster rendering", "Benchmarks") {}
+
+    void runTest() override {
+        GlyphLayoutCache text { juce::String() };
+
+        for (const float scale : { 1.0f, 2.0f }) {
+            beginTest("10k frames at " + juce::String(scale, 0) + "x");
+
+            const double ellipseFps = render(text, scale, KnobWithLabel::ShadowMode::ellipse);
+            const double spriteFps = render(text, scale, KnobWithLabel::ShadowMode::sprite);
+
+            logMessage("ellipse shadow: " + juce::String(ellipseFps, 0) + " fps, sprite shadow: "
+                       + juce::String(spriteFps, 0) + " fps ("
+                       + juce::String(ellipseFps > 0.0 ? spriteFps / ellipseFps : 0.0, 2) + "x)");
+        }
+    }
+
+private:
+    // 메인 창과 같은 크기/위치로 그려 초당 프레임 수 반환
+    static double render(GlyphLayoutCache& text, float scale, KnobWithLabel::ShadowMode shadowMode) {
+        juce::Image frame(juce::Image::ARGB, juce::roundToInt(WIDTH * scale), juce::roundToInt(HEIGHT * scale), true);
+        std::vector<float> values { 0.5f, 1.0f, 1.5f };
+        std::vector<juce::Rectangle<int>> rects(3);
+        std::vector<bool> showValues { false, true, false };
+
+        const KnobCluster cluster(text, { WIDTH / 2, 150 }, values, rects, juce::Colours::orange, showValues,
+                                  0.8f, juce::Colours::black, false, shadowMode);
+
+        // 스프라이트 생성과 글리프 레이아웃은 측정에서 제외
+        {
+            juce::Graphics g(frame);
+            g.addTransform(juce::AffineTransform::scale(scale));
+            cluster.draw(g, { 0, 0 });
+        }
+
+        const auto start = juce::Time::getHighResolutionTicks();
+        for (int i = 0; i < NUM_FRAMES; ++i) {
+            juce::Graphics g(frame);
+            g.addTransform(juce::AffineTransform::scale(scale));
+            g.fillAll(juce::Colours::white);
+            // 창 위를 원을 그리며 움직이는 마우스
+            const float phase = (float)i * 0.01f;
+            cluster.draw(g, { WIDTH / 2 + juce::roundToInt(std::cos(phase) * 70.0f),
+                              120 + juce::roundToInt(std::sin(phase) * 90.0f) });
+        }
+        const double seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        return seconds > 0.0 ? NUM_FRAMES / seconds : 0.0;
+    }
+
+    static constexpr int WIDTH = 160;
+    static constexpr int HEIGHT = 265;
+    static constexpr int NUM_FRAMES = 10000;
+};
+
+static KnobRenderBenchmark knobRenderBenchmark;
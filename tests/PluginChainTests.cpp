@@ -0,0 +1,132 @@
+#include <JuceHeader.h>
+#include "TestProcessors.h"
+#include "../src/audio/PluginChain.h"
+#include "../src/plugin/PresetStore.h"
+
+// 실행 중 슬롯 플러그인이 지연을 바꾸면 체인 지연, bypass dry 지연, 호스트 알림이 함께 따라가야 함
+class PluginChainLatencyTest : public juce::UnitTest {
+public:
+    PluginChainLatencyTest() : juce::UnitTest("Effect chain latency changes", "ClearHost") {}
+
+    void runTest() override {
+        beginTest("slot listener follows reported latency");
+
+        PluginChain pluginChain;
+        int notifications = 0;
+        pluginChain.onLatencyChanged = [&notifications] { ++notifications; };
+
+        auto plugin = std::make_unique<StandInProcessor>(64);
+        auto* standIn = plugin.get();
+        auto slot = std::make_shared<PluginChain::Slot>(std::move(plugin), PluginChain::Position::beforeClear, true);
+
+        pluginChain.prepare(SAMPLE_RATE, BLOCK_SIZE);
+        pluginChain.swapLayout(pluginChain.buildLayout({ slot }));
+        expectEquals(pluginChain.getLatencySamples(), 64);
+
+        standIn->reportLatency(NEW_LATENCY);
+        expectEquals(slot->getLatencySamples(), NEW_LATENCY);
+        expectEquals(pluginChain.getLatencySamples(), NEW_LATENCY);
+        expectEquals(notifications, 1);
+
+        // bypass 중 출력은 새 지연만큼 늦춘 dry
+        juce::AudioBuffer<float> buffer(PluginChain::NUM_CHANNELS, BLOCK_SIZE);
+        buffer.clear();
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch) buffer.setSample(ch, 0, 1.0f);
+        pluginChain.process(PluginChain::Position::beforeClear, buffer, 0, BLOCK_SIZE);
+        expectEquals(buffer.getSample(0, NEW_LATENCY), 1.0f);
+        expectEquals(buffer.getSample(0, 64), 0.0f);
+
+        pluginChain.release();
+        pluginChain.swapLayout(std::make_shared<const PluginChain::Layout>());
+    }
+
+    static constexpr double SAMPLE_RATE = 48000.0;
+    static constexpr int BLOCK_SIZE = 256;
+    static constexpr int NEW_LATENCY = 128;
+};
+
+static PluginChainLatencyTest pluginChainLatencyTest;
+
+// 프리셋에 저장한 체인 구성은 다시 읽었을 때 슬롯 순서, 위치, bypass, 플러그인 설명과 상태가 같아야 함
+// - 실제 PluginChain::capture 결과를 save → 새 저장소의 loadAll로 디스크를 거쳐 왕복 (테스트 임시 폴더)
+class PresetChainRoundTripTest : public juce::UnitTest {
+public:
+    PresetChainRoundTripTest() : juce::UnitTest("Preset chain round trip", "ClearHost") {}
+
+    void runTest() override {
+        beginTest("Chain layout saved with a preset loads back unchanged");
+
+        const juce::TemporaryFile folder;
+        folder.getFile().createDirectory();
+
+        PluginChain pluginChain;
+        PluginChain::Layout slots;
+        const std::array<std::pair<PluginChain::Position, bool>, 3> layout { {
+            { PluginChain::Position::beforeClear, false },
+            { PluginChain::Position::afterClear, true },
+            { PluginChain::Position::afterClear, false },
+        } };
+        for (size_t i = 0; i < layout.size(); ++i) {
+            auto plugin = std::make_unique<StandInProcessor>();
+            // 슬롯마다 다른 상태
+            plugin->voice->setValueNotifyingHost(0.1f + 0.2f * (float)i);
+            slots.push_back(std::make_shared<PluginChain::Slot>(std::move(plugin), layout[i].first, layout[i].second));
+        }
+        pluginChain.prepare(SAMPLE_RATE, BLOCK_SIZE);
+        pluginChain.swapLayout(pluginChain.buildLayout(std::move(slots)));
+
+        PresetSnapshot preset;
+        preset.name = "Chain Round Trip";
+        preset.hasChain = true;
+        preset.chain = pluginChain.capture();
+
+        PresetSnapshot withoutChain;
+        withoutChain.name = "No Chain";
+
+        {
+            PresetStore store(folder.getFile());
+            store.loadAll();
+            expect(store.save(preset), "save");
+            expect(store.save(withoutChain), "save without chain");
+        }
+
+        PresetStore reloaded(folder.getFile());
+        reloaded.loadAll();
+        const auto* loaded = reloaded.find(preset.name);
+        expect(loaded != nullptr, "saved preset not found after reload");
+
+        if (loaded != nullptr) {
+            expect(loaded->hasChain);
+            expectEquals((int)loaded->chain.size(), (int)preset.chain.size(), "slot count");
+
+            for (size_t i = 0; i < juce::jmin(loaded->chain.size(), preset.chain.size()); ++i) {
+                const auto& expected = preset.chain[i];
+                const auto& actual = loaded->chain[i];
+                const auto slotName = "slot " + juce::String((int)i) + ": ";
+
+                expect(actual.position == expected.position, slotName + "position");
+                expect(actual.bypassed == expected.bypassed, slotName + "bypass");
+                expectEquals(actual.description.name, expected.description.name, slotName + "name");
+                expectEquals(actual.description.pluginFormatName, expected.description.pluginFormatName, slotName + "format");
+                expectEquals(actual.description.uniqueId, expected.description.uniqueId, slotName + "unique id");
+                expect(actual.state == expected.state, slotName + "plugin state");
+            }
+        }
+
+        // 체인 없이 저장한 프리셋은 불러올 때 현재 체인을 유지해야 함
+        if (const auto* loadedWithoutChain = reloaded.find(withoutChain.name)) {
+            expect(!loadedWithoutChain->hasChain, "preset without a chain loaded one");
+        } else {
+            expect(false, "preset without a chain not found after reload");
+        }
+
+        pluginChain.release();
+        pluginChain.swapLayout(std::make_shared<const PluginChain::Layout>());
+        folder.getFile().deleteRecursively();
+    }
+
+    static constexpr double SAMPLE_RATE = 48000.0;
+    static constexpr int BLOCK_SIZE = 256;
+};
+
+static PresetChainRoundTripTest presetChainRoundTripTest;
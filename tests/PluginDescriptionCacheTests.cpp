@@ -0,0 +1,138 @@
+#include <JuceHeader.h>
+#include "TestProcessors.h"
+#include "../src/plugin/ClearPluginLocator.h"
+#include "../src/plugin/PluginDescriptionCache.h"
+
+namespace {
+    // 생성/스캔 호출 횟수를 세는 가짜 포맷 - 성공하면 StandInProcessor를 만들고, 실패 포맷은 항상 오류
+    class CountingFormat : public juce::AudioPluginFormat {
+    public:
+        CountingFormat(const juce::String& nameToUse, bool shouldLoad) : name(nameToUse), loads(shouldLoad) {}
+
+        juce::String getName() const override { return name; }
+
+        void findAllTypesForFile(juce::OwnedArray<juce::PluginDescription>&, const juce::String&) override { ++scans; }
+        bool fileMightContainThisPluginType(const juce::String&) override { ++scans; return true; }
+        juce::String getNameOfPluginFromIdentifier(const juce::String& identifier) override { return identifier; }
+        bool pluginNeedsRescanning(const juce::PluginDescription&) override { return false; }
+        bool doesPluginStillExist(const juce::PluginDescription&) override { return true; }
+        bool canScanForPlugins() const override { return false; }
+        bool isTrivialToScan() const override { return true; }
+        juce::StringArray searchPathsForPlugins(const juce::FileSearchPath&, bool, bool) override { ++scans; return {}; }
+        juce::FileSearchPath getDefaultLocationsToSearch() override { return {}; }
+        bool requiresUnblockedMessageThreadDuringCreation(const juce::PluginDescription&) const override { return false; }
+
+        int creations = 0;
+        int scans = 0;
+
+    protected:
+        void createPluginInstance(const juce::PluginDescription&, double, int, PluginCreationCallback callback) override {
+            ++creations;
+            if (loads) {
+                callback(std::make_unique<StandInProcessor>(), {});
+            } else {
+                callback(nullptr, name + " failed to load");
+            }
+        }
+
+    private:
+        const juce::String name;
+        const bool loads;
+    };
+
+    // 앱 실행 한 번 - 라이브 앱(비동기)과 --render가 쓰는 것과 같은 후보 순서/캐시 정책의 동기 버전
+    std::unique_ptr<juce::AudioPluginInstance> launch(PluginDescriptionCache& cache, juce::AudioPluginFormatManager& formats,
+                                                      const juce::Array<ClearPluginLocator::FallbackBundle>& fallbacks) {
+        juce::String error;
+        return ClearPluginLocator::createInstance(formats, cache, ClearPluginLocator::findCandidates(cache, fallbacks),
+                                                  48000.0, 512, error);
+    }
+
+    juce::File makeBundle(const juce::File& parent, const juce::String& name) {
+        auto bundle = parent.getChildFile(name);
+        bundle.getChildFile("Contents").createDirectory();
+        bundle.getChildFile("Contents").getChildFile("Info.plist").replaceWithText("<plist/>");
+        return bundle;
+    }
+}
+
+// 첫 실행은 폴백 순서대로 탐색하고, 두 번째 실행은 캐시된 포맷으로 바로 로드해야 함 (다른 포맷 시도/스캔 없음)
+class PluginDescriptionCacheTest : public juce::UnitTest {
+public:
+    PluginDescriptionCacheTest() : juce::UnitTest("Plugin description cache", "ClearHost") {}
+
+    void runTest() override {
+        const juce::TemporaryFile folder;
+        folder.getFile().createDirectory();
+        const auto cacheFile = folder.getFile().getChildFile("plugin_cache.xml");
+
+        juce::AudioPluginFormatManager formats;
+        auto* broken = new CountingFormat("Broken", false);
+        auto* standIn = new CountingFormat("StandIn", true);
+        formats.addFormat(broken);
+        formats.addFormat(standIn);
+
+        // 실패하는 포맷이 먼저 (실제 앱에서 VST3이 실패하고 AU로 넘어가는 경우)
+        const juce::Array<ClearPluginLocator::FallbackBundle> fallbacks {
+            { makeBundle(folder.getFile(), "Clear.broken"), "Broken" },
+            { makeBundle(folder.getFile(), "Clear.standin"), "StandIn" },
+        };
+
+        beginTest("First launch probes the fallbacks in order");
+        {
+            PluginDescriptionCache cache(cacheFile);
+            expect(launch(cache, formats, fallbacks) != nullptr);
+            expectEquals(broken->creations, 1);
+            expectEquals(standIn->creations, 1);
+            expect(cacheFile.existsAsFile());
+        }
+
+        beginTest("Second launch goes straight to the cached format");
+        {
+            broken->creations = standIn->creations = 0;
+            PluginDescriptionCache cache(cacheFile);
+            const auto candidates = ClearPluginLocator::findCandidates(cache, fallbacks);
+            expect(!candidates.isEmpty() && candidates.getFirst().fromCache);
+            expectEquals(candidates.getFirst().description.pluginFormatName, juce::String("StandIn"));
+
+            expect(launch(cache, formats, fallbacks) != nullptr);
+            expectEquals(broken->creations, 0, "failing format was probed again");
+            expectEquals(standIn->creations, 1);
+            expectEquals(broken->scans + standIn->scans, 0, "plugin scan on a cached launch");
+        }
+
+        beginTest("Changing the bundle invalidates the cache");
+        {
+            broken->creations = standIn->creations = 0;
+            const auto plist = fallbacks[1].bundle.getChildFile("Contents").getChildFile("Info.plist");
+            plist.setLastModificationTime(plist.getLastModificationTime() + juce::RelativeTime::seconds(10.0));
+
+            PluginDescriptionCache cache(cacheFile);
+            expect(launch(cache, formats, fallbacks) != nullptr);
+            expectEquals(broken->creations, 1);
+            expectEquals(standIn->creations, 1);
+        }
+
+        beginTest("A failing cached description is invalidated");
+        {
+            // 캐시된 포맷이 이번에는 실패 (예: 플러그인이 깨진 채 같은 번들로 남음) - 다른 포맷은 없음
+            juce::AudioPluginFormatManager failingFormats;
+            auto* failingStandIn = new CountingFormat("StandIn", false);
+            failingFormats.addFormat(failingStandIn);
+
+            {
+                PluginDescriptionCache cache(cacheFile);
+                expect(launch(cache, failingFormats, fallbacks) == nullptr);
+                expectEquals(failingStandIn->creations, 1, "cached candidate tried again as a fallback");
+            }
+
+            PluginDescriptionCache cache(cacheFile);
+            const auto candidates = ClearPluginLocator::findCandidates(cache, fallbacks);
+            expect(candidates.isEmpty() || !candidates.getFirst().fromCache, "failed description still cached");
+        }
+
+        folder.getFile().deleteRecursively();
+    }
+};
+
+static PluginDescriptionCacheTest pluginDescriptionCacheTest;
@@ -0,0 +1,90 @@
+#include <JuceHeader.h>
+#include <algorithm>
+#include <vector>
+#include "TestProcessors.h"
+#include "../src/plugin/ParameterMap.h"
+#include "../src/plugin/PresetStore.h"
+
+// 사용자 프리셋 100개: 시작 시 한 번 읽는 시간과 불러오기(find + apply) 한 번의 지연
+// - 대역 플러그인의 전체 상태를 저장해 두고 매번 setStateInformation 경로로 적용
+// - 불러온 뒤 노브 파라미터가 프리셋 값과 같은지 확인 (측정 구간 밖)
+class PresetRecallBenchmark : public juce::UnitTest {
+public:
+    PresetRecallBenchmark() : juce::UnitTest("Preset recall latency", "Benchmarks") {}
+
+    void runTest() override {
+        beginTest(juce::String(NUM_PRESETS) + " user presets");
+
+        const juce::TemporaryFile folder;
+        folder.getFile().createDirectory();
+
+        StandInProcessor plugin;
+        ParameterMap parameterMap;
+        parameterMap.build(plugin);
+
+        juce::StringArray names;
+        {
+            PresetStore store(folder.getFile());
+            store.loadAll();
+            juce::Random random(3);
+            for (int i = 0; i < NUM_PRESETS; ++i) {
+                for (int knob = 0; knob < ParameterMap::NUM_KNOBS; ++knob) {
+                    parameterMap.setValueNotifyingHost(ParameterMap::roleForKnob(knob), random.nextFloat());
+                }
+                names.add("Preset " + juce::String(i + 1));
+                store.save(PresetStore::capture(names[i], plugin, parameterMap));
+            }
+        }
+
+        const double ticksPerMs = (double)juce::Time::getHighResolutionTicksPerSecond() / 1000.0;
+
+        // 시작 시 읽기 (파일 I/O는 여기서 한 번뿐)
+        PresetStore store(folder.getFile());
+        const auto loadStart = juce::Time::getHighResolutionTicks();
+        store.loadAll();
+        const double loadMs = (juce::Time::getHighResolutionTicks() - loadStart) / ticksPerMs;
+
+        std::vector<double> recallMs;
+        recallMs.reserve((size_t)(NUM_PRESETS * ROUNDS));
+        int missingPresets = 0, mismatchedKnobs = 0;
+        for (int round = 0; round < ROUNDS; ++round) {
+            for (const auto& name : names) {
+                const auto start = juce::Time::getHighResolutionTicks();
+                const auto* preset = store.find(name);
+                if (preset != nullptr) PresetStore::apply(*preset, plugin, parameterMap);
+                recallMs.push_back((juce::Time::getHighResolutionTicks() - start) / ticksPerMs);
+
+                if (preset == nullptr) {
+                    ++missingPresets;
+                    continue;
+                }
+                for (int knob = 0; knob < ParameterMap::NUM_KNOBS; ++knob) {
+                    const float value = parameterMap.getValue(ParameterMap::roleForKnob(knob));
+                    if (std::abs(value - preset->knobs[(size_t)knob]) > KNOB_TOLERANCE) ++mismatchedKnobs;
+                }
+            }
+        }
+
+        expectEquals(missingPresets, 0, "presets not found after loadAll");
+        expectEquals(mismatchedKnobs, 0, "knob parameters that differ from the recalled preset");
+
+        std::sort(recallMs.begin(), recallMs.end());
+        double totalMs = 0.0;
+        for (auto ms : recallMs) totalMs += ms;
+        const auto percentile = [&recallMs](double p) { return recallMs[(size_t)((recallMs.size() - 1) * p)]; };
+
+        logMessage("loadAll: " + juce::String(loadMs, 2) + " ms for " + juce::String((int)store.getPresets().size()) + " presets");
+        logMessage("recall: mean " + juce::String(totalMs * 1000.0 / (double)recallMs.size(), 1) + " us"
+                   + ", median " + juce::String(percentile(0.5) * 1000.0, 1) + " us"
+                   + ", p99 " + juce::String(percentile(0.99) * 1000.0, 1) + " us"
+                   + ", worst " + juce::String(recallMs.back() * 1000.0, 1) + " us");
+
+        folder.getFile().deleteRecursively();
+    }
+
+    static constexpr int NUM_PRESETS = 100;
+    static constexpr int ROUNDS = 10;
+    static constexpr float KNOB_TOLERANCE = 1.0e-4f;
+};
+
+static PresetRecallBenchmark presetRecallBenchmark;
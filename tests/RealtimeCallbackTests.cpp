@@ -0,0 +1,308 @@
+#include <JuceHeader.h>
+#include "TestProcessors.h"
+#include "../src/audio/AudioRecorder.h"
+#include "../src/audio/AudioCallbackMeter.h"
+#include "../src/audio/BypassCrossfader.h"
+#include "../src/audio/DeviceTransitionScheduler.h"
+#include "../src/audio/HostAudioCallback.h"
+#include "../src/audio/ParameterSmoother.h"
+#include "../src/audio/PluginChain.h"
+#include "../src/audio/RealtimeAllocationTracker.h"
+#include "../src/plugin/ParameterMap.h"
+
+namespace {
+    // 쓰기만 받고 버리는 녹음 싱크 (파일 없음)
+    class DiscardingSink : public RecordingEncoder {
+    public:
+        bool open(const juce::File&, double, int, int) override { return true; }
+        bool write(const juce::AudioBuffer<float>&, int numFrames) override { framesWritten += numFrames; return true; }
+        bool finish() override { return true; }
+        juce::int64 getFramesWritten() const override { return framesWritten; }
+
+    private:
+        juce::int64 framesWritten = 0;
+    };
+
+    // ClearHostApp과 같은 부품을 같은 순서로 준비하고, 콜백은 앱과 같은 HostAudioCallback으로 돌리는 호스트 대역
+    // (앱 컴포넌트 자체는 장치/창이 필요해 테스트에서 만들 수 없음)
+    class CallbackHarness {
+    public:
+        CallbackHarness() {
+            parameterMap.build(clear);
+
+            PluginChain::Layout slots;
+            slots.push_back(std::make_shared<PluginChain::Slot>(std::make_unique<StandInProcessor>(64), PluginChain::Position::beforeClear, false));
+            slots.push_back(std::make_shared<PluginChain::Slot>(std::make_unique<StandInProcessor>(), PluginChain::Position::afterClear, true));
+            pendingLayout = std::move(slots);
+
+            recorder.setEncoderFactory([](RecordingFormat) { return std::make_unique<DiscardingSink>(); });
+            recorder.setCaptureDryInput(true);
+        }
+
+        ~CallbackHarness() {
+            recorder.stopRecording();
+            audioCallback.release();
+            pluginChain.release();
+            pluginChain.swapLayout(std::make_shared<const PluginChain::Layout>());
+        }
+
+        // ClearHostApp::prepareToPlay와 같은 순서
+        void prepare(double sampleRate, int blockSize) {
+            clear.prepareToPlay(sampleRate, blockSize);
+            pluginChain.prepare(sampleRate, blockSize);
+            pluginChain.swapLayout(pluginChain.buildLayout(std::move(pendingLayout)));
+            clearBypass.prepare(sampleRate, 2, juce::jmax(blockSize, HostAudioCallback::MIN_DRY_INPUT_FRAMES), clear.getLatencySamples());
+            audioCallback.prepare(sampleRate, blockSize, pluginChain.getLatencySamples() + clear.getLatencySamples());
+            transitionFader.fadeIn();
+            recorder.prepare(sampleRate, blockSize);
+            recorder.startRecording();
+        }
+
+        // MIDI 스레드 쪽: CC 21(amb) / 24(bypass)
+        void addMidiCC(int controller, int value) {
+            auto message = juce::MidiMessage::controllerEvent(1, controller, value);
+            message.setTimeStamp(juce::Time::getMillisecondCounterHiRes() * 0.001);
+            audioCallback.addMidiMessage(message);
+        }
+
+        // 메시지 스레드 쪽: 노브 드래그
+        void moveKnob(int knobIndex, float value) { parameterSmoother.setTarget(knobIndex, value); }
+
+        bool isCapturingDryInput() const { return recorder.isCapturingDryInput(); }
+
+        // ClearHostApp::getNextAudioBlock과 같은 호출
+        void callback(juce::AudioBuffer<float>& buffer) {
+            audioCallback.process(juce::AudioSourceChannelInfo(buffer), &clear, &recorder);
+        }
+
+    private:
+        StandInProcessor clear;
+        ParameterMap parameterMap;
+        ParameterSmoother parameterSmoother;
+        BypassCrossfader clearBypass;
+        PluginChain pluginChain;
+        PluginChain::Layout pendingLayout;
+        TransitionFader transitionFader;
+        AudioCallbackMeter audioMeter;
+        HostAudioCallback audioCallback { pluginChain, clearBypass, parameterMap, parameterSmoother, transitionFader, audioMeter };
+        AudioRecorder recorder;
+    };
+}
+
+// 오디오 콜백 계약: prepare 이후 콜백 안에서는 힙 할당이 한 번도 없어야 함
+// - 대역 플러그인을 Clear 자리와 체인 앞/뒤 슬롯에 넣고, MIDI CC / 노브 변경 / 녹음을 함께 돌림
+// - 할당 추적기는 디버그 빌드에만 들어가므로 릴리즈 빌드에서는 횟수 검사가 의미 없음
+class RealtimeCallbackAllocationTest : public juce::UnitTest {
+public:
+    RealtimeCallbackAllocationTest() : juce::UnitTest("Audio callback allocations", "ClearHost") {}
+
+    void runTest() override {
+        beginTest("100k callbacks with MIDI, knob ramps, bypass and dry + processed recording");
+
+       #if ! JUCE_DEBUG
+        logMessage("Allocation tracking is compiled into debug builds only - count is not checked");
+       #endif
+
+        CallbackHarness host;
+        host.prepare(SAMPLE_RATE, BLOCK_SIZE);
+        expect(host.isCapturingDryInput(), "dry input capture is not running");
+
+        juce::AudioBuffer<float> buffer(2, BLOCK_SIZE);
+        juce::Random random(1);
+        RealtimeAllocationTracker::resetAllocationCount();
+
+        for (int n = 0; n < NUM_CALLBACKS; ++n) {
+            // 콜백 사이에 다른 스레드가 하는 일 (할당이 있어도 실시간 구간 밖)
+            if (n % 7 == 0) host.addMidiCC(21 + random.nextInt(3), random.nextInt(128));
+            if (n % 500 == 0) host.addMidiCC(24, random.nextBool() ? 127 : 0);
+            if (n % 13 == 0) host.moveKnob(random.nextInt(3), random.nextFloat());
+            if (n % 1000 == 0) {
+                // CC 폭주: 노브를 빠르게 돌린 것처럼 한 블록에 몰아넣음 (prepare에서 잡은 MIDI 버퍼 용량 안)
+                for (int i = 0; i < 200; ++i) host.addMidiCC(22, i % 128);
+            }
+
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch) {
+                juce::FloatVectorOperations::fill(buffer.getWritePointer(ch), 0.25f, BLOCK_SIZE);
+            }
+            host.callback(buffer);
+        }
+
+        const auto allocations = RealtimeAllocationTracker::getAllocationCount();
+        logMessage(juce::String(NUM_CALLBACKS) + " callbacks, " + juce::String((juce::int64)allocations) + " allocations");
+        expectEquals((juce::int64)allocations, (juce::int64)0, "heap allocations inside the audio callback");
+    }
+
+    static constexpr double SAMPLE_RATE = 48000.0;
+    static constexpr int BLOCK_SIZE = 256;
+    static constexpr int NUM_CALLBACKS = 100000;
+};
+
+static RealtimeCallbackAllocationTest realtimeCallbackAllocationTest;
+
+// 블록 중간 타임스탬프의 MIDI CC는 그 샘플 위치부터 파라미터를 바꿔야 함 (블록 시작으로 당겨지거나 다음 블록으로 밀리지 않음)
+// - 대역 Clear의 출력 = 입력 × voice × 2 이므로 voice 램프가 시작된 위치가 출력에 그대로 보임
+class MidiCCSampleOffsetTest : public juce::UnitTest {
+public:
+    MidiCCSampleOffsetTest() : juce::UnitTest("MIDI CC sample offset", "ClearHost") {}
+
+    void runTest() override {
+        beginTest("CC 22 in the middle of a block ramps the voice gain from its sample offset");
+
+        StandInProcessor clear;
+        ParameterMap parameterMap;
+        parameterMap.build(clear);
+        ParameterSmoother parameterSmoother;
+        BypassCrossfader clearBypass;
+        PluginChain pluginChain;
+        TransitionFader transitionFader;
+        AudioCallbackMeter audioMeter;
+        HostAudioCallback audioCallback { pluginChain, clearBypass, parameterMap, parameterSmoother, transitionFader, audioMeter };
+
+        clear.prepareToPlay(SAMPLE_RATE, BLOCK_SIZE);
+        pluginChain.prepare(SAMPLE_RATE, BLOCK_SIZE);
+        clearBypass.prepare(SAMPLE_RATE, 2, juce::jmax(BLOCK_SIZE, HostAudioCallback::MIN_DRY_INPUT_FRAMES), clear.getLatencySamples());
+        audioCallback.prepare(SAMPLE_RATE, BLOCK_SIZE, clear.getLatencySamples());
+        transitionFader.fadeIn();
+
+        juce::AudioBuffer<float> buffer(2, BLOCK_SIZE);
+        auto processBlock = [&](const juce::MidiBuffer& midi) {
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch) {
+                juce::FloatVectorOperations::fill(buffer.getWritePointer(ch), 1.0f, BLOCK_SIZE);
+            }
+            audioCallback.processWithMidi(juce::AudioSourceChannelInfo(buffer), &clear, nullptr, midi);
+        };
+
+        // 장치 페이드 인이 끝날 때까지 (voice 기본값 0.5 → 게인 1)
+        const juce::MidiBuffer noMidi;
+        for (int n = 0; n < WARM_UP_BLOCKS; ++n) processBlock(noMidi);
+        expectWithinAbsoluteError(buffer.getSample(0, BLOCK_SIZE - 1), 1.0f, TOLERANCE, "gain before the CC");
+
+        juce::MidiBuffer midi;
+        midi.addEvent(juce::MidiMessage::controllerEvent(1, HostAudioCallback::FIRST_MIDI_CC + 1, 127), CC_OFFSET);
+        processBlock(midi);
+
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch) {
+            int firstChanged = -1;
+            for (int i = 0; i < BLOCK_SIZE && firstChanged < 0; ++i) {
+                if (std::abs(buffer.getSample(ch, i) - 1.0f) > TOLERANCE) firstChanged = i;
+            }
+
+            // 램프는 CC 위치에서 시작하고, 첫 서브블록(RAMP_SUB_BLOCK) 안에 출력에 나타나야 함
+            expectGreaterOrEqual(firstChanged, CC_OFFSET, "gain changed before the CC's sample offset");
+            expectLessThan(firstChanged, CC_OFFSET + ParameterSmoother::RAMP_SUB_BLOCK, "gain change started late");
+            expectGreaterThan(buffer.getSample(ch, BLOCK_SIZE - 1), 1.0f + TOLERANCE, "gain did not move toward the CC value");
+        }
+
+        audioCallback.release();
+        pluginChain.release();
+        clear.releaseResources();
+    }
+
+    static constexpr double SAMPLE_RATE = 48000.0;
+    static constexpr int BLOCK_SIZE = 512;
+    // MIN_MIDI_SUB_BLOCK보다 충분히 떨어진, RAMP_SUB_BLOCK 경계가 아닌 위치
+    static constexpr int CC_OFFSET = 203;
+    // 장치 페이드 인(TransitionFader::FADE_MS)보다 길게
+    static constexpr int WARM_UP_BLOCKS = 8;
+    static constexpr float TOLERANCE = 1.0e-5f;
+};
+
+static MidiCCSampleOffsetTest midiCCSampleOffsetTest;
+
+// dry 녹음은 Clear 지연만큼 늦춰 기록되므로 입력의 임펄스가 dry 파일과 처리된 파일의 같은 프레임에 있어야 함
+// - 대역 Clear는 보고한 지연만큼 실제로 출력을 늦춤, 녹음은 테스트 임시 폴더에
+class DryRecordingAlignmentTest : public juce::UnitTest {
+public:
+    DryRecordingAlignmentTest() : juce::UnitTest("Dry recording alignment", "ClearHost") {}
+
+    void runTest() override {
+        beginTest("Impulse lands on the same frame in the dry and processed files");
+
+        const juce::TemporaryFile folder;
+        folder.getFile().createDirectory();
+
+        StandInProcessor clear(LATENCY);
+        ParameterMap parameterMap;
+        parameterMap.build(clear);
+        ParameterSmoother parameterSmoother;
+        BypassCrossfader clearBypass;
+        PluginChain pluginChain;
+        TransitionFader transitionFader;
+        AudioCallbackMeter audioMeter;
+        HostAudioCallback audioCallback { pluginChain, clearBypass, parameterMap, parameterSmoother, transitionFader, audioMeter };
+
+        AudioRecorder recorder((int)SAMPLE_RATE, 0.0);
+        recorder.setDirectories(folder.getFile().getChildFile("temp"), folder.getFile().getChildFile("out"));
+        recorder.setFormat(RecordingFormat::float32);
+        recorder.setCaptureDryInput(true);
+        juce::File processedFile;
+        recorder.onRecordingSaved = [&processedFile](const juce::File& file) { processedFile = file; };
+
+        // ClearHostApp::prepareToPlay와 같은 순서
+        clear.prepareToPlay(SAMPLE_RATE, BLOCK_SIZE);
+        pluginChain.prepare(SAMPLE_RATE, BLOCK_SIZE);
+        clearBypass.prepare(SAMPLE_RATE, 2, juce::jmax(BLOCK_SIZE, HostAudioCallback::MIN_DRY_INPUT_FRAMES), clear.getLatencySamples());
+        audioCallback.prepare(SAMPLE_RATE, BLOCK_SIZE, pluginChain.getLatencySamples() + clear.getLatencySamples());
+        transitionFader.fadeIn();
+        recorder.prepare(SAMPLE_RATE, BLOCK_SIZE);
+        recorder.startRecording();
+        expect(recorder.isCapturingDryInput(), "dry input capture is not running");
+
+        juce::AudioBuffer<float> buffer(2, BLOCK_SIZE);
+        for (int n = 0; n < NUM_BLOCKS; ++n) {
+            buffer.clear();
+            if (n == IMPULSE_BLOCK) {
+                for (int ch = 0; ch < buffer.getNumChannels(); ++ch) buffer.setSample(ch, IMPULSE_OFFSET, 1.0f);
+            }
+            audioCallback.process(juce::AudioSourceChannelInfo(buffer), &clear, &recorder);
+        }
+
+        recorder.stopRecording();
+        audioCallback.release();
+        pluginChain.release();
+        clear.releaseResources();
+
+        expect(processedFile.existsAsFile(), "processed recording was not saved");
+        const auto dryFile = processedFile.getSiblingFile(processedFile.getFileNameWithoutExtension() + "_dry"
+                                                          + processedFile.getFileExtension());
+        expect(dryFile.existsAsFile(), "dry recording was not saved");
+
+        const auto expectedFrame = (juce::int64)(IMPULSE_BLOCK * BLOCK_SIZE + IMPULSE_OFFSET + LATENCY);
+        expectEquals(findPeakFrame(processedFile), expectedFrame, "processed impulse frame");
+        expectEquals(findPeakFrame(dryFile), expectedFrame, "dry impulse frame");
+
+        folder.getFile().deleteRecursively();
+    }
+
+private:
+    // 왼쪽 채널에서 절댓값이 가장 큰 프레임 (파일을 읽지 못하면 -1)
+    static juce::int64 findPeakFrame(const juce::File& file) {
+        juce::AudioFormatManager formats;
+        formats.registerBasicFormats();
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+        if (reader == nullptr) return -1;
+
+        juce::AudioBuffer<float> samples((int)reader->numChannels, (int)reader->lengthInSamples);
+        reader->read(&samples, 0, samples.getNumSamples(), 0, true, true);
+
+        juce::int64 peakFrame = -1;
+        float peak = 0.0f;
+        for (int i = 0; i < samples.getNumSamples(); ++i) {
+            const float magnitude = std::abs(samples.getSample(0, i));
+            if (magnitude > peak) {
+                peak = magnitude;
+                peakFrame = i;
+            }
+        }
+        return peakFrame;
+    }
+
+    static constexpr double SAMPLE_RATE = 48000.0;
+    static constexpr int BLOCK_SIZE = 256;
+    static constexpr int LATENCY = 300;         // 블록보다 길게 (여러 블록에 걸친 지연)
+    static constexpr int IMPULSE_BLOCK = 10;    // 장치 페이드 인 이후
+    static constexpr int IMPULSE_OFFSET = 77;
+    static constexpr int NUM_BLOCKS = 20;
+};
+
+static DryRecordingAlignmentTest dryRecordingAlignmentTest;
@@ -0,0 +1,67 @@
+#include <JuceHeader.h>
+#include <limits>
+#include <vector>
+#include "../src/audio/SampleConversion.h"
+
+// int16 변환: 선택된 SIMD 커널 vs 스칼라 기준 구현 (모노/스테레오/8채널, 32~4096 프레임)
+// - 블록마다 같은 총 프레임 수를 처리하도록 반복 횟수를 맞춰 프레임당 시간을 비교
+// - 출력 일치 여부는 SampleConversionKernelTest가 검사
+class SampleConversionBenchmark : public juce::UnitTest {
+public:
+    SampleConversionBenchmark() : juce::UnitTest("SampleConversion int16 kernels", "Benchmarks") {}
+
+    void runTest() override {
+        for (const int numChannels : { 1, 2, SampleConversion::MAX_CHANNELS }) {
+            beginTest(juce::String("float -> int16 interleaved, ") + juce::String(numChannels) + " ch: "
+                      + SampleConversion::getInt16KernelName() + " vs scalar");
+
+            juce::AudioBuffer<float> source(numChannels, MAX_FRAMES);
+            juce::Random random(7);
+            for (int ch = 0; ch < numChannels; ++ch) {
+                for (int i = 0; i < MAX_FRAMES; ++i) source.setSample(ch, i, random.nextFloat() * 2.4f - 1.2f);    // 클립 경로 포함
+            }
+
+            std::vector<juce::int16> kernelOut((size_t)(MAX_FRAMES * numChannels));
+            std::vector<juce::int16> scalarOut(kernelOut.size());
+
+            for (int numFrames = MIN_FRAMES; numFrames <= MAX_FRAMES; numFrames *= 2) {
+                const int iterations = FRAMES_PER_RUN / numFrames;
+                const auto* const* input = source.getArrayOfReadPointers();
+
+                const double kernelNs = measure(iterations, numFrames, [&] {
+                    SampleConversion::floatToInt16Interleaved(input, numChannels, numFrames, kernelOut.data());
+                });
+                const double scalarNs = measure(iterations, numFrames, [&] {
+                    SampleConversion::floatToInt16InterleavedScalar(input, numChannels, numFrames, scalarOut.data());
+                });
+
+                logMessage(juce::String(numFrames).paddedLeft(' ', 5) + " frames: "
+                           + juce::String(kernelNs, 2) + " ns/frame vs scalar " + juce::String(scalarNs, 2) + " ns/frame  ("
+                           + juce::String(kernelNs > 0.0 ? scalarNs / kernelNs : 0.0, 2) + "x)");
+            }
+        }
+    }
+
+private:
+    // 가장 빠른 회차의 프레임당 시간 (ns) - 스케줄링 잡음 제거
+    template <typename Function>
+    static double measure(int iterations, int numFrames, Function&& function) {
+        const double ticksPerNs = (double)juce::Time::getHighResolutionTicksPerSecond() / 1.0e9;
+        double best = std::numeric_limits<double>::max();
+
+        for (int round = 0; round < ROUNDS; ++round) {
+            const auto start = juce::Time::getHighResolutionTicks();
+            for (int i = 0; i < iterations; ++i) function();
+            const auto elapsed = juce::Time::getHighResolutionTicks() - start;
+            best = juce::jmin(best, (double)elapsed / ticksPerNs / ((double)iterations * numFrames));
+        }
+        return best;
+    }
+
+    static constexpr int MIN_FRAMES = 32;
+    static constexpr int MAX_FRAMES = 4096;
+    static constexpr int FRAMES_PER_RUN = 1 << 22;
+    static constexpr int ROUNDS = 5;
+};
+
+static SampleConversionBenchmark sampleConversionBenchmark;
@@ -0,0 +1,75 @@
+#include <JuceHeader.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "../src/audio/SampleConversion.h"
+
+// 선택된 int16 커널(AVX2/SSE2/NEON)은 스칼라 기준 구현과 모든 샘플이 같아야 함
+// - 1~8채널, 벡터 폭의 배수가 아닌 프레임 수(꼬리 처리), ±Inf/NaN/클립 구간, 디더 유무
+class SampleConversionKernelTest : public juce::UnitTest {
+public:
+    SampleConversionKernelTest() : juce::UnitTest("SampleConversion int16 kernel equivalence", "ClearHost") {}
+
+    void runTest() override {
+        beginTest(juce::String("NaN converts to silence (") + SampleConversion::getInt16KernelName() + ")");
+        {
+            // 커널의 벡터 구간과 스칼라 꼬리 모두에 NaN
+            std::vector<float> samples(37, std::numeric_limits<float>::quiet_NaN());
+            const float* source[] = { samples.data() };
+            std::vector<juce::int16> out(samples.size(), 1);
+            SampleConversion::floatToInt16Interleaved(source, 1, (int)samples.size(), out.data());
+
+            bool allZero = true;
+            for (auto value : out) allZero = allZero && value == 0;
+            expect(allZero, "NaN did not convert to 0");
+        }
+
+        for (const bool withDither : { false, true }) {
+            beginTest(juce::String("kernel matches scalar, 1-8 channels, ") + (withDither ? "with" : "without") + " dither");
+
+            for (int numChannels = 1; numChannels <= SampleConversion::MAX_CHANNELS; ++numChannels) {
+                for (const int numFrames : { 1, 7, 8, 9, 15, 16, 17, 31, 33, 255, 257, 1000, 4099 }) {
+                    const auto source = makeSource(numChannels, numFrames);
+
+                    std::vector<juce::int16> kernelOut((size_t)(numChannels * numFrames));
+                    std::vector<juce::int16> scalarOut(kernelOut.size());
+
+                    // 같은 시드 → 같은 디더 노이즈
+                    SampleConversion::Dither kernelDither(DITHER_SEED), scalarDither(DITHER_SEED);
+                    SampleConversion::floatToInt16Interleaved(source.getArrayOfReadPointers(), numChannels, numFrames,
+                                                              kernelOut.data(), withDither ? &kernelDither : nullptr);
+                    SampleConversion::floatToInt16InterleavedScalar(source.getArrayOfReadPointers(), numChannels, numFrames,
+                                                                    scalarOut.data(), withDither ? &scalarDither : nullptr);
+
+                    const auto mismatch = std::mismatch(kernelOut.begin(), kernelOut.end(), scalarOut.begin());
+                    expect(mismatch.first == kernelOut.end(),
+                           juce::String(numChannels) + " ch x " + juce::String(numFrames) + " frames: first difference at sample "
+                           + juce::String((int)(mismatch.first - kernelOut.begin())));
+                }
+            }
+        }
+    }
+
+private:
+    // 일반 신호 사이사이에 특수값을 섞음 (채널마다 위치를 어긋나게)
+    static juce::AudioBuffer<float> makeSource(int numChannels, int numFrames) {
+        const float specials[] = { std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                                   std::numeric_limits<float>::quiet_NaN(), 1.0f, -1.0f, 1.5f, -1.5f, 0.0f,
+                                   0.5f / 32767.0f, -0.5f / 32767.0f, std::numeric_limits<float>::denorm_min() };
+        constexpr int numSpecials = (int)(sizeof(specials) / sizeof(specials[0]));
+
+        juce::AudioBuffer<float> source(numChannels, numFrames);
+        juce::Random random(11 + numChannels * 31 + numFrames);
+        for (int ch = 0; ch < numChannels; ++ch) {
+            for (int i = 0; i < numFrames; ++i) {
+                const bool special = (i + ch) % 5 == 0;
+                source.setSample(ch, i, special ? specials[(i / 5 + ch) % numSpecials] : random.nextFloat() * 2.4f - 1.2f);
+            }
+        }
+        return source;
+    }
+
+    static constexpr juce::int64 DITHER_SEED = 0x436c6561;
+};
+
+static SampleConversionKernelTest sampleConversionKernelTest;
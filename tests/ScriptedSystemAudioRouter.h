@@ -0,0 +1,82 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+#include "../src/audio/SystemAudioRouter.h"
+
+// 테스트용 시스템 출력 라우팅 백엔드 - 장치 목록, 실패, 호출 지연을 미리 지정해 둠
+// - 서비스가 백엔드를 소유하므로 호출 기록은 서비스가 사라진 뒤에도 읽을 수 있는 공유 객체(Calls)에 남김
+// - 장치 목록이 비어 있으면 사용할 수 없는 백엔드
+class ScriptedSystemAudioRouter : public SystemAudioRouter {
+public:
+    struct Calls {
+        std::atomic<int> availabilityChecks { 0 };
+        std::atomic<int> setDefaultCalls { 0 };
+        std::atomic<int> finishedSetDefaultCalls { 0 };
+        juce::WaitableEvent setDefaultStarted;
+    };
+
+    ScriptedSystemAudioRouter(const juce::String& nameToUse, const juce::StringArray& outputDevices,
+                              const juce::String& defaultDevice, std::shared_ptr<Calls> callsToUse)
+        : name(nameToUse), devices(outputDevices), currentDefault(defaultDevice), calls(std::move(callsToUse)) {}
+
+    juce::String getBackendName() const override { return name; }
+
+    bool isAvailable() override {
+        ++calls->availabilityChecks;
+        return !devices.isEmpty();
+    }
+
+    juce::StringArray getOutputDevices() override {
+        const juce::ScopedLock sl(lock);
+        return consumeScriptedFailure() ? juce::StringArray() : devices;
+    }
+
+    juce::String getDefaultOutputDevice() override {
+        const juce::ScopedLock sl(lock);
+        return consumeScriptedFailure() ? juce::String() : currentDefault;
+    }
+
+    bool setDefaultOutputDevice(const juce::String& deviceName) override {
+        ++calls->setDefaultCalls;
+        calls->setDefaultStarted.signal();
+
+        // 느린 HAL 호출 흉내 (락 밖에서 기다려 조회는 막지 않음)
+        if (const int delay = setDefaultDelayMs.load()) juce::Thread::sleep(delay);
+
+        const juce::ScopedLock sl(lock);
+        ++calls->finishedSetDefaultCalls;
+        if (consumeScriptedFailure() || !devices.contains(deviceName)) return false;
+        currentDefault = deviceName;
+        return true;
+    }
+
+    // 다음 numCalls 번의 조회/변경 호출을 실패시킴
+    void failNextCalls(int numCalls) {
+        const juce::ScopedLock sl(lock);
+        pendingFailures = numCalls;
+    }
+
+    void setSetDefaultDelayMs(int delayMs) { setDefaultDelayMs.store(delayMs); }
+
+    juce::String getCurrentDefault() const {
+        const juce::ScopedLock sl(lock);
+        return currentDefault;
+    }
+
+private:
+    bool consumeScriptedFailure() {
+        if (pendingFailures <= 0) return false;
+        --pendingFailures;
+        return true;
+    }
+
+    const juce::String name;
+    const juce::StringArray devices;
+    std::shared_ptr<Calls> calls;
+    std::atomic<int> setDefaultDelayMs { 0 };
+
+    juce::CriticalSection lock;
+    juce::String currentDefault;
+    int pendingFailures = 0;
+};
@@ -0,0 +1,117 @@
+#include <JuceHeader.h>
+#include "ScriptedSystemAudioRouter.h"
+
+namespace {
+    // 완료 콜백이 받은 값 - 콜백은 메시지 루프에서 늦게 불릴 수 있으므로 공유 객체에 모음
+    struct Delivered {
+        int count = 0;
+        bool allOnMessageThread = true;
+        juce::StringArray devices;
+        juce::String saved;
+        bool setSucceeded = false;
+        juce::String current;
+
+        void arrived() {
+            ++count;
+            allOnMessageThread = allOnMessageThread && juce::MessageManager::getInstance()->isThisTheMessageThread();
+        }
+    };
+}
+
+// 워커 스레드 하나에서 저장 → 변경 → 복구 순서로 실행하고, 백엔드 탐색은 한 번만, 콜백은 메시지 스레드에서
+class SystemAudioRoutingTest : public juce::UnitTest {
+public:
+    SystemAudioRoutingTest() : juce::UnitTest("System audio routing service", "ClearHost") {}
+
+    void runTest() override {
+        beginTest("First available backend is probed once and the saved device round-trips");
+        {
+            auto unavailableCalls = std::make_shared<ScriptedSystemAudioRouter::Calls>();
+            auto calls = std::make_shared<ScriptedSystemAudioRouter::Calls>();
+
+            std::vector<std::unique_ptr<SystemAudioRouter>> backends;
+            backends.push_back(std::make_unique<ScriptedSystemAudioRouter>("Unavailable", juce::StringArray(), juce::String(), unavailableCalls));
+            auto scripted = std::make_unique<ScriptedSystemAudioRouter>("Scripted", juce::StringArray { "Speakers", VIRTUAL_DEVICE },
+                                                                        "Speakers", calls);
+            auto* router = scripted.get();
+            backends.push_back(std::move(scripted));
+
+            SystemAudioRoutingService service(std::move(backends));
+            auto delivered = std::make_shared<Delivered>();
+
+            service.getOutputDevices([delivered](juce::StringArray devices) { delivered->arrived(); delivered->devices = devices; });
+            service.saveDefaultOutputDevice("Fallback", [delivered](juce::String device) { delivered->arrived(); delivered->saved = device; });
+            service.setDefaultOutputDevice(VIRTUAL_DEVICE, [delivered](bool success) { delivered->arrived(); delivered->setSucceeded = success; });
+            service.getDefaultOutputDevice([delivered](juce::String device) { delivered->arrived(); delivered->current = device; });
+
+            // 여기서 메시지 스레드를 막고 있으므로 워커가 모두 끝나도 콜백은 아직 오지 않아야 함
+            expect(service.restoreSavedOutputDeviceAndWait(2000), "restore");
+            expectEquals(delivered->count, 0, "callbacks delivered before the message loop ran");
+
+            const auto deadline = juce::Time::getMillisecondCounter() + 2000;
+            while (delivered->count < 4 && juce::Time::getMillisecondCounter() < deadline) {
+                juce::MessageManager::getInstance()->runDispatchLoopUntil(10);
+            }
+
+            expectEquals(delivered->count, 4, "callbacks delivered");
+            expect(delivered->allOnMessageThread, "callback ran off the message thread");
+            expectEquals(delivered->devices.size(), 2);
+            expectEquals(delivered->saved, juce::String("Speakers"));
+            expect(delivered->setSucceeded);
+            expectEquals(delivered->current, juce::String(VIRTUAL_DEVICE));
+            expectEquals(router->getCurrentDefault(), juce::String("Speakers"), "restored device");
+
+            expectEquals(unavailableCalls->availabilityChecks.load(), 1, "unavailable backend probes");
+            expectEquals(calls->availabilityChecks.load(), 1, "available backend probes");
+        }
+
+        beginTest("Failed query saves the fallback device");
+        {
+            auto calls = std::make_shared<ScriptedSystemAudioRouter::Calls>();
+            auto scripted = std::make_unique<ScriptedSystemAudioRouter>("Scripted", juce::StringArray { "Speakers", "Headphones" },
+                                                                        "Speakers", calls);
+            auto* router = scripted.get();
+            router->failNextCalls(1);
+
+            std::vector<std::unique_ptr<SystemAudioRouter>> backends;
+            backends.push_back(std::move(scripted));
+            SystemAudioRoutingService service(std::move(backends));
+
+            service.saveDefaultOutputDevice("Headphones");
+            expect(service.restoreSavedOutputDeviceAndWait(2000), "restore");
+            expectEquals(router->getCurrentDefault(), juce::String("Headphones"));
+        }
+
+        beginTest("Waiting restore times out and destruction waits for the running job");
+        {
+            auto calls = std::make_shared<ScriptedSystemAudioRouter::Calls>();
+            {
+                auto scripted = std::make_unique<ScriptedSystemAudioRouter>("Slow", juce::StringArray { "Speakers", VIRTUAL_DEVICE },
+                                                                            "Speakers", calls);
+                scripted->setSetDefaultDelayMs(SLOW_CALL_MS);
+
+                std::vector<std::unique_ptr<SystemAudioRouter>> backends;
+                backends.push_back(std::move(scripted));
+                SystemAudioRoutingService service(std::move(backends));
+
+                service.saveDefaultOutputDevice("Speakers");
+                service.setDefaultOutputDevice(VIRTUAL_DEVICE);
+                expect(calls->setDefaultStarted.wait(2000), "slow call started");
+
+                // 변경 작업이 도는 동안 복구 작업은 대기열에 있으므로 제한 시간 안에 끝나지 않음
+                const auto start = juce::Time::getMillisecondCounter();
+                expect(!service.restoreSavedOutputDeviceAndWait(20), "restore finished behind a slow call");
+                expectLessThan((int)(juce::Time::getMillisecondCounter() - start), SLOW_CALL_MS, "restore wait overran its timeout");
+            }
+
+            // 실행 중이던 변경은 끝까지 기다리고, 대기 중이던 복구는 버림
+            expectEquals(calls->finishedSetDefaultCalls.load(), 1, "running job finished before destruction returned");
+            expectEquals(calls->setDefaultCalls.load(), 1, "queued job ran after destruction");
+        }
+    }
+
+    static constexpr const char* VIRTUAL_DEVICE = "ClearHost Virtual";
+    static constexpr int SLOW_CALL_MS = 300;
+};
+
+static SystemAudioRoutingTest systemAudioRoutingTest;
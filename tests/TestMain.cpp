@@ -0,0 +1,33 @@
+#include <JuceHeader.h>
+
+// ClearHostTests 진입점
+// - 인자 없이 실행하면 단위 테스트("ClearHost" 분류)만 실행 - ctest가 사용
+// - --benchmarks: 벤치마크("Benchmarks" 분류)만 실행하고 결과를 출력 (실패 판정 없음)
+// - --only=<이름>: 이름이 일치하는 테스트 하나만 실행
+int main(int argc, char* argv[]) {
+    // MessageManager, 폰트, 이미지가 필요한 테스트(장치 전환, 노브 렌더링)를 위해 GUI 초기화
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    const juce::ArgumentList args(argc, argv);
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+
+    const auto only = args.getValueForOption("--only");
+    if (only.isNotEmpty()) {
+        juce::Array<juce::UnitTest*> selected;
+        for (auto* test : juce::UnitTest::getAllTests()) {
+            if (test->getName() == only) selected.add(test);
+        }
+        runner.runTests(selected);
+    } else if (args.containsOption("--benchmarks")) {
+        runner.runTestsInCategory("Benchmarks");
+    } else {
+        runner.runTestsInCategory("ClearHost");
+    }
+
+    int failures = 0;
+    for (int i = 0; i < runner.getNumResults(); ++i) {
+        failures += runner.getResult(i)->failures;
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <JuceHeader.h>
+#include "../src/audio/LatencyDelayLine.h"
+
+// 테스트용 Clear 대역 - Clear와 같은 이름의 노브 파라미터 3개(+ Stereo)와 단순 게인 처리
+// - 보고한 지연만큼 실제로 출력을 늦춤 (prepareToPlay 이후, 준비한 블록 길이 안에서)
+// - AudioPluginInstance이므로 Clear 자리와 이펙트 체인 슬롯 양쪽에 넣을 수 있음
+// - 상태는 파라미터 값 XML (getStateInformation/setStateInformation으로 프리셋 왕복 가능)
+class StandInProcessor : public juce::AudioPluginInstance {
+public:
+    explicit StandInProcessor(int latencyToReport = 0)
+        : juce::AudioPluginInstance(BusesProperties()
+                                        .withInput("Input", juce::AudioChannelSet::stereo())
+                                        .withOutput("Output", juce::AudioChannelSet::stereo())) {
+        addParameter(ambience = new juce::AudioParameterFloat(juce::ParameterID { "ambience_gain", 1 }, "Ambience Gain", 0.0f, 1.0f, 0.5f));
+        addParameter(voice = new juce::AudioParameterFloat(juce::ParameterID { "voice_gain", 1 }, "Voice Gain", 0.0f, 1.0f, 0.5f));
+        addParameter(voiceReverb = new juce::AudioParameterFloat(juce::ParameterID { "voice_reverb_gain", 1 }, "Voice Reverb Gain", 0.0f, 1.0f, 0.5f));
+        addParameter(stereo = new juce::AudioParameterBool(juce::ParameterID { "stereo", 1 }, "Stereo", true));
+        setLatencySamples(latencyToReport);
+    }
+
+    const juce::String getName() const override { return "Stand-in"; }
+
+    void fillInPluginDescription(juce::PluginDescription& description) const override {
+        description.name = getName();
+        description.pluginFormatName = "StandIn";
+        description.fileOrIdentifier = "stand-in";
+        description.uniqueId = 0x53746e64;
+        description.numInputChannels = 2;
+        description.numOutputChannels = 2;
+    }
+
+    void prepareToPlay(double, int maximumExpectedSamplesPerBlock) override {
+        delay.prepare(2, maximumExpectedSamplesPerBlock, getLatencySamples());
+    }
+    void releaseResources() override {}
+
+    void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&) override {
+        buffer.applyGain(voice->get() * 2.0f);
+        delay.process(buffer, buffer.getNumSamples());
+    }
+
+    double getTailLengthSeconds() const override { return 0.0; }
+    bool acceptsMidi() const override { return true; }
+    bool producesMidi() const override { return false; }
+    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+    bool hasEditor() const override { return false; }
+
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram(int) override {}
+    const juce::String getProgramName(int) override { return {}; }
+    void changeProgramName(int, const juce::String&) override {}
+
+    void getStateInformation(juce::MemoryBlock& destData) override {
+        juce::XmlElement xml("StandInState");
+        for (auto* parameter : getParameters()) {
+            xml.setAttribute("p" + juce::String(parameter->getParameterIndex()), parameter->getValue());
+        }
+        copyXmlToBinary(xml, destData);
+    }
+
+    void setStateInformation(const void* data, int sizeInBytes) override {
+        if (auto xml = getXmlFromBinary(data, sizeInBytes)) {
+            for (auto* parameter : getParameters()) {
+                parameter->setValueNotifyingHost((float)xml->getDoubleAttribute("p" + juce::String(parameter->getParameterIndex()),
+                                                                                parameter->getValue()));
+            }
+        }
+    }
+
+    // 실행 중 지연 변경 (플러그인이 나중에 지연을 다시 보고하는 경우)
+    void reportLatency(int newLatency) {
+        delay.setLatencySamples(newLatency);
+        setLatencySamples(newLatency);
+    }
+
+    juce::AudioParameterFloat* ambience = nullptr;
+    juce::AudioParameterFloat* voice = nullptr;
+    juce::AudioParameterFloat* voiceReverb = nullptr;
+    juce::AudioParameterBool* stereo = nullptr;
+
+private:
+    LatencyDelayLine delay;
+};